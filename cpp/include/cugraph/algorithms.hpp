@@ -34,7 +34,9 @@
 #include <raft/random/rng_state.hpp>
 
 #include <optional>
+#include <string>
 #include <tuple>
+#include <vector>
 
 /** @ingroup cpp_api
  *  @{
@@ -349,6 +351,59 @@ rmm::device_uvector<weight_t> betweenness_centrality(
   bool const include_endpoints  = false,
   bool const do_expensive_check = false);
 
+/**
+ * @brief     Approximate betweenness centrality with adaptive source sampling
+ *
+ * Instead of taking a pre-selected list of sources (see betweenness_centrality()), this function
+ * draws sources uniformly at random (with replacement) in geometrically growing batches (using
+ * select_random_vertices()) and stops once the estimated centrality of every vertex is within
+ * @p epsilon of the exact centrality (the value betweenness_centrality() computes with all the
+ * vertices as sources) with probability at least 1 - @p delta.  The per-vertex error bound is the
+ * empirical Bernstein bound, so vertices with low-variance estimates (typically the majority) do
+ * not dictate the number of samples (ABRA-style progressive sampling).  If the bound is not met
+ * after @p max_num_samples samples, the function stops and the achieved confidence is reported.
+ *
+ * The current implementation does not support a weighted graph.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. Currently,
+ * edge_weight_view.has_value() should be false as we don't support weighted graphs, yet.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param epsilon            Bound on the absolute error of every returned centrality (in the
+ * units of the returned centralities, so normalized and unnormalized results need different
+ * values)
+ * @param delta              Failure probability of the bound (should be in (0.0, 1.0))
+ * @param max_num_samples    Maximum number of sampled sources (should be at least 2)
+ * @param normalized         A flag indicating results should be normalized
+ * @param include_endpoints  A flag indicating whether endpoints of a path should be counted
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ *
+ * @return Tuple of the device vector containing the estimated centralities, the number of sampled
+ * sources, and the achieved failure probability (the smallest delta for which @p epsilon bounds
+ * the error of every vertex; this is at most @p delta unless @p max_num_samples was reached).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, size_t, weight_t> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  weight_t const epsilon,
+  weight_t const delta,
+  size_t const max_num_samples,
+  bool const normalized         = true,
+  bool const include_endpoints  = false,
+  bool const do_expensive_check = false);
+
 /**
  * @brief     Compute edge betweenness centrality for a graph
  *
@@ -653,6 +708,52 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   size_t max_level    = 100,
   weight_t resolution = weight_t{1});
 
+/**
+ * @brief      Louvain implementation, returning a dendrogram spilled to a file
+ *
+ * This function works as the louvain() overload returning a dendrogram but every level is appended
+ * to a dendrogram file as soon as it is complete (when the next level is started) and its device
+ * memory is released (see Dendrogram::spill_levels_to_file()). Only the last level stays in device
+ * memory; the other levels are read back from the file when needed (e.g. by
+ * flatten_dendrogram()), or later with Dendrogram::open_file().
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     vertex_t              Type of vertex identifiers.
+ * @tparam     edge_t                Type of edge identifiers.
+ * @tparam     weight_t              Type of edge weights.
+ * @tparam     multi_gpu             Flag indicating whether template instantiation should target
+ *                                   single-GPU (false) or multi-GPU (true).
+ *
+ * @param[in]  handle                Library handle (RAFT)
+ * @param[in]  graph_view            Input graph view object
+ * @param[in]  edge_weight_view      View object holding edge weights for @p graph_view.
+ * @param[in]  dendrogram_file_path  Path to the dendrogram file to create (an existing file is
+ *                                   overwritten). In multi-GPU, every GPU writes its local levels
+ *                                   to its own file (so the path should differ for every GPU
+ *                                   unless the GPUs do not share a file system).
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ * @param[in]  resolution            (optional) The value of the resolution parameter to use.
+ *                                   Called gamma in the modularity formula, this changes the size
+ *                                   of the communities.  Higher resolutions lead to more smaller
+ *                                   communities, lower resolutions lead to fewer larger
+ *                                   communities. (default 1)
+ *
+ * @return                           a pair containing:
+ *                                     1) unique pointer to dendrogram (every level is saved in
+ *                                        the file)
+ *                                     2) modularity of the returned clustering
+ *
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& dendrogram_file_path,
+  size_t max_level    = 100,
+  weight_t resolution = weight_t{1});
+
 /**
  * @brief      Flatten a Dendrogram at a particular level
  *
@@ -677,6 +778,36 @@ void flatten_dendrogram(raft::handle_t const& handle,
                         Dendrogram<typename graph_view_t::vertex_type> const& dendrogram,
                         typename graph_view_t::vertex_type* clustering);
 
+/**
+ * @brief      Flatten a Dendrogram at a requested depth
+ *
+ * Assign every vertex the cluster it belongs to after applying the first @p level levels of the
+ * dendrogram (@p level = dendrogram.num_levels() is identical to flattening the entire
+ * dendrogram). Spilled levels (see Dendrogram::spill_levels_to_file()) are read from the file one
+ * at a time, and only the levels below @p level are read.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     vertex_t              Type of vertex identifiers.
+ * @tparam     edge_t                Type of edge identifiers.
+ * @tparam     multi_gpu             Flag indicating whether template instantiation should target
+ *                                   single-GPU (false) or multi-GPU (true).
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph_view            Input graph view object
+ * @param[in]  dendrogram            input dendrogram object
+ * @param[out] clustering            Pointer to device array where the clustering should be stored
+ * @param[in]  level                 Number of levels to apply, should be in
+ *                                   [0, dendrogram.num_levels()].
+ *
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void flatten_dendrogram(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        Dendrogram<vertex_t> const& dendrogram,
+                        vertex_t* clustering,
+                        size_t level);
+
 /**
  * @brief      Leiden implementation
  *
@@ -1022,12 +1153,19 @@ weight_t hungarian(raft::handle_t const& handle,
  * In a multi-gpu context the source vertices should be local to this GPU.
  * @param n_sources number of sources (one source per component at most).
  * @param direction_optimizing If set to true, this algorithm switches between the push based
- * breadth-first search and pull based breadth-first search depending on the size of the
- * breadth-first search frontier (currently unsupported). This option is valid only for symmetric
- * input graphs.
+ * (top-down) breadth-first search and pull based (bottom-up) breadth-first search depending on the
+ * size of the breadth-first search frontier. A pull step scans the unvisited vertices and stops at
+ * the first neighbor in the frontier, so this cuts the number of edge inspections in the large
+ * frontier iterations of low-diameter graphs. This option is valid only for symmetric input graphs.
  * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
  * farther than @p depth_limit hops from @p source_vertex will be marked as unreachable.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param direction_optimizing_alpha Switch from push to pull if the number of edges of the
+ * frontier vertices exceeds (the number of edges of the unvisited vertices) /
+ * @p direction_optimizing_alpha. Relevant only if @p direction_optimizing is true.
+ * @param direction_optimizing_beta Switch from pull back to push if the frontier is shrinking and
+ * the number of frontier vertices is smaller than (the number of vertices) /
+ * @p direction_optimizing_beta. Relevant only if @p direction_optimizing is true.
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 void bfs(raft::handle_t const& handle,
@@ -1035,10 +1173,48 @@ void bfs(raft::handle_t const& handle,
          vertex_t* distances,
          vertex_t* predecessors,
          vertex_t const* sources,
-         size_t n_sources          = 1,
-         bool direction_optimizing = false,
-         vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
-         bool do_expensive_check   = false);
+         size_t n_sources                  = 1,
+         bool direction_optimizing         = false,
+         vertex_t depth_limit              = std::numeric_limits<vertex_t>::max(),
+         bool do_expensive_check           = false,
+         double direction_optimizing_alpha = 14.0,
+         double direction_optimizing_beta  = 24.0);
+
+/**
+ * @brief Run breadth-first search from multiple sources with a separate distance array per source.
+ *
+ * Unlike bfs() (which computes one distance array shared by every source), this computes the
+ * distances from each source separately. Sources are processed in batches of 64 (one bit per
+ * source in a 64-bit word per vertex, following the MS-BFS algorithm by M. Then et al., "The More
+ * the Merrier: Efficient Multi-Source Graph Traversal," VLDB 2014), so every adjacency list scan is
+ * shared by all the sources in a batch that reach the vertex at the same depth.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Source vertices. Duplicate sources are allowed. In multi-GPU, every GPU should
+ * pass the same source vertices (sources are not required to be local to this GPU).
+ * @param distances Pointer to the output distance matrix (row-major, sources.size() rows and
+ * graph_view.local_vertex_partition_range_size() columns). The i'th row stores the distances from
+ * sources[i] to the vertices in the local vertex partition range
+ * (std::numeric_limits<vertex_t>::max() for unreachable vertices).
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from a source will be marked as unreachable from that source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void multi_source_bfs(raft::handle_t const& handle,
+                      graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                      raft::device_span<vertex_t const> sources,
+                      vertex_t* distances,
+                      vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+                      bool do_expensive_check = false);
 
 /**
  * @brief Extract paths from breadth-first search output
@@ -1077,6 +1253,61 @@ std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
   vertex_t const* destinations,
   size_t n_destinations);
 
+/**
+ * @brief Extract the paths to multiple destinations as a parent-pointer forest.
+ *
+ * This is a compressed alternative to extract_bfs_paths(). Instead of a dense [n_destinations x
+ * maximum path length] matrix, this returns the union of the paths as a forest (a trie of the
+ * reversed paths): every vertex on a path to a destination appears once along with the index of
+ * its predecessor in the forest, so the paths sharing a prefix share the storage and the cost is
+ * proportional to the number of distinct vertices on the paths. The path to a destination is
+ * recovered by following the parent indices from the destination's forest index to a root.
+ *
+ * This requires only the predecessors, so this works with the predecessors constructed by bfs(),
+ * sssp(), and their variants. A destination without a predecessor (a source or an unreachable
+ * vertex) is a root (and its path consists of the destination only).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param predecessors Pointer to the predecessor array (e.g. constructed by bfs() or sssp()). The
+ * predecessors should form a forest (no cycle).
+ * @param destinations Destination vertices, extract the path from the source to each of these
+ * destinations (duplicates are allowed).
+ * @param n_destinations Number of destinations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple of the forest vertices, the forest index of each forest vertex's parent
+ * (cugraph::invalid_vertex_id<vertex_t>::value for the roots), the forest index of each
+ * destination, and the path offsets (size @p n_destinations + 1, the path to the i'th
+ * destination has path_offsets[i + 1] - path_offsets[i] vertices, so the paths can be expanded to
+ * a compact array without padding).
+ */
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<size_t>>
+extract_path_forest(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+                    vertex_t const* predecessors,
+                    vertex_t const* destinations,
+                    size_t n_destinations,
+                    bool do_expensive_check = false);
+
+/**
+ * @brief Single-source shortest-path method.
+ *
+ * NEAR_FAR: the Near-Far pile method (Davidson et al., 2014), the default.
+ * DELTA_STEPPING: the delta-stepping method (Meyer & Sanders, 2003) with light (weight <= delta)
+ * and heavy (weight > delta) edge splitting. This performs fewer relaxations on graphs with a large
+ * diameter (e.g. road networks) or a wide edge weight spread.
+ */
+enum class sssp_method_t { NEAR_FAR = 0, DELTA_STEPPING };
+
 /**
  * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
  * the source vertex.
@@ -1103,6 +1334,13 @@ std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
  * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
  * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param method Single-source shortest-path method to use.
+ * @param delta Bucket width (should be positive). If `std::nullopt`, NEAR_FAR uses
+ * warp size * (average edge weight) / (average vertex degree) and DELTA_STEPPING uses
+ * min((maximum edge weight) / (average vertex degree), average edge weight).
+ * @param num_relaxations Pointer to store the number of edge relaxations that improved a tentative
+ * distance (summed over all the GPUs in multi-GPU), to compare the work of the methods, or
+ * `nullptr`.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 void sssp(raft::handle_t const& handle,
@@ -1111,8 +1349,191 @@ void sssp(raft::handle_t const& handle,
           weight_t* distances,
           vertex_t* predecessors,
           vertex_t source_vertex,
-          weight_t cutoff         = std::numeric_limits<weight_t>::max(),
-          bool do_expensive_check = false);
+          weight_t cutoff               = std::numeric_limits<weight_t>::max(),
+          bool do_expensive_check       = false,
+          sssp_method_t method          = sssp_method_t::NEAR_FAR,
+          std::optional<weight_t> delta = std::nullopt,
+          size_t* num_relaxations       = nullptr);
+
+/**
+ * @brief Run single-source shortest-path from multiple sources with a separate distance column per
+ * source.
+ *
+ * In single-GPU, sources are processed in tiles of 64 sharing a single frontier (a vertex is in the
+ * frontier if its distance from any source in the tile has changed), so every adjacency list scan
+ * relaxes the edges for all the sources in the tile with a changed distance. A source stops
+ * contributing work once its distances stop changing. In multi-GPU, the sources are currently
+ * processed one at a time (this requires per-source vertex property values for every edge source).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view. Edge weights should
+ * be non-negative.
+ * @param sources Source vertices. In multi-GPU, every GPU should pass the same source vertices
+ * (sources are not required to be local to this GPU).
+ * @param distances Pointer to the output distance matrix (row-major,
+ * graph_view.local_vertex_partition_range_size() rows and sources.size() columns). The j'th column
+ * of the i'th row stores the distance from sources[j] to the i'th vertex in the local vertex
+ * partition range (std::numeric_limits<weight_t>::max() for unreachable vertices).
+ * @param predecessors Pointer to the output predecessor matrix (same layout as @p distances, a
+ * predecessor on a shortest path or cugraph::invalid_vertex_id<vertex_t>::value) or `nullptr`.
+ * @param cutoff Any vertex farther than @p cutoff from a source will be marked as unreachable from
+ * that source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void multi_source_sssp(raft::handle_t const& handle,
+                       graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                       edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                       raft::device_span<vertex_t const> sources,
+                       weight_t* distances,
+                       vertex_t* predecessors,
+                       weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+                       bool do_expensive_check = false);
+
+/**
+ * @brief Find a shortest (minimum hop count) path between two vertices with bidirectional
+ * breadth-first search.
+ *
+ * Searches grow one frontier from @p source (following the edges of @p graph_view) and one frontier
+ * from @p destination (following the edges of @p reversed_graph_view). Every step advances the side
+ * with the smaller frontier by one level, and the search stops at the first level where the two
+ * searches meet, so only the vertices within about half the s-t distance of either end point are
+ * visited. The path is assembled from the predecessors of the two searches with
+ * extract_bfs_paths().
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param reversed_graph_view Optional graph view object of the graph with every edge of @p
+ * graph_view reversed (e.g. created with transpose_graph() on a copy of the graph). This can be
+ * std::nullopt if @p graph_view is symmetric and is required otherwise. Build it once and reuse it
+ * over the queries.
+ * @param source Source vertex.
+ * @param destination Destination vertex.
+ * @param depth_limit The path is reported as not found if @p destination is more than @p
+ * depth_limit hops away from @p source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple of the number of hops from @p source to @p destination
+ * (std::numeric_limits<vertex_t>::max() if not found) and the vertices of the path from @p source
+ * to @p destination (empty if not found).
+ */
+template <typename vertex_t, typename edge_t>
+std::tuple<vertex_t, rmm::device_uvector<vertex_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  vertex_t source,
+  vertex_t destination,
+  vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Find a shortest path between two vertices with bidirectional Dijkstra-style search.
+ *
+ * Both searches use the Near-Far method of sssp(), the forward search from @p source on @p
+ * graph_view and the backward search from @p destination on @p reversed_graph_view. Every step
+ * relaxes the near pile of the side with fewer pending (near or far) vertices. The searches keep
+ * the length mu of the shortest path found so far (the minimum of forward distance + backward
+ * distance over the vertices reached by both) and stop once the sum of the smallest pending
+ * forward distance and the smallest pending backward distance is no smaller than mu (the standard
+ * bidirectional Dijkstra stopping criterion). The path is assembled from the predecessors of the
+ * two searches with extract_bfs_paths().
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view. Edge weights should
+ * be non-negative.
+ * @param reversed_graph_view Optional graph view object of the graph with every edge of @p
+ * graph_view reversed (see bidirectional_bfs()). This can be std::nullopt if @p graph_view is
+ * symmetric and is required otherwise.
+ * @param reversed_edge_weight_view Optional view object holding edge weights for @p
+ * reversed_graph_view. Should be valid if and only if @p reversed_graph_view is valid.
+ * @param source Source vertex.
+ * @param destination Destination vertex.
+ * @param cutoff The path is reported as not found if the distance from @p source to @p destination
+ * is not smaller than @p cutoff.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple of the distance from @p source to @p destination
+ * (std::numeric_limits<weight_t>::max() if not found) and the vertices of the path from @p source
+ * to @p destination (empty if not found).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> reversed_edge_weight_view,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Find a shortest path between two vertices with goal-directed (A*) search.
+ *
+ * This is the Near-Far method of sssp() with the piles ordered by (distance from @p source) +
+ * (heuristic value) instead of the distance, so the search is steered toward @p destination and
+ * the vertices whose heuristic lower bound rules out a path shorter than the best path found so
+ * far are never expanded. With a zero heuristic, this is a Near-Far sssp() that stops once @p
+ * destination is settled. The path is assembled from the predecessors with extract_bfs_paths().
+ *
+ * The heuristic value of a vertex should be a lower bound of the distance from the vertex to @p
+ * destination (std::numeric_limits<weight_t>::max() if the vertex cannot reach @p destination),
+ * e.g. the straight-line distance divided by the maximum speed in a road network. Consistency is
+ * not required (a vertex whose distance improves after expansion is expanded again). See the
+ * overload in distance_oracle.hpp for a landmark based heuristic.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view. Edge weights should
+ * be non-negative.
+ * @param heuristic_values Heuristic values of the vertices (size should coincide with the number
+ * of vertices).
+ * @param source Source vertex.
+ * @param destination Destination vertex.
+ * @param cutoff The path is reported as not found if the distance from @p source to @p destination
+ * is not smaller than @p cutoff.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple of the distance from @p source to @p destination
+ * (std::numeric_limits<weight_t>::max() if not found) and the vertices of the path from @p source
+ * to @p destination (empty if not found).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<weight_t const> heuristic_values,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
 
 /**
  * @brief Compute PageRank scores.
@@ -1172,6 +1593,177 @@ void pagerank(raft::handle_t const& handle,
               bool has_initial_guess  = false,
               bool do_expensive_check = false);
 
+/**
+ * @brief Compute personalized PageRank scores for a batch of personalization sets.
+ *
+ * This is equivalent to calling pagerank() once per personalization set, but the score vectors are
+ * iterated together: every iteration sweeps the edges once per block of (up to) 8 score vectors
+ * (instead of once per score vector). Convergence is tracked per personalization set, a converged
+ * score vector is dropped from the following iterations (and the remaining score vectors are
+ * re-packed to the blocks).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if any personalization set fails to
+ * converge before @p max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt` (see pagerank()).
+ * @param personalization_offsets Offsets of the personalization sets (size k + 1 for k sets) in @p
+ * personalization_vertices and @p personalization_values (CSR-like, the i'th set is stored in
+ * [personalization_offsets[i], personalization_offsets[i + 1])). In multi-GPU, every GPU should
+ * provide the same number of sets, each holding the local vertices of the set.
+ * @param personalization_vertices Personalization vertex identifiers (no duplicates within a set).
+ * Every set should be non-empty (aggregated over the GPUs in multi-GPU).
+ * @param personalization_values Optional personalization values for @p personalization_vertices.
+ * If std::nullopt, every vertex in a set has the same weight.
+ * @param pageranks Pointer to the output PageRank score array (size k * (local vertex partition
+ * range size)). The scores for the i'th set are stored in [pageranks + i * (local vertex
+ * partition range size), pageranks + (i + 1) * (local vertex partition range size)).
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence (per personalization set, see pagerank()).
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<vertex_t const> personalization_vertices,
+  std::optional<raft::device_span<result_t const>> personalization_values,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Approximate personalized PageRank scores for a single seed vertex by local pushes.
+ *
+ * This function implements the push algorithm in R. Andersen, F. Chung, and K. Lang, "Local graph
+ * partitioning using PageRank vectors," 2006. Every vertex holds an estimate and a residual; the
+ * seed starts with residual 1.0. Every round, the vertices with residual r(v) >= @p epsilon * d(v)
+ * (d(v) is the sum of the out-going edge weights of v, 1.0 is used for vertices without out-going
+ * edges) move (1.0 - @p alpha) * r(v) to their estimates and spread @p alpha * r(v) to their
+ * out-neighbors (proportionally to the edge weights, or back to the seed if v has no out-going
+ * edge, this mirrors the dangling vertex handling in pagerank()). The rounds stop when no vertex
+ * exceeds the threshold; the estimates then approximate the personalized PageRank scores
+ * (pagerank() with @p seed as the only personalization vertex), for symmetric graphs, the error of
+ * every vertex v is bounded by @p epsilon * d(v). Every push moves at least (1.0 - @p alpha) *
+ * @p epsilon * d(v) to the estimates, so the number of edge visits (for unweighted graphs) is
+ * bounded by 1 / ((1.0 - @p alpha) * @p epsilon) independent of the graph size.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`. If `std::nullopt`, these values are
+ * freshly computed (this visits every edge, pass the sums to amortize the cost over queries).
+ * @param seed Seed (personalization) vertex. In multi-GPU, every GPU should pass the same value.
+ * @param alpha PageRank damping factor (should be smaller than 1.0).
+ * @param epsilon Residual threshold (per unit out-going edge weight, should be positive).
+ * @return Tuple of the vertices with non-zero estimates and their estimated scores (the vertices
+ * are sorted and are local to this GPU in multi-GPU).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<result_t>>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t seed,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Update PageRank scores after a batch of edge insertions and deletions.
+ *
+ * @p pageranks holds the PageRank scores (see pagerank(), without personalization) of the graph
+ * before the update and @p graph_view is the graph after the update (the vertex set should be
+ * unchanged). The previous scores are corrected by pushing residuals (the difference between the
+ * two sides of the PageRank equation under the updated graph) instead of iterating over every
+ * vertex. Initially, the residuals are non-zero only for the out-neighbors of the sources of the
+ * updated edges; the vertices whose residual magnitude reaches (1.0 - @p alpha) * @p epsilon / (2
+ * * V) (V is the number of vertices) absorb their residuals and push @p alpha times the residuals
+ * to their out-neighbors, so the work is proportional to the impact of the update and not to the
+ * graph size. A change in the sum of the scores of the vertices without out-going edges (which
+ * spreads to every vertex) is accumulated separately and is pushed to every vertex only once the
+ * accumulated change becomes large enough to matter.
+ *
+ * This function assumes that @p pageranks are converged scores of the graph before the update (the
+ * updated scores are only as accurate as the previous scores); the update adds at most @p epsilon
+ * to the L1 error.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the updated graph.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices of the updated graph (for re-use) or `std::nullopt`. If `std::nullopt`,
+ * these values are freshly computed (this visits every edge).
+ * @param inserted_edge_srcs Source vertex IDs of the inserted edges.
+ * @param inserted_edge_dsts Destination vertex IDs of the inserted edges.
+ * @param inserted_edge_weights Weights of the inserted edges (should be valid if and only if @p
+ * edge_weight_view.has_value() == true).
+ * @param deleted_edge_srcs Source vertex IDs of the deleted edges.
+ * @param deleted_edge_dsts Destination vertex IDs of the deleted edges.
+ * @param deleted_edge_weights Weights of the deleted edges (should be valid if and only if @p
+ * edge_weight_view.has_value() == true). A weight change can be expressed as a deletion followed
+ * by an insertion.
+ * @param pageranks Pointer to the PageRank score array (size V), the scores of the graph before the
+ * update on input and the scores of the updated graph on output.
+ * @param alpha PageRank damping factor (should be smaller than 1.0).
+ * @param epsilon Error tolerance (should be positive, bounds the L1 error added by the update).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<vertex_t const> inserted_edge_srcs,
+  raft::device_span<vertex_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> inserted_edge_weights,
+  raft::device_span<vertex_t const> deleted_edge_srcs,
+  raft::device_span<vertex_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> deleted_edge_weights,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check = false);
+
 /**
  * @brief Compute Eigenvector Centrality scores.
  *
@@ -1945,6 +2537,45 @@ std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> k_hop_nbr
   size_t k,
   bool do_expensive_check = false);
 
+/*
+ * @brief Estimate the K-hop neighborhood sizes (approximate neighborhood function)
+ *
+ * Unlike k_hop_nbrs, this does not enumerate the neighbors. Every vertex keeps a HyperLogLog
+ * sketch (2^@p log2_num_registers one byte registers) of the set of vertices within t hops, and the
+ * sketches of iteration t + 1 are the unions (register-wise maxima) of the sketch of the vertex and
+ * the sketches of its outgoing neighbors in iteration t (HyperANF, Boldi et al., 2011). This takes
+ * O(V * 2^@p log2_num_registers) memory and K passes over the edges (per 16 registers) regardless
+ * of the neighborhood sizes. Iterations stop early if no sketch changes. The relative standard
+ * error of an estimate is about 1.04 / sqrt(2^@p log2_num_registers).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param k Number of hops.
+ * @param log2_num_registers Base 2 logarithm of the number of HyperLogLog registers per vertex
+ * (should be in [4, 16]).
+ * @param effective_diameter_quantile Fraction of the reachable pairs within the effective diameter
+ * (should be in (0.0, 1.0]).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the estimated numbers of vertices within @p k hops (including the vertex
+ * itself) of the vertices in the local vertex partition range, the estimated neighborhood function
+ * (the i'th element is the estimated number of (u, v) pairs with v within i hops of u, i in [0, @p
+ * k]), and the estimated effective diameter (the interpolated number of hops within which @p
+ * effective_diameter_quantile of the pairs counted in the neighborhood function of @p k hops are;
+ * this is the effective diameter of the graph if @p k is no smaller than the diameter).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, std::vector<double>, double> approximate_k_hop_nbr_counts(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t k,
+  size_t log2_num_registers          = 6,
+  double effective_diameter_quantile = 0.9,
+  bool do_expensive_check            = false);
+
 }  // namespace cugraph
 
 /**
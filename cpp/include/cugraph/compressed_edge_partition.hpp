@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_partition_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// LEB128: 7 bits per byte (least significant group first), the most significant bit of a byte is
+// set if more bytes follow
+inline void append_varint(std::vector<uint8_t>& bytes, uint64_t value)
+{
+  while (value >= 0x80) {
+    bytes.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  bytes.push_back(static_cast<uint8_t>(value));
+}
+
+inline uint64_t decode_varint(uint8_t const*& ptr)
+{
+  uint64_t value = *ptr++;
+  if (value < 0x80) { return value; }  // fast path for small gaps
+  value &= 0x7f;
+  for (int shift = 7;; shift += 7) {
+    uint64_t byte = *ptr++;
+    value |= (byte & 0x7f) << shift;
+    if (byte < 0x80) { break; }
+  }
+  return value;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Host-side compressed representation of an edge partition's adjacency lists.
+ *
+ * Each major's (sorted) minors are gap-encoded: the first minor is stored as the distance from
+ * minor_range_first and every following minor as the distance from the previous minor, and the gaps
+ * are stored with a byte-aligned variable length (LEB128) codec. As neighbors of a vertex have
+ * nearby IDs after renumbering, most gaps fit in one or two bytes and this takes a fraction of the
+ * memory required to store the raw indices (especially with 64 bit vertex IDs). Neighbor lists are
+ * decoded on-the-fly while iterating.
+ *
+ * The (edge) offsets are kept as-is, so the edge offset of a neighbor (to access edge property
+ * values) is local_offset(major_idx) + (the neighbor's position in the neighbor list).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ */
+template <typename vertex_t, typename edge_t>
+class compressed_edge_partition_t {
+ public:
+  // input iterator decoding a neighbor list on-the-fly
+  class neighbor_iterator_t {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = vertex_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = vertex_t const*;
+    using reference         = vertex_t;
+
+    neighbor_iterator_t() = default;
+
+    neighbor_iterator_t(uint8_t const* ptr, edge_t remaining, vertex_t minor_range_first)
+      : ptr_(ptr), remaining_(remaining), minor_(minor_range_first)
+    {
+      if (remaining_ > 0) { minor_ += static_cast<vertex_t>(detail::decode_varint(ptr_)); }
+    }
+
+    vertex_t operator*() const { return minor_; }
+
+    neighbor_iterator_t& operator++()
+    {
+      --remaining_;
+      if (remaining_ > 0) { minor_ += static_cast<vertex_t>(detail::decode_varint(ptr_)); }
+      return *this;
+    }
+
+    bool operator==(neighbor_iterator_t const& other) const
+    {
+      return remaining_ == other.remaining_;
+    }
+    bool operator!=(neighbor_iterator_t const& other) const { return !(*this == other); }
+
+   private:
+    uint8_t const* ptr_{nullptr};
+    edge_t remaining_{0};
+    vertex_t minor_{0};
+  };
+
+  class neighbor_range_t {
+   public:
+    neighbor_range_t(uint8_t const* ptr, edge_t degree, vertex_t minor_range_first)
+      : ptr_(ptr), degree_(degree), minor_range_first_(minor_range_first)
+    {
+    }
+
+    neighbor_iterator_t begin() const
+    {
+      return neighbor_iterator_t(ptr_, degree_, minor_range_first_);
+    }
+    neighbor_iterator_t end() const { return neighbor_iterator_t(nullptr, edge_t{0}, vertex_t{0}); }
+
+    edge_t size() const { return degree_; }
+
+   private:
+    uint8_t const* ptr_{nullptr};
+    edge_t degree_{0};
+    vertex_t minor_range_first_{0};
+  };
+
+  /**
+   * @brief Compress the adjacency lists of an edge partition.
+   *
+   * @param offsets Host span of the edge partition offsets (size = # majors + 1).
+   * @param indices Host span of the edge partition indices (minors), minors should be sorted for
+   * each major.
+   * @param minor_range_first The first minor vertex ID of the edge partition.
+   */
+  compressed_edge_partition_t(raft::host_span<edge_t const> offsets,
+                              raft::host_span<vertex_t const> indices,
+                              vertex_t minor_range_first = vertex_t{0})
+    : offsets_(offsets.begin(), offsets.end()),
+      byte_offsets_(offsets.size(), size_t{0}),
+      minor_range_first_(minor_range_first)
+  {
+    CUGRAPH_EXPECTS(offsets.size() > 0, "Invalid input argument: offsets should not be empty.");
+    CUGRAPH_EXPECTS(static_cast<size_t>(offsets[offsets.size() - 1]) == indices.size(),
+                    "Invalid input argument: offsets and indices size mismatch.");
+
+    bytes_.reserve(indices.size() * 2);
+    for (size_t i = 0; i < offsets.size() - 1; ++i) {
+      byte_offsets_[i] = bytes_.size();
+      auto prev        = minor_range_first;
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+        CUGRAPH_EXPECTS(indices[j] >= prev,
+                        "Invalid input argument: minors should be sorted for each major and "
+                        "should not be smaller than minor_range_first.");
+        detail::append_varint(bytes_, static_cast<uint64_t>(indices[j] - prev));
+        prev = indices[j];
+      }
+    }
+    byte_offsets_.back() = bytes_.size();
+    bytes_.shrink_to_fit();
+  }
+
+  size_t number_of_majors() const { return offsets_.size() - 1; }
+
+  edge_t number_of_edges() const { return offsets_.back(); }
+
+  // major_idx is the index to the offsets array (e.g. major - major_range_first for the majors
+  // below major_hypersparse_first)
+  edge_t local_offset(size_t major_idx) const { return offsets_[major_idx]; }
+
+  edge_t local_degree(size_t major_idx) const
+  {
+    return offsets_[major_idx + 1] - offsets_[major_idx];
+  }
+
+  neighbor_range_t neighbors(size_t major_idx) const
+  {
+    return neighbor_range_t(
+      bytes_.data() + byte_offsets_[major_idx], local_degree(major_idx), minor_range_first_);
+  }
+
+  // memory footprint of the compressed indices (encoded gaps + byte offsets per major), compare
+  // with number_of_edges() * sizeof(vertex_t)
+  size_t compressed_indices_size_in_bytes() const
+  {
+    return bytes_.size() * sizeof(uint8_t) + byte_offsets_.size() * sizeof(size_t);
+  }
+
+ private:
+  std::vector<edge_t> offsets_{};
+  std::vector<size_t> byte_offsets_{};
+  std::vector<uint8_t> bytes_{};
+  vertex_t minor_range_first_{0};
+};
+
+/**
+ * @brief Copy an edge partition to the host and compress its adjacency lists.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param edge_partition Edge partition view object of the edge partition to compress.
+ * @return compressed_edge_partition_t object holding the compressed adjacency lists.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+compressed_edge_partition_t<vertex_t, edge_t> compress_edge_partition(
+  raft::handle_t const& handle, edge_partition_view_t<vertex_t, edge_t, multi_gpu> edge_partition)
+{
+  std::vector<edge_t> h_offsets(edge_partition.offsets().size());
+  std::vector<vertex_t> h_indices(edge_partition.indices().size());
+  raft::update_host(
+    h_offsets.data(), edge_partition.offsets().data(), h_offsets.size(), handle.get_stream());
+  raft::update_host(
+    h_indices.data(), edge_partition.indices().data(), h_indices.size(), handle.get_stream());
+  handle.sync_stream();
+
+  return compressed_edge_partition_t<vertex_t, edge_t>(
+    raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+    raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+    edge_partition.minor_range_first());
+}
+
+}  // namespace cugraph
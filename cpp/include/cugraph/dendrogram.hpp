@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,13 +15,34 @@
  */
 #pragma once
 
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/util/cudart_utils.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace cugraph {
 
+/**
+ * @brief Hierarchical clustering (one cluster assignment per level) returned by Louvain/Leiden.
+ *
+ * By default every level is kept in device memory. If level spilling is enabled (see
+ * spill_levels_to_file()), a level is appended to a binary file when the next level is added (the
+ * level is complete by then) and its device memory is released; spilled levels are read back only
+ * when needed (e.g. partition_at_level() reads the levels below the requested depth one at a time).
+ *
+ * A dendrogram file starts with a 16 byte header (magic, version, and sizeof(vertex_t)) followed
+ * by one record per level (the first index (int64_t), the level size (uint64_t), and the level
+ * values). Multi-byte values are stored in the host byte order. In multi-GPU, every GPU spills its
+ * local levels to its own file.
+ */
 template <typename vertex_t>
 class Dendrogram {
  public:
@@ -30,20 +51,33 @@ class Dendrogram {
                  rmm::cuda_stream_view stream_view,
                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
   {
+    if (file_path_ && (level_ptr_.size() > 0)) {  // the current level is complete
+      save_level(current_level(), stream_view);
+      level_ptr_[current_level()].reset();
+    }
     level_ptr_.push_back(
       std::make_unique<rmm::device_uvector<vertex_t>>(num_verts, stream_view, mr));
     level_first_index_.push_back(first_index);
+    level_size_.push_back(static_cast<size_t>(num_verts));
+    level_file_offset_.push_back(std::nullopt);
   }
 
   size_t current_level() const { return level_ptr_.size() - 1; }
 
   size_t num_levels() const { return level_ptr_.size(); }
 
-  vertex_t const* get_level_ptr_nocheck(size_t level) const { return level_ptr_[level]->data(); }
+  // nullptr if the level is spilled to the file and not loaded
+  vertex_t const* get_level_ptr_nocheck(size_t level) const
+  {
+    return level_ptr_[level] ? level_ptr_[level]->data() : nullptr;
+  }
 
-  vertex_t* get_level_ptr_nocheck(size_t level) { return level_ptr_[level]->data(); }
+  vertex_t* get_level_ptr_nocheck(size_t level)
+  {
+    return level_ptr_[level] ? level_ptr_[level]->data() : nullptr;
+  }
 
-  size_t get_level_size_nocheck(size_t level) const { return level_ptr_[level]->size(); }
+  size_t get_level_size_nocheck(size_t level) const { return level_size_[level]; }
 
   vertex_t get_level_first_index_nocheck(size_t level) const { return level_first_index_[level]; }
 
@@ -62,9 +96,166 @@ class Dendrogram {
     return get_level_first_index_nocheck(current_level());
   }
 
+  /**
+   * @brief Spill the completed levels to a dendrogram file (an existing file is overwritten).
+   *
+   * Should be called before adding the first level. Every level is written to the file when the
+   * next level is added; call flush() to write the remaining (current) level as well.
+   *
+   * @param file_path Path to the dendrogram file to create.
+   */
+  void spill_levels_to_file(std::string const& file_path)
+  {
+    CUGRAPH_EXPECTS(
+      level_ptr_.size() == 0,
+      "Invalid input argument: level spilling should be enabled before adding levels.");
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    CUGRAPH_EXPECTS(file.is_open(), "open (%s) failure.", file_path.c_str());
+    uint32_t header[4]{};
+    std::memcpy(header, file_magic, sizeof(uint64_t));
+    header[2] = file_version;
+    header[3] = static_cast<uint32_t>(sizeof(vertex_t));
+    file.write(reinterpret_cast<char const*>(header), sizeof(header));
+    CUGRAPH_EXPECTS(file.good(), "write (%s) failure.", file_path.c_str());
+    file_path_ = file_path;
+    file_size_ = sizeof(header);
+  }
+
+  /**
+   * @brief Open a dendrogram file written by a spilling dendrogram, no level is loaded.
+   *
+   * @param file_path Path to the dendrogram file.
+   * @return Dendrogram with every level spilled (levels are read on demand).
+   */
+  static std::unique_ptr<Dendrogram> open_file(std::string const& file_path)
+  {
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+    CUGRAPH_EXPECTS(file.is_open(), "open (%s) failure.", file_path.c_str());
+    auto file_size = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+    uint32_t header[4]{};
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    CUGRAPH_EXPECTS(file.good() && (std::memcmp(header, file_magic, sizeof(uint64_t)) == 0),
+                    "Invalid input argument: %s is not a dendrogram file.",
+                    file_path.c_str());
+    CUGRAPH_EXPECTS(header[2] == file_version, "Unsupported dendrogram file version.");
+    CUGRAPH_EXPECTS(header[3] == sizeof(vertex_t),
+                    "Invalid template parameter: vertex_t does not match with the file.");
+
+    auto ret        = std::make_unique<Dendrogram>();
+    ret->file_path_ = file_path;
+    ret->file_size_ = sizeof(header);
+    while (ret->file_size_ < file_size) {
+      int64_t record_header[2]{};
+      file.read(reinterpret_cast<char*>(record_header), sizeof(record_header));
+      CUGRAPH_EXPECTS(file.good() && (record_header[1] >= 0),
+                      "Invalid dendrogram file contents (truncated level header).");
+      auto size = static_cast<size_t>(record_header[1]);
+      ret->level_ptr_.push_back(nullptr);
+      ret->level_first_index_.push_back(static_cast<vertex_t>(record_header[0]));
+      ret->level_size_.push_back(size);
+      ret->level_file_offset_.push_back(ret->file_size_ + sizeof(record_header));
+      ret->file_size_ += sizeof(record_header) + size * sizeof(vertex_t);
+      CUGRAPH_EXPECTS(ret->file_size_ <= file_size,
+                      "Invalid dendrogram file contents (truncated level).");
+      file.seekg(ret->file_size_);
+    }
+    return ret;
+  }
+
+  // write the levels not written yet (including the current level) to the file, the levels stay
+  // in device memory
+  void flush(rmm::cuda_stream_view stream_view)
+  {
+    CUGRAPH_EXPECTS(file_path_.has_value(), "Level spilling is not enabled.");
+    for (size_t level = 0; level < level_ptr_.size(); ++level) {
+      if (!level_file_offset_[level]) { save_level(level, stream_view); }
+    }
+  }
+
+  bool is_level_resident(size_t level) const { return level_ptr_[level] != nullptr; }
+
+  /**
+   * @brief Read a level into a new device vector (the dendrogram is not modified).
+   *
+   * @param level Level to read.
+   * @param stream_view Stream to copy the level on (synchronized before returning if the level is
+   * read from the file).
+   * @param mr Device memory resource to allocate the returned vector.
+   * @return Device copy of the level.
+   */
+  rmm::device_uvector<vertex_t> read_level(
+    size_t level,
+    rmm::cuda_stream_view stream_view,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const
+  {
+    rmm::device_uvector<vertex_t> ret(level_size_[level], stream_view, mr);
+    if (level_ptr_[level]) {
+      raft::copy(ret.data(), level_ptr_[level]->data(), ret.size(), stream_view);
+    } else {
+      CUGRAPH_EXPECTS(level_file_offset_[level].has_value(),
+                      "Level is neither resident nor saved.");
+      std::ifstream file(*file_path_, std::ios::binary);
+      CUGRAPH_EXPECTS(file.is_open(), "open (%s) failure.", file_path_->c_str());
+      std::vector<vertex_t> h_level(ret.size());
+      file.seekg(*(level_file_offset_[level]));
+      file.read(reinterpret_cast<char*>(h_level.data()), h_level.size() * sizeof(vertex_t));
+      CUGRAPH_EXPECTS(file.good(), "read (%s) failure.", file_path_->c_str());
+      raft::update_device(ret.data(), h_level.data(), h_level.size(), stream_view);
+      stream_view.synchronize();  // h_level goes out of scope
+    }
+    return ret;
+  }
+
+  // make a spilled level resident
+  void load_level(size_t level,
+                  rmm::cuda_stream_view stream_view,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+  {
+    if (!level_ptr_[level]) {
+      level_ptr_[level] =
+        std::make_unique<rmm::device_uvector<vertex_t>>(read_level(level, stream_view, mr));
+    }
+  }
+
+  // release the device memory of a level, the level should be saved (see flush())
+  void release_level(size_t level)
+  {
+    CUGRAPH_EXPECTS(level_file_offset_[level].has_value(),
+                    "Invalid input argument: only a saved level can be released.");
+    level_ptr_[level].reset();
+  }
+
  private:
+  static constexpr char file_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'D'};
+  static constexpr uint32_t file_version{1};
+
+  void save_level(size_t level, rmm::cuda_stream_view stream_view)
+  {
+    std::vector<vertex_t> h_level(level_size_[level]);
+    raft::update_host(h_level.data(), level_ptr_[level]->data(), h_level.size(), stream_view);
+    stream_view.synchronize();
+
+    std::ofstream file(*file_path_, std::ios::binary | std::ios::app);
+    CUGRAPH_EXPECTS(file.is_open(), "open (%s) failure.", file_path_->c_str());
+    int64_t record_header[2] = {static_cast<int64_t>(level_first_index_[level]),
+                                static_cast<int64_t>(h_level.size())};
+    file.write(reinterpret_cast<char const*>(record_header), sizeof(record_header));
+    file.write(reinterpret_cast<char const*>(h_level.data()), h_level.size() * sizeof(vertex_t));
+    CUGRAPH_EXPECTS(file.good(), "write (%s) failure.", file_path_->c_str());
+
+    level_file_offset_[level] = file_size_ + sizeof(record_header);
+    file_size_ += sizeof(record_header) + h_level.size() * sizeof(vertex_t);
+  }
+
   std::vector<vertex_t> level_first_index_;
   std::vector<std::unique_ptr<rmm::device_uvector<vertex_t>>> level_ptr_;
+  std::vector<size_t> level_size_;
+
+  // level spilling
+  std::optional<std::string> file_path_{std::nullopt};
+  size_t file_size_{0};
+  std::vector<std::optional<size_t>> level_file_offset_;
 };
 
 }  // namespace cugraph
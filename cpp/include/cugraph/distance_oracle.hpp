@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace cugraph {
+
+enum class landmark_selection_t : uint32_t {
+  HIGHEST_DEGREE = 0,  // vertices with the largest (in + out) degrees
+  RANDOM               // uniformly random vertices (select_random_vertices)
+};
+
+/**
+ * @brief Landmark distance index of a (single-GPU) graph.
+ *
+ * Stores the distances between every vertex and a small set of landmark vertices. The distances
+ * of a vertex are stored contiguously (row-major [number_of_vertices x landmarks.size()] tables),
+ * so a query reads one row per query end point.
+ *
+ * Distances are shortest-path distances if the index was built with edge weights and hop counts
+ * otherwise (stored as weight_t in both cases); std::numeric_limits<weight_t>::max() marks an
+ * unreachable (vertex, landmark) pair.
+ *
+ * @tparam vertex_t Type of vertex identifiers.
+ * @tparam weight_t Type of distances.
+ */
+template <typename vertex_t, typename weight_t>
+struct landmark_distance_index_t {
+  vertex_t number_of_vertices{0};
+  bool is_symmetric{false};  // if true, distances to and from a landmark coincide
+  rmm::device_uvector<vertex_t> landmarks;
+  rmm::device_uvector<weight_t> distances_from_landmarks;  // row v, column j: d(landmarks[j], v)
+  // row v, column j: d(v, landmarks[j]), std::nullopt if is_symmetric or not computed
+  std::optional<rmm::device_uvector<weight_t>> distances_to_landmarks;
+};
+
+/**
+ * @brief Build a landmark distance index.
+ *
+ * Landmarks are selected by @p selection and the distances from the landmarks are computed with
+ * multi_source_sssp() (weighted) or multi_source_bfs() (unweighted), both of which process 64
+ * landmarks with a single shared frontier. If @p bidirectional is true and the graph is not
+ * symmetric, the distances to the landmarks are computed as well (by running the same traversal on
+ * the reversed graph); these tighten the bounds returned by landmark_distance_bounds() and are
+ * required for finite upper bounds on a directed graph.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view (should be
+ * non-negative). If std::nullopt, every edge has a unit length.
+ * @param num_landmarks Number of landmarks (should not exceed the number of vertices).
+ * @param selection Landmark selection strategy.
+ * @param rng_state Random number generator state (used only if @p selection is
+ * landmark_selection_t::RANDOM).
+ * @param bidirectional Flag to store the distances to the landmarks as well (ignored for symmetric
+ * graphs).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Landmark distance index.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+landmark_distance_index_t<vertex_t, weight_t> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional      = true,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Bound the distances of (source, destination) pairs with the triangle inequality.
+ *
+ * For every landmark l, d(s, t) >= d(l, t) - d(l, s) and d(s, t) >= d(s, l) - d(t, l) (the latter
+ * requires the distances to the landmarks), and d(s, t) <= d(s, l) + d(l, t). The tightest bounds
+ * over the landmarks are returned. A pair is reported as unreachable (both bounds are
+ * std::numeric_limits<weight_t>::max()) if a landmark reaches s but not t or t reaches a landmark
+ * that s does not reach. The bounds coincide for the pairs with a shortest path through a
+ * landmark.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of distances.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param index Landmark distance index.
+ * @param srcs Query source vertices.
+ * @param dsts Query destination vertices (size should coincide with @p srcs).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the lower bounds and the upper bounds (std::numeric_limits<weight_t>::max() if
+ * unknown) of the query distances.
+ */
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<weight_t>, rmm::device_uvector<weight_t>> landmark_distance_bounds(
+  raft::handle_t const& handle,
+  landmark_distance_index_t<vertex_t, weight_t> const& index,
+  raft::device_span<vertex_t const> srcs,
+  raft::device_span<vertex_t const> dsts,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Save a landmark distance index to a binary file.
+ *
+ * The file stores a versioned header (the type sizes, the number of vertices and landmarks, and
+ * the flags) followed by the landmarks and the distance tables, each starting at a 64 byte
+ * boundary. Multi-byte values are stored in the host byte order.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of distances.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param index Landmark distance index to save.
+ * @param file_path Path to the file to create (overwritten if exists).
+ */
+template <typename vertex_t, typename weight_t>
+void save_landmark_distance_index(raft::handle_t const& handle,
+                                  landmark_distance_index_t<vertex_t, weight_t> const& index,
+                                  std::string const& file_path);
+
+/**
+ * @brief Load a landmark distance index saved by save_landmark_distance_index().
+ *
+ * @throws cugraph::logic_error if the file is not a landmark distance index file or the type
+ * sizes do not match.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Should match with the vertex_t used in saving.
+ * @tparam weight_t Type of distances. Should match with the weight_t used in saving.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the landmark distance index file.
+ * @return Landmark distance index.
+ */
+template <typename vertex_t, typename weight_t>
+landmark_distance_index_t<vertex_t, weight_t> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path);
+
+/**
+ * @brief Find a shortest path between two vertices with A* search guided by a landmark distance
+ * index (the ALT heuristic).
+ *
+ * Identical to astar() in algorithms.hpp except that the heuristic value of a vertex v is the
+ * landmark lower bound of d(v, destination) (see landmark_distance_bounds()), evaluated only for
+ * the vertices the search reaches. The bound is tighter if @p index stores the distances to the
+ * landmarks as well.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view. Edge weights should
+ * be non-negative.
+ * @param index Landmark distance index of @p graph_view built with @p edge_weight_view (an index
+ * built with hop counts does not bound weighted distances).
+ * @param source Source vertex.
+ * @param destination Destination vertex.
+ * @param cutoff The path is reported as not found if the distance from @p source to @p destination
+ * is not smaller than @p cutoff.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple of the distance from @p source to @p destination
+ * (std::numeric_limits<weight_t>::max() if not found) and the vertices of the path from @p source
+ * to @p destination (empty if not found).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  landmark_distance_index_t<vertex_t, weight_t> const& index,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
+
+}  // namespace cugraph
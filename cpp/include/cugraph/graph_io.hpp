@@ -0,0 +1,579 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Read-only host view of a graph snapshot file written by save_graph().
+ *
+ * A graph snapshot stores the compressed sparse (CSR/CSC, and DCSR/DCSC for the hypersparse
+ * segments in multi-GPU) representation of the local edge partitions of a graph as-is (i.e. the
+ * output of create_graph_from_edgelist after renumbering, sorting, and compression), so a graph
+ * can be re-created without repeating those steps. The file is memory-mapped on construction and
+ * the accessors return host spans pointing to the mapped file contents (no parsing or copying
+ * takes place); the spans are valid as long as this object is alive.
+ *
+ * The file starts with a versioned header (storing the type sizes and the graph meta-data)
+ * followed by a table of sections, every section is aligned to 64 bytes. Multi-byte values are
+ * stored in the host byte order.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Should match with the vertex_t used in saving the
+ * snapshot.
+ * @tparam edge_t Type of edge identifiers. Should match with the edge_t used in saving the
+ * snapshot.
+ * @tparam weight_t Type of edge weights. Should match with the weight_t used in saving the
+ * snapshot (ignored if the snapshot does not store edge weights).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class graph_snapshot_t {
+ public:
+  /**
+   * @brief Memory-map a graph snapshot file and validate its header.
+   *
+   * @param file_path Path to the graph snapshot file.
+   */
+  explicit graph_snapshot_t(std::string const& file_path);
+
+  graph_snapshot_t(graph_snapshot_t const&) = delete;
+  graph_snapshot_t& operator=(graph_snapshot_t const&) = delete;
+
+  graph_snapshot_t(graph_snapshot_t&& other) noexcept;
+  graph_snapshot_t& operator=(graph_snapshot_t&& other) noexcept;
+
+  ~graph_snapshot_t();
+
+  bool is_storage_transposed() const { return store_transposed_; }
+  bool is_multi_gpu() const { return multi_gpu_; }
+
+  graph_properties_t properties() const { return properties_; }
+
+  vertex_t number_of_vertices() const { return number_of_vertices_; }
+  edge_t number_of_edges() const { return number_of_edges_; }
+
+  // graph sub-communicator sizes and ranks of the GPU that saved this snapshot (1, 1, 0, 0 for
+  // single-GPU)
+  int major_comm_size() const { return major_comm_size_; }
+  int minor_comm_size() const { return minor_comm_size_; }
+  int major_comm_rank() const { return major_comm_rank_; }
+  int minor_comm_rank() const { return minor_comm_rank_; }
+
+  raft::host_span<vertex_t const> vertex_partition_range_offsets() const
+  {
+    return vertex_partition_range_offsets_;
+  }
+
+  size_t number_of_local_edge_partitions() const { return edge_partition_offsets_.size(); }
+
+  raft::host_span<edge_t const> edge_partition_offsets(size_t partition_idx) const
+  {
+    return edge_partition_offsets_[partition_idx];
+  }
+
+  raft::host_span<vertex_t const> edge_partition_indices(size_t partition_idx) const
+  {
+    return edge_partition_indices_[partition_idx];
+  }
+
+  std::optional<raft::host_span<vertex_t const>> edge_partition_dcs_nzd_vertices(
+    size_t partition_idx) const
+  {
+    return edge_partition_dcs_nzd_vertices_
+             ? std::make_optional((*edge_partition_dcs_nzd_vertices_)[partition_idx])
+             : std::nullopt;
+  }
+
+  std::optional<raft::host_span<weight_t const>> edge_partition_weights(
+    size_t partition_idx) const
+  {
+    return edge_partition_weights_
+             ? std::make_optional((*edge_partition_weights_)[partition_idx])
+             : std::nullopt;
+  }
+
+  // segment offsets of every local edge partition (concatenated in the edge partition order)
+  std::optional<raft::host_span<vertex_t const>> edge_partition_segment_offsets() const
+  {
+    return edge_partition_segment_offsets_;
+  }
+
+  // renumber map of the local vertex partition range
+  std::optional<raft::host_span<vertex_t const>> renumber_map() const { return renumber_map_; }
+
+ private:
+  void unmap();
+
+  void const* data_{nullptr};
+  size_t size_{0};
+
+  bool store_transposed_{false};
+  bool multi_gpu_{false};
+  graph_properties_t properties_{};
+  vertex_t number_of_vertices_{0};
+  edge_t number_of_edges_{0};
+  int major_comm_size_{1};
+  int minor_comm_size_{1};
+  int major_comm_rank_{0};
+  int minor_comm_rank_{0};
+
+  raft::host_span<vertex_t const> vertex_partition_range_offsets_{};
+  std::vector<raft::host_span<edge_t const>> edge_partition_offsets_{};
+  std::vector<raft::host_span<vertex_t const>> edge_partition_indices_{};
+  std::optional<std::vector<raft::host_span<vertex_t const>>> edge_partition_dcs_nzd_vertices_{
+    std::nullopt};
+  std::optional<std::vector<raft::host_span<weight_t const>>> edge_partition_weights_{
+    std::nullopt};
+  std::optional<raft::host_span<vertex_t const>> edge_partition_segment_offsets_{std::nullopt};
+  std::optional<raft::host_span<vertex_t const>> renumber_map_{std::nullopt};
+};
+
+/**
+ * @brief Save a graph (and optionally edge weights and a renumber map) to a binary snapshot file.
+ *
+ * The snapshot can be re-loaded with load_graph() (or inspected with graph_snapshot_t) without
+ * renumbering, sorting, and compressing the edges again. In multi-GPU, every GPU saves its local
+ * edge partitions to a separate file (so @p file_path should differ for every GPU), and the
+ * snapshot should be re-loaded with the same graph sub-communicator sizes and ranks.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the snapshot file to create (an existing file is overwritten).
+ * @param graph_view Graph view object of the graph to be saved.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param renumber_map Optional renumber map (for the local vertex partition range) to be saved
+ * with the graph.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void save_graph(raft::handle_t const& handle,
+                std::string const& file_path,
+                graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                std::optional<raft::device_span<vertex_t const>> renumber_map);
+
+/**
+ * @brief Load a graph (and the edge weights and the renumber map, if saved) from a binary snapshot
+ * file created by save_graph().
+ *
+ * The file is memory-mapped and the stored compressed sparse arrays are directly copied to the
+ * device.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the snapshot file to load.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the loaded graph, the edge weights (if saved), and the renumber map (if saved).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+load_graph(raft::handle_t const& handle,
+           std::string const& file_path,
+           bool do_expensive_check = false);
+
+/**
+ * @brief Read-only host view of an edge property column file written by save_edge_property().
+ *
+ * An edge property column file stores the values of a single edge property (e.g. edge weights,
+ * edge IDs, or edge types) for the local edge partitions in the edge partition order (i.e. aligned
+ * with the edges of a graph created by create_graph_from_edgelist() or load_graph()), so every
+ * property of a graph can be kept in its own file and attached to the graph only when an algorithm
+ * needs it. The file is memory-mapped on construction and only the header and the section table
+ * are read, the property values are paged in when they are accessed (e.g. by
+ * edge_partition_values() or load_edge_property()). The spans are valid as long as this object is
+ * alive.
+ *
+ * The file uses the same section layout as the graph snapshot file (a versioned header followed by
+ * a table of sections, one per edge partition, aligned to 64 bytes).
+ *
+ * @tparam edge_t Type of edge identifiers. Should match with the edge_t used in saving the edge
+ * property.
+ * @tparam value_t Type of edge property values. Should match with the value_t used in saving the
+ * edge property.
+ */
+template <typename edge_t, typename value_t>
+class edge_property_file_t {
+ public:
+  /**
+   * @brief Memory-map an edge property column file and validate its header.
+   *
+   * @param file_path Path to the edge property column file.
+   */
+  explicit edge_property_file_t(std::string const& file_path);
+
+  edge_property_file_t(edge_property_file_t const&) = delete;
+  edge_property_file_t& operator=(edge_property_file_t const&) = delete;
+
+  edge_property_file_t(edge_property_file_t&& other) noexcept;
+  edge_property_file_t& operator=(edge_property_file_t&& other) noexcept;
+
+  ~edge_property_file_t();
+
+  bool is_multi_gpu() const { return multi_gpu_; }
+
+  // graph sub-communicator sizes and ranks of the GPU that saved this file (1, 1, 0, 0 for
+  // single-GPU)
+  int major_comm_size() const { return major_comm_size_; }
+  int minor_comm_size() const { return minor_comm_size_; }
+  int major_comm_rank() const { return major_comm_rank_; }
+  int minor_comm_rank() const { return minor_comm_rank_; }
+
+  size_t number_of_local_edge_partitions() const { return edge_partition_values_.size(); }
+
+  // does not page in the values
+  edge_t edge_partition_edge_count(size_t partition_idx) const
+  {
+    return static_cast<edge_t>(edge_partition_values_[partition_idx].size());
+  }
+
+  raft::host_span<value_t const> edge_partition_values(size_t partition_idx) const
+  {
+    return edge_partition_values_[partition_idx];
+  }
+
+ private:
+  void unmap();
+
+  void const* data_{nullptr};
+  size_t size_{0};
+
+  bool multi_gpu_{false};
+  int major_comm_size_{1};
+  int minor_comm_size_{1};
+  int major_comm_rank_{0};
+  int minor_comm_rank_{0};
+
+  std::vector<raft::host_span<value_t const>> edge_partition_values_{};
+};
+
+/**
+ * @brief Save an edge property to an edge property column file.
+ *
+ * The values are stored in the edge partition order of @p graph_view, so the file can be attached
+ * to @p graph_view (or the graph re-loaded from a snapshot of @p graph_view by load_graph()) with
+ * load_edge_property() without renumbering or sorting. In multi-GPU, every GPU saves its local edge
+ * partitions to a separate file (so @p file_path should differ for every GPU), and the file should
+ * be re-loaded with the same graph sub-communicator sizes and ranks.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam value_t Type of edge property values. Needs to be an arithmetic type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the edge property column file to create (an existing file is
+ * overwritten).
+ * @param graph_view Graph view object of the graph the edge property belongs to.
+ * @param edge_property_view View object holding the edge property values for @p graph_view.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+void save_edge_property(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, value_t const*> edge_property_view);
+
+/**
+ * @brief Copy the values of a memory-mapped edge property column file to the device.
+ *
+ * This is the only step that reads the property values, so edge properties an algorithm does not
+ * use are never read from the storage. The edge partition count and the per edge partition edge
+ * counts of @p edge_property_file are validated against @p graph_view.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam value_t Type of edge property values. Needs to be an arithmetic type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to attach the edge property to.
+ * @param edge_property_file Memory-mapped edge property column file saved for @p graph_view (or
+ * the graph @p graph_view was re-loaded from).
+ * @return Edge property object holding the values for @p graph_view.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, value_t>
+load_edge_property(raft::handle_t const& handle,
+                   graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                   edge_property_file_t<edge_t, value_t> const& edge_property_file);
+
+/**
+ * @brief Read-only host view of a renumber map file written by save_renumber_map().
+ *
+ * A renumber map file stores the renumber map (internal to external vertex ID mapping) together
+ * with a prebuilt open addressing (linear probing, load factor <= 0.5) hash index for the reverse
+ * (external to internal) mapping, so translating external vertex IDs does not require re-building
+ * a hash table. Each index slot stores the position of an external vertex ID in the renumber map
+ * (or invalid_vertex_id for an empty slot). The file is memory-mapped on construction (so the
+ * lookups only page in the probed slots) and the spans are valid as long as this object is alive.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Should match with the vertex_t used in saving the
+ * renumber map.
+ */
+template <typename vertex_t>
+class renumber_map_t {
+ public:
+  /**
+   * @brief Memory-map a renumber map file and validate its header.
+   *
+   * The index slots are bounds-checked as they are probed (a corrupted slot is treated as empty).
+   *
+   * @param file_path Path to the renumber map file.
+   * @param do_expensive_check A flag to validate every index slot on construction (this pages in
+   * the entire index).
+   */
+  explicit renumber_map_t(std::string const& file_path, bool do_expensive_check = false);
+
+  renumber_map_t(renumber_map_t const&) = delete;
+  renumber_map_t& operator=(renumber_map_t const&) = delete;
+
+  renumber_map_t(renumber_map_t&& other) noexcept;
+  renumber_map_t& operator=(renumber_map_t&& other) noexcept;
+
+  ~renumber_map_t();
+
+  vertex_t local_int_vertex_first() const { return local_int_vertex_first_; }
+  vertex_t local_int_vertex_last() const
+  {
+    return local_int_vertex_first_ + static_cast<vertex_t>(renumber_map_labels_.size());
+  }
+
+  // external vertex IDs of the internal vertices in [local_int_vertex_first,
+  // local_int_vertex_last)
+  raft::host_span<vertex_t const> renumber_map_labels() const { return renumber_map_labels_; }
+
+  // the hash index (the number of slots is a power of two)
+  raft::host_span<vertex_t const> index_slots() const { return index_slots_; }
+
+  /**
+   * @brief Find the internal vertex ID of an external vertex ID.
+   *
+   * @param ext_vertex External vertex ID to look-up.
+   * @return Internal vertex ID of @p ext_vertex (invalid_vertex_id<vertex_t>::value if @p
+   * ext_vertex is not in the renumber map).
+   */
+  vertex_t find(vertex_t ext_vertex) const;
+
+  /**
+   * @brief Find the internal vertex IDs of external vertex IDs (host threads).
+   *
+   * @param ext_vertices External vertex IDs to look-up.
+   * @param int_vertices Output internal vertex IDs (invalid_vertex_id<vertex_t>::value for the
+   * external vertex IDs not in the renumber map). The size should coincide with @p
+   * ext_vertices.size().
+   * @param num_threads Number of host threads to use (0: use all the available cores).
+   */
+  void find(raft::host_span<vertex_t const> ext_vertices,
+            raft::host_span<vertex_t> int_vertices,
+            size_t num_threads = 0) const;
+
+ private:
+  void unmap();
+
+  void const* data_{nullptr};
+  size_t size_{0};
+
+  vertex_t local_int_vertex_first_{0};
+  raft::host_span<vertex_t const> renumber_map_labels_{};
+  raft::host_span<vertex_t const> index_slots_{};
+};
+
+/**
+ * @brief Save a renumber map with a prebuilt hash index for external to internal vertex ID
+ * translation.
+ *
+ * The saved file can be memory-mapped with renumber_map_t for host look-ups, or the renumber map
+ * and the index slots can be copied to the device for renumber_ext_vertices() (the overload taking
+ * @p index_slots).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the renumber map file to create (an existing file is overwritten).
+ * @param renumber_map_labels Renumber map (external vertex IDs of the internal vertices in
+ * [@p local_int_vertex_first, @p local_int_vertex_first + @p renumber_map_labels.size())).
+ * External vertex IDs should be unique.
+ * @param local_int_vertex_first The first local internal vertex (inclusive, assigned to this
+ * process in multi-GPU).
+ */
+template <typename vertex_t>
+void save_renumber_map(raft::handle_t const& handle,
+                       std::string const& file_path,
+                       raft::device_span<vertex_t const> renumber_map_labels,
+                       vertex_t local_int_vertex_first = vertex_t{0});
+
+/**
+ * @brief Renumber external vertices to internal vertices using a prebuilt hash index.
+ *
+ * This function works as renumber_ext_vertices() in single-GPU (or renumber_local_ext_vertices()
+ * in multi-GPU) but probes the hash index saved by save_renumber_map() instead of building a hash
+ * table on every call. Note cugraph::invalid_id<vertex_t>::value remains unchanged and external
+ * vertices missing in the renumber map are renumbered to cugraph::invalid_id<vertex_t>::value.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices Pointer to the vertices to be renumbered. The input external vertices are
+ * renumbered to internal vertices in-place.
+ * @param num_vertices Number of vertices to be renumbered.
+ * @param renumber_map_labels Device copy of renumber_map_t::renumber_map_labels().
+ * @param index_slots Device copy of renumber_map_t::index_slots().
+ * @param local_int_vertex_first The first local internal vertex (inclusive, assigned to this
+ * process in multi-GPU).
+ */
+template <typename vertex_t>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           raft::device_span<vertex_t const> renumber_map_labels,
+                           raft::device_span<vertex_t const> index_slots,
+                           vertex_t local_int_vertex_first = vertex_t{0});
+
+enum class graph_file_format_t : uint32_t { MATRIX_MARKET = 0, CSV };
+
+// minimum number of lines sampled by probe_graph_file() for CSV files
+constexpr size_t min_csv_probe_sample_lines{1024};
+
+/**
+ * @brief Size, weight, and symmetry information of a text graph file returned by
+ * probe_graph_file().
+ *
+ * Matrix Market sizes come from the size line and are exact. CSV files do not have a size line,
+ * so the number of entries is estimated from the average length of the sampled lines and the
+ * number of vertices from the largest sampled vertex ID (both become exact if the sampled lines
+ * cover the entire file, see @p is_exact).
+ */
+struct graph_file_properties_t {
+  graph_file_format_t format{graph_file_format_t::MATRIX_MARKET};
+
+  size_t number_of_vertices{0};
+  size_t number_of_entries{0};  // # edge lines in the file
+  // upper bound of the number of edges after converting a symmetric (or Hermitian or skew
+  // symmetric) Matrix Market file to the general format, number_of_entries otherwise
+  size_t max_number_of_edges{0};
+  bool is_weighted{false};
+  std::optional<bool> is_symmetric{std::nullopt};  // std::nullopt for CSV files
+  bool is_exact{false};  // true if number_of_vertices and number_of_entries are exact
+
+  // sampled edge lines (Matrix Market vertex IDs are converted to 0-based)
+  size_t number_of_sampled_entries{0};
+  std::optional<int64_t> min_vertex_id{std::nullopt};
+  std::optional<int64_t> max_vertex_id{std::nullopt};
+  // fraction of the sampled entries repeating an earlier sampled (source, destination) pair,
+  // duplicates are counted only within the sampled lines (so this tends to be an under-estimate
+  // unless the duplicates are adjacent in the file)
+  std::optional<double> duplicate_entry_rate{std::nullopt};
+
+  // true if vertex_t can store the (estimated) vertex IDs
+  template <typename vertex_t>
+  bool vertex_t_fits() const
+  {
+    auto max_id = std::max(static_cast<int64_t>(number_of_vertices) - 1,
+                           max_vertex_id ? *max_vertex_id : int64_t{0});
+    auto min_id = min_vertex_id ? *min_vertex_id : int64_t{0};
+    return (static_cast<uint64_t>(std::max(max_id, int64_t{0})) <=
+            static_cast<uint64_t>(std::numeric_limits<vertex_t>::max())) &&
+           (min_id >= static_cast<int64_t>(std::numeric_limits<vertex_t>::lowest()));
+  }
+
+  // true if edge_t can store the (estimated) number of edges
+  template <typename edge_t>
+  bool edge_t_fits() const
+  {
+    return static_cast<uint64_t>(max_number_of_edges) <=
+           static_cast<uint64_t>(std::numeric_limits<edge_t>::max());
+  }
+};
+
+/**
+ * @brief Probe the size, weight, and symmetry of a Matrix Market or CSV graph file without
+ * parsing the entire file.
+ *
+ * The file format is detected from the contents (a file starting with the Matrix Market banner is
+ * a Matrix Market file, and a CSV file otherwise; blank separated edge lists such as SNAP files are
+ * probed as CSV files and their '#' comment lines are skipped). For Matrix Market files, only the
+ * banner, the comments, and the size line are read unless @p num_sample_lines > 0. Sampled lines
+ * are read from (up to) 16 evenly spaced positions in the file, so the cost is independent of the
+ * file size. CSV files have no size line, so at least min_csv_probe_sample_lines lines are sampled.
+ *
+ * This is useful to pre-size buffers and to pick the vertex_t and edge_t widths before loading a
+ * file.
+ *
+ * @param file_path Path to the Matrix Market or CSV file.
+ * @param num_sample_lines Number of edge lines to sample for the vertex ID range and duplicate
+ * entry rate estimates (0: read the header only).
+ * @return Properties of the file.
+ */
+graph_file_properties_t probe_graph_file(std::string const& file_path,
+                                         size_t num_sample_lines = 0);
+
+}  // namespace cugraph
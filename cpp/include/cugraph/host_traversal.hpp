@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+
+/**
+ * @brief Host (CPU) traversal algorithms over host CSR arrays.
+ *
+ * These are built into the cugraph_host library (cugraph::cugraph_host), which does not launch
+ * CUDA kernels or allocate device memory, so it can serve as a CPU execution path on machines
+ * without a GPU and as a fast (multi-threaded) reference implementation to validate the GPU
+ * algorithms. The work is parallelized with OpenMP if cugraph_host is built with OpenMP support
+ * (and runs on a single thread otherwise).
+ *
+ * A graph is given as CSR arrays: the neighbors of vertex v are indices[offsets[v]],
+ * indices[offsets[v] + 1], ..., indices[offsets[v + 1] - 1] (these can be copied from
+ * graph_view_t::local_edge_partition_view() of a single-GPU graph).
+ *
+ * Vertices are partitioned to the threads in contiguous ranges. Every traversal step scans the
+ * current frontier with dynamic scheduling (so high degree vertices do not serialize a step),
+ * buffers the updates in per-(source thread, owner thread) local buffers, and then every thread
+ * applies the updates to the vertices it owns, so the distances and the predecessors are updated
+ * without atomics and a predecessor is always consistent with its distance.
+ */
+namespace cugraph {
+namespace host {
+
+/**
+ * @brief Run breadth-first search on the host.
+ *
+ * Level synchronous top-down BFS. Every vertex reachable from @p sources within @p depth_limit
+ * hops gets its hop count from the nearest source and (if @p predecessors is not `nullptr`) a
+ * predecessor on a shortest path.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param offsets Pointer to the CSR offset array (size @p num_vertices + 1).
+ * @param indices Pointer to the CSR index array (size offsets[num_vertices]).
+ * @param num_vertices Number of vertices.
+ * @param distances Pointer to the output distance array (size @p num_vertices,
+ * std::numeric_limits<vertex_t>::max() for unreachable vertices).
+ * @param predecessors Pointer to the output predecessor array (size @p num_vertices,
+ * cugraph::invalid_vertex_id<vertex_t>::value for the sources and the unreachable vertices) or
+ * `nullptr`.
+ * @param sources Pointer to the source vertices.
+ * @param n_sources Number of sources.
+ * @param depth_limit Any vertex farther than @p depth_limit hops from the sources is marked as
+ * unreachable.
+ * @param num_threads Number of threads to use (0 to use the OpenMP default).
+ */
+template <typename vertex_t, typename edge_t>
+void bfs(edge_t const* offsets,
+         vertex_t const* indices,
+         vertex_t num_vertices,
+         vertex_t* distances,
+         vertex_t* predecessors,
+         vertex_t const* sources,
+         size_t n_sources,
+         vertex_t depth_limit = std::numeric_limits<vertex_t>::max(),
+         size_t num_threads   = 0);
+
+/**
+ * @brief Run single-source shortest-path on the host.
+ *
+ * Parallel delta-stepping (Meyer & Sanders, 2003): vertices are kept in buckets of width @p delta
+ * by tentative distance, the light edges (weight <= @p delta) of the current bucket are relaxed
+ * until the bucket stops changing, and then the heavy edges of the vertices removed from the
+ * bucket are relaxed once. Edge weights should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param offsets Pointer to the CSR offset array (size @p num_vertices + 1).
+ * @param indices Pointer to the CSR index array (size offsets[num_vertices]).
+ * @param weights Pointer to the edge weight array (size offsets[num_vertices]).
+ * @param num_vertices Number of vertices.
+ * @param distances Pointer to the output distance array (size @p num_vertices,
+ * std::numeric_limits<weight_t>::max() for unreachable vertices).
+ * @param predecessors Pointer to the output predecessor array (size @p num_vertices,
+ * cugraph::invalid_vertex_id<vertex_t>::value for the source and the unreachable vertices) or
+ * `nullptr`.
+ * @param source Source vertex.
+ * @param cutoff Any vertex farther than @p cutoff from @p source is marked as unreachable.
+ * @param delta Bucket width (should be positive). If `std::nullopt`, min((maximum edge weight) /
+ * (average vertex degree), average edge weight) (as in sssp_method_t::DELTA_STEPPING of sssp()).
+ * @param num_threads Number of threads to use (0 to use the OpenMP default).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void sssp(edge_t const* offsets,
+          vertex_t const* indices,
+          weight_t const* weights,
+          vertex_t num_vertices,
+          weight_t* distances,
+          vertex_t* predecessors,
+          vertex_t source,
+          weight_t cutoff               = std::numeric_limits<weight_t>::max(),
+          std::optional<weight_t> delta = std::nullopt,
+          size_t num_threads            = 0);
+
+}  // namespace host
+}  // namespace cugraph
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+
+enum class sampling_result_type_t : uint32_t { RANDOM_WALKS = 0, NEIGHBOR_SAMPLES };
+
+/**
+ * @brief Host copy of a batch of sampling results read from a sampling result file.
+ *
+ * Results are stored per seed (a start vertex of a random walk or a starting vertex of neighbor
+ * sampling, in the input order); the values of the i'th seed of a batch are stored in
+ * [offsets[i], offsets[i + 1]).
+ *
+ * For random walks, the values are the (variable length, invalid vertices are dropped) path
+ * vertices and the i'th path has (offsets[i + 1] - offsets[i] - 1) edge weights starting from
+ * (offsets[i] - i) in @p weights.
+ *
+ * For neighbor samples, the values are the sampled edges (sources in @p srcs, destinations in @p
+ * vertices, and edge weights and hops if stored).
+ */
+template <typename vertex_t, typename weight_t>
+struct sampling_result_batch_t {
+  std::vector<size_t> offsets{};
+  std::optional<std::vector<vertex_t>> srcs{std::nullopt};  // neighbor samples only
+  std::vector<vertex_t> vertices{};
+  std::optional<std::vector<weight_t>> weights{std::nullopt};
+  std::optional<std::vector<int32_t>> hops{std::nullopt};  // neighbor samples only
+};
+
+/**
+ * @brief Sequential reader of a sampling result file written by uniform_random_walks_to_file(),
+ * node2vec_random_walks_to_file(), or uniform_neighbor_sample_to_file().
+ *
+ * A sampling result file is a columnar binary file: a versioned header (storing the result type,
+ * the type sizes, and the total counts) followed by a sequence of batches. Every batch has a small
+ * batch header (# seeds and # values in the batch) followed by the columns (offsets, sources
+ * (neighbor samples only), vertices, edge weights (optional), and hops (optional)), each column
+ * starts at an 8 byte boundary. Multi-byte values are stored in the host byte order.
+ *
+ * Batches are read one at a time, so the host memory footprint is bounded by the largest batch.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Should match with the vertex_t used in writing the
+ * file.
+ * @tparam weight_t Type of edge weights. Should match with the weight_t used in writing the file
+ * (ignored if the file does not store edge weights).
+ */
+template <typename vertex_t, typename weight_t>
+class sampling_result_reader_t {
+ public:
+  /**
+   * @brief Open a sampling result file and validate its header.
+   *
+   * @param file_path Path to the sampling result file.
+   */
+  explicit sampling_result_reader_t(std::string const& file_path);
+
+  sampling_result_type_t result_type() const { return result_type_; }
+
+  bool has_weights() const { return has_weights_; }
+  bool has_hops() const { return has_hops_; }
+
+  size_t number_of_batches() const { return number_of_batches_; }
+  size_t number_of_seeds() const { return number_of_seeds_; }
+  // # path vertices (random walks) or # sampled edges (neighbor samples)
+  size_t number_of_values() const { return number_of_values_; }
+
+  /**
+   * @brief Read the next batch.
+   *
+   * @return Host copy of the next batch, std::nullopt if every batch has already been read.
+   */
+  std::optional<sampling_result_batch_t<vertex_t, weight_t>> read_next_batch();
+
+ private:
+  std::ifstream file_{};
+
+  sampling_result_type_t result_type_{sampling_result_type_t::RANDOM_WALKS};
+  bool has_weights_{false};
+  bool has_hops_{false};
+  size_t number_of_batches_{0};
+  size_t number_of_seeds_{0};
+  size_t number_of_values_{0};
+
+  size_t next_batch_idx_{0};
+};
+
+/**
+ * @brief Run uniform random walks from the start vertices in batches and write the paths to a
+ * sampling result file.
+ *
+ * uniform_random_walks() returns (max_length + 1) vertices per start vertex at once, this
+ * function splits @p start_vertices into batches of (at most) @p batch_size start vertices instead,
+ * compacts each batch's paths (dropping the invalid vertices of the paths terminated before
+ * max_length), and hands the batch to a writer thread. The writer thread writes the previous batch
+ * while the current batch is being generated (two host buffers are used in turn), so the device
+ * memory footprint is bounded by @p batch_size and the host memory footprint by two batches.
+ *
+ * The random number generator seed of each batch is derived from @p seed and the batch index, so
+ * the output is reproducible for a fixed @p seed (including the default).
+ *
+ * In multi-GPU, every GPU writes the paths from its local start vertices to its own file (@p
+ * file_path should be different for every GPU unless the GPUs do not share a file system).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view graph view to operate on
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() is true, the file stores the edge weights of the paths as well.
+ * @param start_vertices Device span defining the starting vertices
+ * @param max_length maximum length of random walk
+ * @param file_path Path to the sampling result file to create (overwritten if exists).
+ * @param batch_size Maximum number of start vertices per batch.
+ * @param seed (optional), seed for random number generation, 0 to seed with the system time
+ * @return Number of path vertices written to the file.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed = std::numeric_limits<uint64_t>::max());
+
+/**
+ * @brief Run node2vec random walks from the start vertices in batches and write the paths to a
+ * sampling result file.
+ *
+ * This function works as uniform_random_walks_to_file() but with node2vec biases (see
+ * node2vec_random_walks()).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view graph view to operate on
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0 (and not stored).
+ * @param start_vertices Device span defining the starting vertices
+ * @param max_length maximum length of random walk
+ * @param p node2vec return parameter
+ * @param q node2vec in-out parameter
+ * @param file_path Path to the sampling result file to create (overwritten if exists).
+ * @param batch_size Maximum number of start vertices per batch.
+ * @param seed (optional), seed for random number generation, 0 to seed with the system time
+ * @return Number of path vertices written to the file.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length,
+  weight_t p,
+  weight_t q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed = std::numeric_limits<uint64_t>::max());
+
+/**
+ * @brief Run uniform neighbor sampling from the starting vertices in batches and write the sampled
+ * edges to a sampling result file.
+ *
+ * @p starting_vertices is split into batches of (at most) @p batch_size vertices and
+ * uniform_neighbor_sample() is called for each batch (with the starting vertex indices as labels
+ * to group the sampled edges by starting vertex). As in uniform_random_walks_to_file(), the sampled
+ * edges of a batch are written by a writer thread while the next batch is being sampled.
+ *
+ * In multi-GPU, the sampled edges are shuffled back to the GPU owning the starting vertex and
+ * every GPU writes its own file (@p file_path should be different for every GPU unless the GPUs do
+ * not share a file system).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate NBR Sampling on.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() is true, the file stores the sampled edge weights as well.
+ * @param starting_vertices Device span of starting vertex IDs for the sampling.
+ * In a multi-gpu context the starting vertices should be local to this GPU.
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+ * level
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param file_path Path to the sampling result file to create (overwritten if exists).
+ * @param batch_size Maximum number of starting vertices per batch.
+ * @param return_hops boolean flag specifying if the hop information should be stored
+ * @param with_replacement boolean flag specifying if random sampling is done with replacement
+ * (true); or, without replacement (false); default = true;
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Number of sampled edges written to the file.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement   = true,
+  bool do_expensive_check = false);
+
+}  // namespace cugraph
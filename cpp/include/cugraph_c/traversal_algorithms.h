@@ -144,6 +144,81 @@ cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* handle,
                                   cugraph_paths_result_t** result,
                                   cugraph_error_t** error);
 
+/**
+ * @brief     Enumeration of single-source shortest-path methods
+ */
+typedef enum {
+  SSSP_METHOD_NEAR_FAR       = 0, /** Near-Far pile method (used by cugraph_sssp) */
+  SSSP_METHOD_DELTA_STEPPING = 1  /** Delta-stepping with light/heavy edge splitting */
+} cugraph_sssp_method_t;
+
+/**
+ * @brief     Perform single-source shortest-path with the given method
+ *
+ * Same as cugraph_sssp, but selects the single-source shortest-path method and its bucket width.
+ * Delta-stepping typically performs fewer relaxations than Near-Far on graphs with a large
+ * diameter (e.g. road networks) or a wide edge weight spread.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  source       Source vertex id
+ * @param [in]  cutoff       Maximum edge weight sum to consider
+ * @param [in]  method       Single-source shortest-path method
+ * @param [in]  delta        Bucket width, if not positive, the bucket width is chosen from the
+ *                           edge weight distribution
+ * @param [in]  compute_predecessors A flag to indicate whether to compute the predecessors in the
+ * result
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_sssp_with_method(const cugraph_resource_handle_t* handle,
+                                              cugraph_graph_t* graph,
+                                              size_t source,
+                                              double cutoff,
+                                              cugraph_sssp_method_t method,
+                                              double delta,
+                                              bool_t compute_predecessors,
+                                              bool_t do_expensive_check,
+                                              cugraph_paths_result_t** result,
+                                              cugraph_error_t** error);
+
+/**
+ * @brief     Perform single-source shortest-path from each of a set of source vertices
+ *
+ * Sources are processed in tiles that share a single frontier, which is considerably faster than
+ * calling cugraph_sssp once per source.  In a multi-GPU run every GPU should pass the same sources.
+ *
+ * The distances (and predecessors) in the result are stored as a row-major matrix with one row
+ * per vertex in the result's vertex array and one column per source, so the distance from
+ * sources[j] to the i'th vertex is distances[i * num_sources + j].
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  sources      Array of source vertices (may contain duplicates)
+ * @param [in]  cutoff       Maximum edge weight sum to consider
+ * @param [in]  compute_predecessors A flag to indicate whether to compute the predecessors in the
+ * result
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_multi_source_sssp(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  double cutoff,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Opaque extract_paths result type
  */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -34,6 +34,8 @@ struct sssp_functor : public abstract_functor {
   cugraph_graph_t* graph_;
   size_t source_;
   double cutoff_;
+  cugraph::sssp_method_t method_;
+  double delta_;  // not positive: chosen by the method
   bool compute_predecessors_;
   bool do_expensive_check_;
   cugraph_paths_result_t* result_{};
@@ -42,6 +44,8 @@ struct sssp_functor : public abstract_functor {
                ::cugraph_graph_t* graph,
                size_t source,
                double cutoff,
+               cugraph::sssp_method_t method,
+               double delta,
                bool compute_predecessors,
                bool do_expensive_check)
     : abstract_functor(),
@@ -49,6 +53,8 @@ struct sssp_functor : public abstract_functor {
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
       source_(source),
       cutoff_(cutoff),
+      method_(method),
+      delta_(delta),
       compute_predecessors_(compute_predecessors),
       do_expensive_check_(do_expensive_check)
   {
@@ -118,6 +124,121 @@ struct sssp_functor : public abstract_functor {
         compute_predecessors_ ? predecessors.data() : nullptr,
         src,
         static_cast<weight_t>(cutoff_),
+        do_expensive_check_,
+        method_,
+        delta_ > 0.0 ? std::make_optional(static_cast<weight_t>(delta_)) : std::nullopt);
+
+      rmm::device_uvector<vertex_t> vertex_ids(graph_view.local_vertex_partition_range_size(),
+                                               handle_.get_stream());
+      raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
+
+      if (compute_predecessors_) {
+        std::vector<vertex_t> vertex_partition_range_lasts =
+          graph_view.vertex_partition_range_lasts();
+
+        unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                     predecessors.data(),
+                                                     predecessors.size(),
+                                                     number_map->data(),
+                                                     vertex_partition_range_lasts,
+                                                     do_expensive_check_);
+      }
+
+      result_ = new cugraph_paths_result_t{
+        new cugraph_type_erased_device_array_t(vertex_ids, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(distances, graph_->weight_type_),
+        new cugraph_type_erased_device_array_t(predecessors, graph_->vertex_type_)};
+    }
+  }
+};
+
+struct multi_source_sssp_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  cugraph_type_erased_device_array_view_t const* sources_;
+  double cutoff_;
+  bool compute_predecessors_;
+  bool do_expensive_check_;
+  cugraph_paths_result_t* result_{};
+
+  multi_source_sssp_functor(::cugraph_resource_handle_t const* handle,
+                            ::cugraph_graph_t* graph,
+                            ::cugraph_type_erased_device_array_view_t const* sources,
+                            double cutoff,
+                            bool compute_predecessors,
+                            bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      sources_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(sources)),
+      cutoff_(cutoff),
+      compute_predecessors_(compute_predecessors),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // SSSP expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>*>(graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto edge_weights = reinterpret_cast<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                                 weight_t>*>(graph_->edge_weights_);
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      // every GPU holds the same sources (the results are distributed by vertex, not by source),
+      // so the sources are not shuffled
+      rmm::device_uvector<vertex_t> sources(sources_->size_, handle_.get_stream());
+      raft::copy(
+        sources.data(), sources_->as_type<vertex_t>(), sources_->size_, handle_.get_stream());
+
+      //
+      // Need to renumber sources
+      //
+      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
+                                                 sources.data(),
+                                                 sources.size(),
+                                                 number_map->data(),
+                                                 graph_view.local_vertex_partition_range_first(),
+                                                 graph_view.local_vertex_partition_range_last(),
+                                                 do_expensive_check_);
+
+      auto num_elements =
+        static_cast<size_t>(graph_view.local_vertex_partition_range_size()) * sources.size();
+      rmm::device_uvector<weight_t> distances(num_elements, handle_.get_stream());
+      rmm::device_uvector<vertex_t> predecessors(compute_predecessors_ ? num_elements : size_t{0},
+                                                 handle_.get_stream());
+
+      cugraph::multi_source_sssp<vertex_t, edge_t, weight_t, multi_gpu>(
+        handle_,
+        graph_view,
+        edge_weights->view(),
+        raft::device_span<vertex_t const>(sources.data(), sources.size()),
+        distances.data(),
+        compute_predecessors_ ? predecessors.data() : nullptr,
+        static_cast<weight_t>(cutoff_),
         do_expensive_check_);
 
       rmm::device_uvector<vertex_t> vertex_ids(graph_view.local_vertex_partition_range_size(),
@@ -156,8 +277,55 @@ extern "C" cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* ha
                                              cugraph_paths_result_t** result,
                                              cugraph_error_t** error)
 {
-  cugraph::c_api::sssp_functor functor(
-    handle, graph, source, cutoff, compute_predecessors, do_expensive_check);
+  cugraph::c_api::sssp_functor functor(handle,
+                                       graph,
+                                       source,
+                                       cutoff,
+                                       cugraph::sssp_method_t::NEAR_FAR,
+                                       0.0,
+                                       compute_predecessors,
+                                       do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_sssp_with_method(const cugraph_resource_handle_t* handle,
+                                                         cugraph_graph_t* graph,
+                                                         size_t source,
+                                                         double cutoff,
+                                                         cugraph_sssp_method_t method,
+                                                         double delta,
+                                                         bool_t compute_predecessors,
+                                                         bool_t do_expensive_check,
+                                                         cugraph_paths_result_t** result,
+                                                         cugraph_error_t** error)
+{
+  cugraph::c_api::sssp_functor functor(handle,
+                                       graph,
+                                       source,
+                                       cutoff,
+                                       method == SSSP_METHOD_DELTA_STEPPING
+                                         ? cugraph::sssp_method_t::DELTA_STEPPING
+                                         : cugraph::sssp_method_t::NEAR_FAR,
+                                       delta,
+                                       compute_predecessors,
+                                       do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_multi_source_sssp(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  double cutoff,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  cugraph::c_api::multi_source_sssp_functor functor(
+    handle, graph, sources, cutoff, compute_predecessors, do_expensive_check);
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
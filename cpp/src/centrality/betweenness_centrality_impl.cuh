@@ -27,13 +27,30 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
 
 #include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
 
 //
 // The formula for BC(v) is the sum over all (s,t) where s != v != t of
@@ -54,6 +71,119 @@ struct brandes_e_op_t {
   }
 };
 
+// multi-source traversals store the per-source state in blocks: a vertex property holds one value
+// per source (lane) of a block of sources, lanes are stored as contiguous [V] arrays
+template <typename T>
+using brandes_block_t = thrust::tuple<T, T, T, T, T, T, T, T>;
+
+constexpr size_t brandes_block_width = thrust::tuple_size<brandes_block_t<int>>::value;
+
+template <typename T, size_t... Is>
+auto make_brandes_lane_zip_iterator(T* first, size_t lane_size, std::index_sequence<Is...>)
+{
+  return thrust::make_zip_iterator(thrust::make_tuple((first + Is * lane_size)...));
+}
+
+template <typename T>
+auto make_brandes_lane_zip_iterator(T* first, size_t lane_size)
+{
+  return make_brandes_lane_zip_iterator(
+    first, lane_size, std::make_index_sequence<brandes_block_width>{});
+}
+
+template <typename vertex_t, typename edge_t, size_t... Is>
+__device__ brandes_block_t<edge_t> brandes_block_push(
+  brandes_block_t<edge_t> const& src_sigmas,
+  brandes_block_t<vertex_t> const& dst_distances,
+  std::index_sequence<Is...>)
+{
+  constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+  return thrust::make_tuple(
+    ((thrust::get<Is>(dst_distances) == invalid_distance) ? thrust::get<Is>(src_sigmas)
+                                                          : edge_t{0})...);
+}
+
+template <typename T, size_t... Is>
+__device__ bool brandes_block_any_non_zero(brandes_block_t<T> const& block,
+                                           std::index_sequence<Is...>)
+{
+  return ((thrust::get<Is>(block) != T{0}) || ...);
+}
+
+template <typename vertex_t, typename edge_t, size_t... Is>
+__device__ brandes_block_t<vertex_t> brandes_block_visit(
+  brandes_block_t<vertex_t> const& distances,
+  brandes_block_t<edge_t> const& pushed_sigmas,
+  vertex_t next_hop,
+  std::index_sequence<Is...>)
+{
+  return thrust::make_tuple(
+    ((thrust::get<Is>(pushed_sigmas) != edge_t{0}) ? next_hop : thrust::get<Is>(distances))...);
+}
+
+template <typename edge_t, size_t... Is>
+__device__ brandes_block_t<edge_t> brandes_block_add(brandes_block_t<edge_t> const& lhs,
+                                                     brandes_block_t<edge_t> const& rhs,
+                                                     std::index_sequence<Is...>)
+{
+  return thrust::make_tuple((thrust::get<Is>(lhs) + thrust::get<Is>(rhs))...);
+}
+
+// pushes the sigmas of the lanes where the source is in the current frontier (the sigmas of the
+// other lanes are masked to 0) to the lanes where the destination is not visited yet
+template <typename vertex_t, typename edge_t>
+struct brandes_block_e_op_t {
+  __device__ thrust::optional<brandes_block_t<edge_t>> operator()(
+    vertex_t,
+    vertex_t,
+    brandes_block_t<edge_t> src_sigmas,
+    brandes_block_t<vertex_t> dst_distances,
+    thrust::nullopt_t) const
+  {
+    auto pushed = brandes_block_push<vertex_t, edge_t>(
+      src_sigmas, dst_distances, std::make_index_sequence<brandes_block_width>{});
+    return brandes_block_any_non_zero(pushed, std::make_index_sequence<brandes_block_width>{})
+             ? thrust::make_optional(pushed)
+             : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct brandes_block_v_op_t {
+  vertex_t next_hop{};
+  size_t bucket_idx_next{};
+
+  __device__ thrust::tuple<
+    thrust::optional<size_t>,
+    thrust::optional<thrust::tuple<brandes_block_t<vertex_t>, brandes_block_t<edge_t>>>>
+  operator()(vertex_t,
+             thrust::tuple<brandes_block_t<vertex_t>, brandes_block_t<edge_t>> old_values,
+             brandes_block_t<edge_t> pushed_sigmas) const
+  {
+    auto distances = brandes_block_visit(thrust::get<0>(old_values),
+                                         pushed_sigmas,
+                                         next_hop,
+                                         std::make_index_sequence<brandes_block_width>{});
+    auto sigmas    = brandes_block_add(
+      thrust::get<1>(old_values), pushed_sigmas, std::make_index_sequence<brandes_block_width>{});
+    return thrust::make_tuple(thrust::make_optional(bucket_idx_next),
+                              thrust::make_optional(thrust::make_tuple(distances, sigmas)));
+  }
+};
+
+template <typename vertex_t, size_t... Is>
+__device__ vertex_t brandes_block_max_distance(brandes_block_t<vertex_t> const& distances,
+                                               std::index_sequence<Is...>)
+{
+  constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+  vertex_t max_distance{0};
+  ((max_distance = ((thrust::get<Is>(distances) != invalid_distance) &&
+                    (thrust::get<Is>(distances) > max_distance))
+                     ? thrust::get<Is>(distances)
+                     : max_distance),
+   ...);
+  return max_distance;
+}
 }  // namespace
 
 namespace cugraph {
@@ -265,6 +395,267 @@ void accumulate_vertex_results(
   }
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<edge_t>> brandes_block_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> block_sources,
+  raft::device_span<size_t const> block_source_lanes,
+  bool do_expensive_check)
+{
+  //
+  // Multi-source version of brandes_bfs: one BFS per lane, the lanes share a vertex frontier (a
+  // vertex is in the frontier if it is in the frontier of any lane) and every edge is visited
+  // once per hop for all the lanes.  Distances and sigmas are returned lane by lane ([lane][V]).
+  //
+  constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+  constexpr size_t bucket_idx_cur{0};
+  constexpr size_t bucket_idx_next{1};
+  constexpr size_t num_buckets{2};
+
+  auto const num_local_vertices =
+    static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  rmm::device_uvector<vertex_t> distances(brandes_block_width * num_local_vertices,
+                                          handle.get_stream());
+  rmm::device_uvector<edge_t> sigmas(distances.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> frontier_sigmas(distances.size(), handle.get_stream());
+  detail::scalar_fill(handle, distances.data(), distances.size(), invalid_distance);
+  detail::scalar_fill(handle, sigmas.data(), sigmas.size(), edge_t{0});
+
+  edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, brandes_block_t<edge_t>>
+    src_sigmas(handle, graph_view);
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, brandes_block_t<vertex_t>>
+    dst_distances(handle, graph_view);
+
+  auto vertex_partition =
+    vertex_partition_device_view_t<vertex_t, multi_gpu>(graph_view.local_vertex_partition_view());
+
+  vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+
+  {
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(block_sources.size()),
+      [block_sources,
+       block_source_lanes,
+       d_distances = distances.data(),
+       d_sigmas    = sigmas.data(),
+       vertex_partition,
+       num_local_vertices] __device__(auto i) {
+        auto offset = block_source_lanes[i] * num_local_vertices +
+                      vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(
+                        block_sources[i]);
+        d_distances[offset] = 0;
+        d_sigmas[offset]    = 1;
+      });
+
+    rmm::device_uvector<vertex_t> frontier_vertices(block_sources.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 block_sources.begin(),
+                 block_sources.end(),
+                 frontier_vertices.begin());
+    thrust::sort(handle.get_thrust_policy(), frontier_vertices.begin(), frontier_vertices.end());
+    frontier_vertices.resize(
+      thrust::distance(frontier_vertices.begin(),
+                       thrust::unique(handle.get_thrust_policy(),
+                                      frontier_vertices.begin(),
+                                      frontier_vertices.end())),
+      handle.get_stream());
+    vertex_frontier.bucket(bucket_idx_cur)
+      .insert(frontier_vertices.begin(), frontier_vertices.end());
+  }
+
+  vertex_t hop{0};
+
+  while (true) {
+    // only the lanes where a vertex is in the current frontier push its sigma
+    thrust::transform(handle.get_thrust_policy(),
+                      distances.begin(),
+                      distances.end(),
+                      sigmas.begin(),
+                      frontier_sigmas.begin(),
+                      [hop] __device__(auto d, auto sigma) {
+                        return d == hop ? sigma : edge_t{0};
+                      });
+
+    update_edge_src_property(
+      handle,
+      graph_view,
+      make_brandes_lane_zip_iterator(frontier_sigmas.data(), num_local_vertices),
+      src_sigmas);
+    update_edge_dst_property(handle,
+                             graph_view,
+                             make_brandes_lane_zip_iterator(distances.data(), num_local_vertices),
+                             dst_distances);
+
+    auto [new_frontier, new_sigmas] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    graph_view,
+                                                    vertex_frontier.bucket(bucket_idx_cur),
+                                                    src_sigmas.view(),
+                                                    dst_distances.view(),
+                                                    cugraph::edge_dummy_property_t{}.view(),
+                                                    brandes_block_e_op_t<vertex_t, edge_t>{},
+                                                    reduce_op::plus<brandes_block_t<edge_t>>());
+
+    auto value_first = thrust::make_zip_iterator(
+      thrust::make_tuple(make_brandes_lane_zip_iterator(distances.data(), num_local_vertices),
+                         make_brandes_lane_zip_iterator(sigmas.data(), num_local_vertices)));
+    update_v_frontier(handle,
+                      graph_view,
+                      std::move(new_frontier),
+                      std::move(new_sigmas),
+                      vertex_frontier,
+                      std::vector<size_t>{bucket_idx_next},
+                      value_first,
+                      value_first,
+                      brandes_block_v_op_t<vertex_t, edge_t>{hop + 1, bucket_idx_next});
+
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+
+    ++hop;
+  }
+
+  return std::make_tuple(std::move(distances), std::move(sigmas));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void accumulate_block_vertex_results(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<weight_t> centralities,
+  rmm::device_uvector<vertex_t>&& distances,
+  rmm::device_uvector<edge_t>&& sigmas,
+  bool with_endpoints,
+  bool do_expensive_check)
+{
+  //
+  // Multi-source version of accumulate_vertex_results: the dependencies of all the lanes are
+  // accumulated level by level in one edge sweep per level (instead of one per level per lane).
+  //
+  constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  auto const num_local_vertices =
+    static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  vertex_t diameter = transform_reduce_v(
+    handle,
+    graph_view,
+    make_brandes_lane_zip_iterator(distances.data(), num_local_vertices),
+    [] __device__(auto, auto ds) {
+      return brandes_block_max_distance(ds, std::make_index_sequence<brandes_block_width>{});
+    },
+    vertex_t{0},
+    reduce_op::maximum<vertex_t>{},
+    do_expensive_check);
+
+  if (with_endpoints) {
+    for (size_t lane = 0; lane < brandes_block_width; ++lane) {
+      auto lane_distances = distances.begin() + lane * num_local_vertices;
+
+      vertex_t count = count_if_v(
+        handle,
+        graph_view,
+        lane_distances,
+        [] __device__(auto, auto d) { return (d != invalid_distance); },
+        do_expensive_check);
+
+      if (count == 0) { continue; }  // unused lane
+
+      thrust::transform(handle.get_thrust_policy(),
+                        lane_distances,
+                        lane_distances + num_local_vertices,
+                        centralities.begin(),
+                        centralities.begin(),
+                        [count] __device__(auto d, auto centrality) {
+                          if (d == vertex_t{0}) {
+                            return centrality + static_cast<weight_t>(count - 1);
+                          } else if (d == invalid_distance) {
+                            return centrality;
+                          } else {
+                            return centrality + weight_t{1};
+                          }
+                        });
+    }
+  }
+
+  rmm::device_uvector<weight_t> deltas(distances.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> coefficients(distances.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> coefficient_sums(distances.size(), handle.get_stream());
+  detail::scalar_fill(handle, deltas.data(), deltas.size(), weight_t{0});
+
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, brandes_block_t<weight_t>>
+    dst_coefficients(handle, graph_view);
+
+  //
+  // delta(v) = sum over the successors w of v of (sigma(v) / sigma(w)) * (1 + delta(w)), so the
+  // per-successor factor (1 + delta(w)) / sigma(w) is reduced over the out-going edges and then
+  // scaled by sigma(v) (a vertex at distance d - 1 is a predecessor of every out-neighbor at
+  // distance d).
+  //
+  for (vertex_t d = diameter; d > 1; --d) {
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_zip_iterator(distances.begin(), sigmas.begin(), deltas.begin()),
+                      thrust::make_zip_iterator(distances.end(), sigmas.end(), deltas.end()),
+                      coefficients.begin(),
+                      [d] __device__(auto tuple) {
+                        return (thrust::get<0>(tuple) == d)
+                                 ? (weight_t{1} + thrust::get<2>(tuple)) /
+                                     static_cast<weight_t>(thrust::get<1>(tuple))
+                                 : weight_t{0};
+                      });
+
+    update_edge_dst_property(
+      handle,
+      graph_view,
+      make_brandes_lane_zip_iterator(coefficients.data(), num_local_vertices),
+      dst_coefficients);
+
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      dst_coefficients.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      [] __device__(auto, auto, auto, auto dst_coeffs, auto) { return dst_coeffs; },
+      brandes_block_t<weight_t>{},
+      reduce_op::plus<brandes_block_t<weight_t>>{},
+      make_brandes_lane_zip_iterator(coefficient_sums.data(), num_local_vertices),
+      do_expensive_check);
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(distances.begin(), sigmas.begin(), coefficient_sums.begin()),
+      thrust::make_zip_iterator(distances.end(), sigmas.end(), coefficient_sums.end()),
+      deltas.begin(),
+      [d] __device__(auto tuple) {
+        return (thrust::get<0>(tuple) == (d - 1))
+                 ? static_cast<weight_t>(thrust::get<1>(tuple)) * thrust::get<2>(tuple)
+                 : weight_t{0};
+      });
+
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      centralities.begin(),
+                      centralities.begin(),
+                      [d_deltas = deltas.data(), num_local_vertices] __device__(auto i,
+                                                                                auto centrality) {
+                        for (size_t lane = 0; lane < brandes_block_width; ++lane) {
+                          centrality += d_deltas[lane * num_local_vertices + i];
+                        }
+                        return centrality;
+                      });
+  }
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -305,43 +696,45 @@ rmm::device_uvector<weight_t> betweenness_centrality(
   }
 
   //
-  // FIXME: This could be more efficient using something akin to the
-  // technique in WCC.  Take the entire set of sources, insert them into
-  // a tagged frontier (tagging each source with itself).  Then we can
-  // expand from multiple sources concurrently. The challenge is managing
-  // the memory explosion.
+  // Sources are processed in blocks of brandes_block_width; the traversals of a block share the
+  // frontier and the edge sweeps, which keeps the GPUs busy in the early (and late) iterations
+  // where a single traversal has little work. A tagged frontier (tagging each vertex with its
+  // source, as in WCC) would allow more sources at once at the cost of a memory explosion.
   //
-  for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
-    //
-    //  BFS
-    //
-    constexpr size_t bucket_idx_cur = 0;
-    constexpr size_t num_buckets    = 2;
-
-    vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
-
-    if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
-      vertex_frontier.bucket(bucket_idx_cur)
-        .insert(vertices_begin + (source_idx - source_offsets[my_rank]),
-                vertices_begin + (source_idx - source_offsets[my_rank]) + 1);
-    }
+  for (size_t block_first = 0; block_first < num_sources; block_first += brandes_block_width) {
+    auto block_last = std::min(block_first + brandes_block_width, num_sources);
+
+    // the sources of this block assigned to this GPU
+    auto local_first = std::max(block_first, source_offsets[my_rank]);
+    auto local_last  = std::max(std::min(block_last, source_offsets[my_rank + 1]), local_first);
 
-    //
-    //  Now we need to do modified BFS
-    //
-    // FIXME:  This has an inefficiency in early iterations, as it doesn't have enough work to
-    //         keep the GPUs busy.  But we can't run too many at once or we will run out of
-    //         memory. Need to investigate options to improve this performance
-    auto [distance, sigma] =
-      brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
-    accumulate_vertex_results(handle,
-                              graph_view,
-                              edge_weight_view,
-                              raft::device_span<weight_t>{centralities.data(), centralities.size()},
-                              std::move(distance),
-                              std::move(sigma),
-                              include_endpoints,
-                              do_expensive_check);
+    rmm::device_uvector<vertex_t> block_sources(local_last - local_first, handle.get_stream());
+    rmm::device_uvector<size_t> block_source_lanes(block_sources.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 vertices_begin + (local_first - source_offsets[my_rank]),
+                 vertices_begin + (local_last - source_offsets[my_rank]),
+                 block_sources.begin());
+    thrust::sequence(handle.get_thrust_policy(),
+                     block_source_lanes.begin(),
+                     block_source_lanes.end(),
+                     local_first - block_first);
+
+    auto [distances, sigmas] = brandes_block_bfs(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t const>{block_sources.data(), block_sources.size()},
+      raft::device_span<size_t const>{block_source_lanes.data(), block_source_lanes.size()},
+      do_expensive_check);
+    accumulate_block_vertex_results(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<weight_t>{centralities.data(), centralities.size()},
+      std::move(distances),
+      std::move(sigmas),
+      include_endpoints,
+      do_expensive_check);
   }
 
   std::optional<weight_t> scale_factor{std::nullopt};
@@ -373,6 +766,201 @@ rmm::device_uvector<weight_t> betweenness_centrality(
   return centralities;
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, size_t, weight_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  weight_t const epsilon,
+  weight_t const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check)
+{
+  CUGRAPH_EXPECTS(epsilon > weight_t{0}, "Invalid input argument: epsilon should be positive.");
+  CUGRAPH_EXPECTS((delta > weight_t{0}) && (delta < weight_t{1}),
+                  "Invalid input argument: delta should be in (0.0, 1.0).");
+  CUGRAPH_EXPECTS(max_num_samples >= 2,
+                  "Invalid input argument: max_num_samples should be at least 2.");
+
+  if (do_expensive_check) {}
+
+  rmm::device_uvector<weight_t> centralities(graph_view.local_vertex_partition_range_size(),
+                                             handle.get_stream());
+
+  if (graph_view.number_of_vertices() == 0) {
+    return std::make_tuple(std::move(centralities), size_t{0}, weight_t{0});
+  }
+
+  //
+  // Adaptive sampling in the style of ABRA (Riondato & Upfal, 2018): the dependencies of a source
+  // drawn uniformly at random (with replacement), scaled by n / (the normalization factor of
+  // betweenness_centrality()), are an unbiased estimate of the exact centralities, bounded by
+  // sample_range.  Sources are drawn in geometrically growing rounds; after each round the
+  // empirical Bernstein bound (Maurer & Pontil, 2009) is evaluated for every vertex with the
+  // failure probability delta / (n * 2^(round + 1)).  The bound is two-sided (each side fails with
+  // probability delta / (2n * 2^(round + 1)), hence ln(4n * 2^(round + 1) / delta)), so the
+  // bounds of all the vertices in all the rounds hold together with probability at least 1 - delta.
+  //
+  auto const n = static_cast<double>(graph_view.number_of_vertices());
+
+  double normalization_factor{1.0};
+  if (normalized) {
+    if (graph_view.number_of_vertices() > 2) {
+      auto m               = include_endpoints ? n : n - 1.0;
+      normalization_factor = m * (m - 1.0);
+    }
+  } else if (graph_view.is_symmetric()) {
+    normalization_factor = 2.0;
+  }
+  auto const sample_scale = n / normalization_factor;
+  auto const sample_range = std::max(include_endpoints ? n - 1.0 : n - 2.0, 1.0) * sample_scale;
+
+  auto log_term = [n, delta](size_t round) {
+    return std::log(4.0 * n / static_cast<double>(delta)) +
+           static_cast<double>(round + 1) * std::log(2.0);
+  };
+
+  rmm::device_uvector<double> sums(centralities.size(), handle.get_stream());
+  rmm::device_uvector<double> square_sums(centralities.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> dependencies(centralities.size(), handle.get_stream());
+  detail::scalar_fill(handle, sums.data(), sums.size(), double{0});
+  detail::scalar_fill(handle, square_sums.data(), square_sums.size(), double{0});
+
+  // the first round draws the samples required to meet the bound if every variance were zero
+  size_t num_samples{0};
+  size_t round{0};
+  auto target_num_samples = std::min(
+    max_num_samples,
+    std::max(size_t{2},
+             static_cast<size_t>(
+               std::ceil(1.0 + 7.0 * sample_range * log_term(0) / (3.0 * epsilon)))));
+
+  while (true) {
+    auto sources = select_random_vertices(
+      handle, graph_view, rng_state, target_num_samples - num_samples, true, false);
+
+    size_t num_sources = sources.size();
+    std::vector<size_t> source_offsets{{0, num_sources}};
+    int my_rank = 0;
+
+    if constexpr (multi_gpu) {
+      auto source_counts =
+        host_scalar_allgather(handle.get_comms(), num_sources, handle.get_stream());
+
+      num_sources = std::accumulate(source_counts.begin(), source_counts.end(), size_t{0});
+      source_offsets.resize(source_counts.size() + 1);
+      source_offsets[0] = 0;
+      std::inclusive_scan(source_counts.begin(), source_counts.end(), source_offsets.begin() + 1);
+      my_rank = handle.get_comms().get_rank();
+    }
+
+    for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
+      constexpr size_t bucket_idx_cur = 0;
+      constexpr size_t num_buckets    = 2;
+
+      vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+
+      if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
+        vertex_frontier.bucket(bucket_idx_cur)
+          .insert(sources.begin() + (source_idx - source_offsets[my_rank]),
+                  sources.begin() + (source_idx - source_offsets[my_rank]) + 1);
+      }
+
+      auto [distance, sigma] =
+        brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
+
+      detail::scalar_fill(handle, dependencies.data(), dependencies.size(), weight_t{0});
+      accumulate_vertex_results(
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<weight_t>{dependencies.data(), dependencies.size()},
+        std::move(distance),
+        std::move(sigma),
+        include_endpoints,
+        do_expensive_check);
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(dependencies.size()),
+        [dependencies = dependencies.data(),
+         sums         = sums.data(),
+         square_sums  = square_sums.data(),
+         sample_scale] __device__(auto i) {
+          auto estimate = static_cast<double>(dependencies[i]) * sample_scale;
+          sums[i] += estimate;
+          square_sums[i] += estimate * estimate;
+        });
+    }
+
+    num_samples = target_num_samples;
+
+    auto k = static_cast<double>(num_samples);
+    auto t = log_term(round);
+
+    auto max_error_bound = transform_reduce_v(
+      handle,
+      graph_view,
+      thrust::make_zip_iterator(sums.begin(), square_sums.begin()),
+      [k, t, sample_range] __device__(auto, auto pair) {
+        auto variance =
+          (thrust::get<1>(pair) - thrust::get<0>(pair) * thrust::get<0>(pair) / k) / (k - 1.0);
+        if (variance < 0.0) { variance = 0.0; }  // round-off
+        return sqrt(2.0 * variance * t / k) + 7.0 * sample_range * t / (3.0 * (k - 1.0));
+      },
+      double{0},
+      reduce_op::maximum<double>{},
+      do_expensive_check);
+
+    if ((max_error_bound <= static_cast<double>(epsilon)) || (num_samples >= max_num_samples)) {
+      break;
+    }
+
+    target_num_samples = std::min(max_num_samples, num_samples * 2);
+    ++round;
+  }
+
+  //
+  // The achieved failure probability: the smallest delta for which epsilon still bounds the
+  // error of every vertex (solving the empirical Bernstein bound for the log term)
+  //
+  auto k = static_cast<double>(num_samples);
+
+  auto min_log_term = transform_reduce_v(
+    handle,
+    graph_view,
+    thrust::make_zip_iterator(sums.begin(), square_sums.begin()),
+    [k, epsilon = static_cast<double>(epsilon), sample_range] __device__(auto, auto pair) {
+      auto variance =
+        (thrust::get<1>(pair) - thrust::get<0>(pair) * thrust::get<0>(pair) / k) / (k - 1.0);
+      if (variance < 0.0) { variance = 0.0; }  // round-off
+      auto a = 7.0 * sample_range / (3.0 * (k - 1.0));
+      auto b = sqrt(2.0 * variance / k);
+      auto x = (-b + sqrt(b * b + 4.0 * a * epsilon)) / (2.0 * a);
+      return x * x;
+    },
+    std::numeric_limits<double>::max(),
+    reduce_op::minimum<double>{},
+    do_expensive_check);
+
+  auto achieved_delta = std::min(
+    1.0,
+    std::exp(std::log(4.0 * n) + static_cast<double>(round + 1) * std::log(2.0) - min_log_term));
+
+  thrust::transform(handle.get_thrust_policy(),
+                    sums.begin(),
+                    sums.end(),
+                    centralities.begin(),
+                    [k] __device__(auto sum) { return static_cast<weight_t>(sum / k); });
+
+  return std::make_tuple(
+    std::move(centralities), num_samples, static_cast<weight_t>(achieved_delta));
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -427,6 +1015,31 @@ rmm::device_uvector<weight_t> betweenness_centrality(
   }
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, size_t, weight_t> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  weight_t const epsilon,
+  weight_t const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check)
+{
+  return detail::adaptive_betweenness_centrality(handle,
+                                                 graph_view,
+                                                 edge_weight_view,
+                                                 rng_state,
+                                                 epsilon,
+                                                 delta,
+                                                 max_num_samples,
+                                                 normalized,
+                                                 include_endpoints,
+                                                 do_expensive_check);
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 rmm::device_uvector<weight_t> edge_betweenness_centrality(
   const raft::handle_t& handle,
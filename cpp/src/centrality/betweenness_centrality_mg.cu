@@ -73,6 +73,78 @@ template rmm::device_uvector<double> betweenness_centrality(
   bool const include_endpoints,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<float>, size_t, float> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  float const epsilon,
+  float const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<float>, size_t, float> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int32_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  float const epsilon,
+  float const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<float>, size_t, float> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  float const epsilon,
+  float const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, size_t, double> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  double const epsilon,
+  double const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, size_t, double> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int32_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  double const epsilon,
+  double const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, size_t, double> adaptive_betweenness_centrality(
+  const raft::handle_t& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::random::RngState& rng_state,
+  double const epsilon,
+  double const delta,
+  size_t const max_num_samples,
+  bool const normalized,
+  bool const include_endpoints,
+  bool const do_expensive_check);
+
 template rmm::device_uvector<float> edge_betweenness_centrality(
   const raft::handle_t& handle,
   graph_view_t<int32_t, int32_t, false, true> const& graph_view,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,8 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <optional>
+
 namespace cugraph {
 
 template <typename vertex_t, bool multi_gpu>
@@ -48,10 +50,17 @@ void partition_at_level(raft::handle_t const& handle,
                             dendrogram.get_level_size_nocheck(l),
                             dendrogram.get_level_first_index_nocheck(l));
 
+      // read a spilled level only for the duration of this iteration
+      std::optional<rmm::device_uvector<vertex_t>> spilled_level{std::nullopt};
+      if (!dendrogram.is_level_resident(l)) {
+        spilled_level = dendrogram.read_level(l, handle.get_stream());
+      }
+
       cugraph::relabel<vertex_t, multi_gpu>(
         handle,
-        std::tuple<vertex_t const*, vertex_t const*>(local_vertex_ids_v.data(),
-                                                     dendrogram.get_level_ptr_nocheck(l)),
+        std::tuple<vertex_t const*, vertex_t const*>(
+          local_vertex_ids_v.data(),
+          spilled_level ? (*spilled_level).data() : dendrogram.get_level_ptr_nocheck(l)),
         dendrogram.get_level_size_nocheck(l),
         d_partition,
         local_num_verts,
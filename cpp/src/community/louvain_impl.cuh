@@ -31,6 +31,9 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
+#include <string>
+
 namespace cugraph {
 
 namespace detail {
@@ -49,7 +52,8 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   size_t max_level,
-  weight_t resolution)
+  weight_t resolution,
+  std::optional<std::string> const& dendrogram_file_path = std::nullopt)
 {
   using graph_t      = cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>;
   using graph_view_t = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
@@ -57,6 +61,7 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
 
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram = std::make_unique<Dendrogram<vertex_t>>();
+  if (dendrogram_file_path) { dendrogram->spill_levels_to_file(*dendrogram_file_path); }
   graph_t current_graph(handle);
   graph_view_t current_graph_view(graph_view);
   std::optional<edge_property_t<graph_view_t, weight_t>> current_edge_weights(handle);
@@ -265,6 +270,8 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   detail::timer_display<graph_view_t::is_multi_gpu>(handle, hr_timer, std::cout);
 #endif
 
+  if (dendrogram_file_path) { dendrogram->flush(handle.get_stream()); }
+
   return std::make_pair(std::move(dendrogram), best_modularity);
 }
 
@@ -285,6 +292,32 @@ void flatten_dendrogram(raft::handle_t const& handle,
     handle, dendrogram, vertex_ids_v.data(), clustering, dendrogram.num_levels());
 }
 
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void flatten_dendrogram(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        Dendrogram<vertex_t> const& dendrogram,
+                        vertex_t* clustering,
+                        size_t level)
+{
+  CUGRAPH_EXPECTS(level <= dendrogram.num_levels(),
+                  "Invalid input argument: level should not exceed the number of levels.");
+
+  rmm::device_uvector<vertex_t> vertex_ids_v(graph_view.local_vertex_partition_range_size(),
+                                             handle.get_stream());
+
+  detail::sequence_fill(handle.get_stream(),
+                        vertex_ids_v.begin(),
+                        vertex_ids_v.size(),
+                        graph_view.local_vertex_partition_range_first());
+
+  if (level == 0) {
+    raft::copy(clustering, vertex_ids_v.data(), vertex_ids_v.size(), handle.get_stream());
+  } else {
+    partition_at_level<vertex_t, multi_gpu>(
+      handle, dendrogram, vertex_ids_v.data(), clustering, level);
+  }
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -299,6 +332,20 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   return detail::louvain(handle, graph_view, edge_weight_view, max_level, resolution);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& dendrogram_file_path,
+  size_t max_level,
+  weight_t resolution)
+{
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  return detail::louvain(
+    handle, graph_view, edge_weight_view, max_level, resolution, dendrogram_file_path);
+}
+
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 void flatten_dendrogram(raft::handle_t const& handle,
                         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
@@ -308,6 +355,16 @@ void flatten_dendrogram(raft::handle_t const& handle,
   detail::flatten_dendrogram(handle, graph_view, dendrogram, clustering);
 }
 
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void flatten_dendrogram(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        Dendrogram<vertex_t> const& dendrogram,
+                        vertex_t* clustering,
+                        size_t level)
+{
+  detail::flatten_dendrogram(handle, graph_view, dendrogram, clustering, level);
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::pair<size_t, weight_t> louvain(
   raft::handle_t const& handle,
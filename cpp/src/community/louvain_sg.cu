@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -100,4 +100,63 @@ template std::pair<size_t, double> louvain(
   size_t,
   double);
 
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  std::string const&,
+  size_t,
+  float);
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, false, false> const&,
+  std::optional<edge_property_view_t<int64_t, float const*>>,
+  std::string const&,
+  size_t,
+  float);
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, false, false> const&,
+  std::optional<edge_property_view_t<int64_t, float const*>>,
+  std::string const&,
+  size_t,
+  float);
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  std::string const&,
+  size_t,
+  double);
+template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int32_t, int64_t, false, false> const&,
+  std::optional<edge_property_view_t<int64_t, double const*>>,
+  std::string const&,
+  size_t,
+  double);
+template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
+  raft::handle_t const&,
+  graph_view_t<int64_t, int64_t, false, false> const&,
+  std::optional<edge_property_view_t<int64_t, double const*>>,
+  std::string const&,
+  size_t,
+  double);
+
+template void flatten_dendrogram(raft::handle_t const&,
+                                 graph_view_t<int32_t, int32_t, false, false> const&,
+                                 Dendrogram<int32_t> const&,
+                                 int32_t*,
+                                 size_t);
+template void flatten_dendrogram(raft::handle_t const&,
+                                 graph_view_t<int32_t, int64_t, false, false> const&,
+                                 Dendrogram<int32_t> const&,
+                                 int32_t*,
+                                 size_t);
+template void flatten_dendrogram(raft::handle_t const&,
+                                 graph_view_t<int64_t, int64_t, false, false> const&,
+                                 Dendrogram<int64_t> const&,
+                                 int64_t*,
+                                 size_t);
+
 }  // namespace cugraph
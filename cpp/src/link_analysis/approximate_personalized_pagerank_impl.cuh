@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/count_if_e.cuh>
+#include <prims/count_if_v.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_edge_src_dst_property.cuh>
+#include <prims/update_v_frontier.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// a vertex is pushed if its residual reaches epsilon times its out-going edge weight sum (or
+// epsilon for the vertices without out-going edges)
+template <typename weight_t, typename result_t>
+__host__ __device__ result_t push_threshold(result_t epsilon, weight_t out_weight_sum)
+{
+  return out_weight_sum > weight_t{0.0} ? epsilon * static_cast<result_t>(out_weight_sum)
+                                        : epsilon;
+}
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct dangling_residual_t {
+  vertex_t local_vertex_partition_range_first{};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t const* residuals{nullptr};
+
+  __device__ result_t operator()(vertex_t v) const
+  {
+    auto v_offset = v - local_vertex_partition_range_first;
+    return vertex_out_weight_sums[v_offset] == weight_t{0.0} ? residuals[v_offset]
+                                                             : result_t{0.0};
+  }
+};
+
+// move (1 - alpha) of the residual to the estimate and set the per unit out-going edge weight
+// value to push to the out-neighbors
+template <typename vertex_t, typename weight_t, typename result_t>
+struct settle_residual_t {
+  vertex_t local_vertex_partition_range_first{};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t* estimates{nullptr};
+  result_t* residuals{nullptr};
+  result_t* push_values{nullptr};
+  result_t alpha{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto v_offset       = v - local_vertex_partition_range_first;
+    auto residual       = residuals[v_offset];
+    auto out_weight_sum = vertex_out_weight_sums[v_offset];
+    estimates[v_offset] += (result_t{1.0} - alpha) * residual;
+    residuals[v_offset] = result_t{0.0};
+    push_values[v_offset] =
+      out_weight_sum > weight_t{0.0} ? alpha * residual / static_cast<result_t>(out_weight_sum)
+                                     : result_t{0.0};
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct push_e_op_t {
+  template <typename EdgeValue>
+  __device__ thrust::optional<result_t> operator()(
+    vertex_t, vertex_t, result_t src_val, thrust::nullopt_t, EdgeValue w) const
+  {
+    if constexpr (std::is_same_v<EdgeValue, thrust::nullopt_t>) {
+      return src_val;
+    } else {
+      return src_val * static_cast<result_t>(w);
+    }
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct push_v_op_t {
+  vertex_t local_vertex_partition_range_first{};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t epsilon{};
+  size_t bucket_idx_next{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>, thrust::optional<result_t>> operator()(
+    vertex_t v, result_t v_val, result_t pushed_val) const
+  {
+    auto new_residual = v_val + pushed_val;
+    auto threshold    = push_threshold(
+      epsilon, vertex_out_weight_sums[v - local_vertex_partition_range_first]);
+    return thrust::make_tuple(new_residual >= threshold ? thrust::optional<size_t>{bucket_idx_next}
+                                                        : thrust::nullopt,
+                              thrust::optional<result_t>{new_residual});
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>, rmm::device_uvector<result_t>>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  typename GraphViewType::vertex_type seed,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_local_vertices = push_graph_view.local_vertex_partition_range_size();
+  auto const local_vertex_partition_range_first =
+    push_graph_view.local_vertex_partition_range_first();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(seed),
+                  "Invalid input argument: seed vertex out-of-range.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    if (precomputed_vertex_out_weight_sums) {
+      auto num_negative_precomputed_vertex_out_weight_sums =
+        count_if_v(handle,
+                   push_graph_view,
+                   *precomputed_vertex_out_weight_sums,
+                   [] __device__(auto, auto val) { return val < weight_t{0.0}; });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (edge_weight_view) {
+      auto num_negative_edge_weights =
+        count_if_e(handle,
+                   push_graph_view,
+                   edge_src_dummy_property_t{}.view(),
+                   edge_dst_dummy_property_t{}.view(),
+                   *edge_weight_view,
+                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+      CUGRAPH_EXPECTS(
+        num_negative_edge_weights == 0,
+        "Invalid input argument: input edge weights should have non-negative values.");
+    }
+  }
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
+  if (!precomputed_vertex_out_weight_sums) {
+    if (edge_weight_view) {
+      tmp_vertex_out_weight_sums =
+        compute_out_weight_sums(handle, push_graph_view, *edge_weight_view);
+    } else {
+      auto tmp_vertex_out_degrees = push_graph_view.compute_out_degrees(handle);
+      tmp_vertex_out_weight_sums =
+        rmm::device_uvector<weight_t>(tmp_vertex_out_degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        tmp_vertex_out_degrees.begin(),
+                        tmp_vertex_out_degrees.end(),
+                        (*tmp_vertex_out_weight_sums).begin(),
+                        detail::typecast_t<edge_t, weight_t>{});
+    }
+  }
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                  ? *precomputed_vertex_out_weight_sums
+                                  : (*tmp_vertex_out_weight_sums).data();
+
+  // 3. initialize the estimates & residuals, and the frontier
+
+  constexpr size_t bucket_idx_cur    = 0;
+  constexpr size_t bucket_idx_next   = 1;
+  constexpr size_t bucket_idx_pushed = 2;  // the vertices pushed at least once
+  constexpr size_t num_buckets       = 3;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
+                                                                                       num_buckets);
+
+  rmm::device_uvector<result_t> estimates(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> residuals(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> push_values(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), estimates.begin(), estimates.end(), result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+
+  auto edge_src_push_values =
+    GraphViewType::is_multi_gpu
+      ? edge_src_property_t<GraphViewType, result_t>(handle, push_graph_view)
+      : edge_src_property_t<GraphViewType, result_t>(handle);
+
+  auto const is_seed_local = push_graph_view.in_local_vertex_partition_range_nocheck(seed);
+  auto const seed_offset   = seed - local_vertex_partition_range_first;
+  weight_t seed_out_weight_sum{0.0};
+  if (is_seed_local) {
+    residuals.set_element(seed_offset, result_t{1.0}, handle.get_stream());
+    raft::update_host(
+      &seed_out_weight_sum, vertex_out_weight_sums + seed_offset, 1, handle.get_stream());
+    handle.sync_stream();
+    vertex_frontier.bucket(bucket_idx_cur).insert(seed);
+  }
+
+  // 4. push until every residual falls below the threshold
+
+  while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+    auto& cur_bucket = vertex_frontier.bucket(bucket_idx_cur);
+
+    // the residuals of the vertices without out-going edges return to the seed
+
+    auto dangling_sum = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      cur_bucket.begin(),
+      cur_bucket.end(),
+      dangling_residual_t<vertex_t, weight_t, result_t>{
+        local_vertex_partition_range_first, vertex_out_weight_sums, residuals.data()},
+      result_t{0.0},
+      thrust::plus<result_t>{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      dangling_sum = host_scalar_allreduce(
+        handle.get_comms(), dangling_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     cur_bucket.begin(),
+                     cur_bucket.end(),
+                     settle_residual_t<vertex_t, weight_t, result_t>{
+                       local_vertex_partition_range_first,
+                       vertex_out_weight_sums,
+                       estimates.data(),
+                       residuals.data(),
+                       push_values.data(),
+                       alpha});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_src_property(handle,
+                               push_graph_view,
+                               cur_bucket.begin(),
+                               cur_bucket.end(),
+                               push_values.data(),
+                               edge_src_push_values);
+    }
+
+    auto edge_src_value_view =
+      GraphViewType::is_multi_gpu
+        ? edge_src_push_values.view()
+        : detail::edge_major_property_view_t<vertex_t, result_t const*>(push_values.data());
+    auto [new_frontier_vertex_buffer, pushed_value_buffer] =
+      edge_weight_view
+        ? transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                        push_graph_view,
+                                                        cur_bucket,
+                                                        edge_src_value_view,
+                                                        edge_dst_dummy_property_t{}.view(),
+                                                        *edge_weight_view,
+                                                        push_e_op_t<vertex_t, result_t>{},
+                                                        reduce_op::plus<result_t>{})
+        : transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                        push_graph_view,
+                                                        cur_bucket,
+                                                        edge_src_value_view,
+                                                        edge_dst_dummy_property_t{}.view(),
+                                                        edge_dummy_property_t{}.view(),
+                                                        push_e_op_t<vertex_t, result_t>{},
+                                                        reduce_op::plus<result_t>{});
+
+    vertex_frontier.bucket(bucket_idx_pushed).insert(cur_bucket.begin(), cur_bucket.end());
+    cur_bucket.clear();
+    cur_bucket.shrink_to_fit();
+
+    if ((dangling_sum > result_t{0.0}) && is_seed_local) {
+      auto seed_residual = residuals.element(seed_offset, handle.get_stream());
+      seed_residual += alpha * dangling_sum;
+      residuals.set_element(seed_offset, seed_residual, handle.get_stream());
+      handle.sync_stream();
+      if (seed_residual >= push_threshold(epsilon, seed_out_weight_sum)) {
+        vertex_frontier.bucket(bucket_idx_next).insert(seed);
+      }
+    }
+
+    update_v_frontier(handle,
+                      push_graph_view,
+                      std::move(new_frontier_vertex_buffer),
+                      std::move(pushed_value_buffer),
+                      vertex_frontier,
+                      std::vector<size_t>{bucket_idx_next},
+                      residuals.data(),
+                      residuals.data(),
+                      push_v_op_t<vertex_t, weight_t, result_t>{local_vertex_partition_range_first,
+                                                                vertex_out_weight_sums,
+                                                                epsilon,
+                                                                bucket_idx_next});
+
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+  }
+
+  // 5. collect the (sparse) estimates
+
+  auto const& pushed_bucket = vertex_frontier.bucket(bucket_idx_pushed);
+  rmm::device_uvector<vertex_t> vertices(pushed_bucket.size(), handle.get_stream());
+  rmm::device_uvector<result_t> scores(vertices.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), pushed_bucket.begin(), pushed_bucket.end(), vertices.begin());
+  thrust::transform(handle.get_thrust_policy(),
+                    vertices.begin(),
+                    vertices.end(),
+                    scores.begin(),
+                    [local_vertex_partition_range_first,
+                     estimates = estimates.data()] __device__(auto v) {
+                      return estimates[v - local_vertex_partition_range_first];
+                    });
+
+  return std::make_tuple(std::move(vertices), std::move(scores));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<result_t>>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  vertex_t seed,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check)
+{
+  return detail::approximate_personalized_pagerank(handle,
+                                                   graph_view,
+                                                   edge_weight_view,
+                                                   precomputed_vertex_out_weight_sums,
+                                                   seed,
+                                                   alpha,
+                                                   epsilon,
+                                                   do_expensive_check);
+}
+
+}  // namespace cugraph
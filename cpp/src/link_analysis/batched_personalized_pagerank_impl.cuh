@@ -0,0 +1,699 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/count_if_e.cuh>
+#include <prims/count_if_v.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/update_edge_src_dst_property.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// score vectors are iterated in blocks (one edge sweep per block), a block holds one score vector
+// per lane
+template <typename result_t>
+using ppr_block_t =
+  thrust::tuple<result_t, result_t, result_t, result_t, result_t, result_t, result_t, result_t>;
+
+constexpr size_t ppr_block_width = thrust::tuple_size<ppr_block_t<float>>::value;
+
+// the personalization sets assigned to the lanes of a block
+struct ppr_block_columns_t {
+  size_t columns[ppr_block_width]{};
+  size_t entry_offsets[ppr_block_width + 1]{};  // prefix sums of the personalization set sizes
+  size_t num_columns{0};
+  size_t active_column_idx_first{0};  // position of the first lane's set in the active set list
+};
+
+template <typename T, size_t... Is>
+auto make_lane_zip_iterator(T* first, size_t lane_size, std::index_sequence<Is...>)
+{
+  return thrust::make_zip_iterator(thrust::make_tuple((first + Is * lane_size)...));
+}
+
+template <typename result_t, size_t... Is>
+__device__ ppr_block_t<result_t> scale_block(ppr_block_t<result_t> const& block,
+                                             result_t scale,
+                                             std::index_sequence<Is...>)
+{
+  return thrust::make_tuple((thrust::get<Is>(block) * scale)...);
+}
+
+template <typename vertex_t, typename result_t>
+struct ppr_e_op_t {
+  result_t alpha{};
+
+  template <typename EdgeValue>
+  __device__ ppr_block_t<result_t> operator()(
+    vertex_t, vertex_t, ppr_block_t<result_t> src_vals, thrust::nullopt_t, EdgeValue w) const
+  {
+    auto scale = alpha;
+    if constexpr (!std::is_same_v<EdgeValue, thrust::nullopt_t>) {
+      scale *= static_cast<result_t>(w);
+    }
+    return scale_block(src_vals, scale, std::make_index_sequence<ppr_block_width>{});
+  }
+};
+
+// personalization set index of an entry in the CSR-like personalization set list
+struct entry_column_t {
+  size_t const* offsets{nullptr};
+  size_t num_columns{0};
+
+  __device__ size_t operator()(size_t entry_idx) const
+  {
+    return static_cast<size_t>(thrust::distance(
+      offsets + 1,
+      thrust::upper_bound(thrust::seq, offsets + 1, offsets + (num_columns + 1), entry_idx)));
+  }
+};
+
+struct divide_by_t {
+  size_t divisor{1};
+
+  __device__ size_t operator()(size_t i) const { return i / divisor; }
+};
+
+template <typename result_t, typename weight_t>
+struct ppr_scaled_block_value_t {
+  ppr_block_columns_t block_columns{};
+  result_t const* pageranks{nullptr};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  size_t num_local_vertices{0};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto lane   = i / num_local_vertices;
+    auto offset = i % num_local_vertices;
+    if (lane >= block_columns.num_columns) { return result_t{0.0}; }
+    auto out_weight_sum = static_cast<result_t>(vertex_out_weight_sums[offset]);
+    auto divisor        = out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
+    return pageranks[block_columns.columns[lane] * num_local_vertices + offset] / divisor;
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct ppr_dangling_value_t {
+  size_t const* active_columns{nullptr};
+  vertex_t const* dangling_vertex_offsets{nullptr};
+  result_t const* pageranks{nullptr};
+  size_t num_dangling_vertices{0};
+  size_t num_local_vertices{0};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto column = active_columns[i / num_dangling_vertices];
+    auto offset = static_cast<size_t>(dangling_vertex_offsets[i % num_dangling_vertices]);
+    return pageranks[column * num_local_vertices + offset];
+  }
+};
+
+template <typename vertex_t, typename result_t, bool multi_gpu>
+struct ppr_teleport_t {
+  ppr_block_columns_t block_columns{};
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition;
+  size_t const* personalization_offsets{nullptr};
+  vertex_t const* personalization_vertices{nullptr};
+  result_t const* normalized_personalization_values{nullptr};
+  result_t const* dangling_sums{nullptr};
+  result_t alpha{};
+  result_t* new_block{nullptr};
+  size_t num_local_vertices{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    size_t lane{0};
+    while (i >= block_columns.entry_offsets[lane + 1]) {
+      ++lane;
+    }
+    auto entry_idx    = personalization_offsets[block_columns.columns[lane]] +
+                     (i - block_columns.entry_offsets[lane]);
+    auto offset       = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(
+      personalization_vertices[entry_idx]);
+    auto dangling_sum = dangling_sums[block_columns.active_column_idx_first + lane];
+    new_block[lane * num_local_vertices + offset] +=
+      (dangling_sum * alpha + (result_t{1.0} - alpha)) *
+      normalized_personalization_values[entry_idx];
+  }
+};
+
+template <typename result_t>
+struct ppr_block_diff_t {
+  ppr_block_columns_t block_columns{};
+  result_t const* new_block{nullptr};
+  result_t const* pageranks{nullptr};
+  size_t num_local_vertices{0};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto lane         = i / num_local_vertices;
+    auto offset       = i % num_local_vertices;
+    auto old_pagerank = pageranks[block_columns.columns[lane] * num_local_vertices + offset];
+    return new_block[i] < old_pagerank ? old_pagerank - new_block[i] : new_block[i] - old_pagerank;
+  }
+};
+
+template <typename result_t>
+struct ppr_block_store_t {
+  ppr_block_columns_t block_columns{};
+  result_t const* new_block{nullptr};
+  result_t* pageranks{nullptr};
+  size_t num_local_vertices{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto lane   = i / num_local_vertices;
+    auto offset = i % num_local_vertices;
+    pageranks[block_columns.columns[lane] * num_local_vertices + offset] = new_block[i];
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename weight_t, typename result_t>
+void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<typename GraphViewType::vertex_type const> personalization_vertices,
+  std::optional<raft::device_span<result_t const>> personalization_values,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_storage_transposed,
+                "GraphViewType should support the pull model.");
+
+  auto const num_local_vertices =
+    static_cast<size_t>(pull_graph_view.local_vertex_partition_range_size());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(personalization_offsets.size() > 0,
+                  "Invalid input argument: personalization_offsets should have at least one "
+                  "element.");
+  CUGRAPH_EXPECTS(
+    !personalization_values ||
+      ((*personalization_values).size() == personalization_vertices.size()),
+    "Invalid input argument: personalization_values.size() should coincide with "
+    "personalization_vertices.size().");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  auto const num_columns = personalization_offsets.size() - 1;
+  std::vector<size_t> h_personalization_offsets(personalization_offsets.size());
+  raft::update_host(h_personalization_offsets.data(),
+                    personalization_offsets.data(),
+                    personalization_offsets.size(),
+                    handle.get_stream());
+  handle.sync_stream();
+  CUGRAPH_EXPECTS((h_personalization_offsets.front() == 0) &&
+                    (h_personalization_offsets.back() == personalization_vertices.size()),
+                  "Invalid input argument: personalization_offsets should start from 0 and end "
+                  "with personalization_vertices.size().");
+
+  if (do_expensive_check) {
+    if (precomputed_vertex_out_weight_sums) {
+      auto num_negative_precomputed_vertex_out_weight_sums =
+        count_if_v(handle,
+                   pull_graph_view,
+                   *precomputed_vertex_out_weight_sums,
+                   [] __device__(auto, auto val) { return val < weight_t{0.0}; });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (edge_weight_view) {
+      auto num_negative_edge_weights =
+        count_if_e(handle,
+                   pull_graph_view,
+                   edge_src_dummy_property_t{}.view(),
+                   edge_dst_dummy_property_t{}.view(),
+                   *edge_weight_view,
+                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+      CUGRAPH_EXPECTS(
+        num_negative_edge_weights == 0,
+        "Invalid input argument: input edge weights should have non-negative values.");
+    }
+
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(),
+                                      personalization_offsets.begin(),
+                                      personalization_offsets.end()),
+                    "Invalid input argument: personalization_offsets should be non-decreasing.");
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto min_num_columns = host_scalar_allreduce(
+        handle.get_comms(), num_columns, raft::comms::op_t::MIN, handle.get_stream());
+      auto max_num_columns = host_scalar_allreduce(
+        handle.get_comms(), num_columns, raft::comms::op_t::MAX, handle.get_stream());
+      CUGRAPH_EXPECTS(min_num_columns == max_num_columns,
+                      "Invalid input argument: every GPU should provide the same number of "
+                      "personalization sets.");
+    }
+
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      pull_graph_view.local_vertex_partition_view());
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       personalization_vertices.begin(),
+                       personalization_vertices.end(),
+                       [vertex_partition] __device__(auto val) {
+                         return !(vertex_partition.is_valid_vertex(val) &&
+                                  vertex_partition.in_local_vertex_partition_range_nocheck(val));
+                       });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: personalization vertices have invalid vertex IDs.");
+
+    if (personalization_values) {
+      auto num_negative_values = thrust::count_if(handle.get_thrust_policy(),
+                                                  (*personalization_values).begin(),
+                                                  (*personalization_values).end(),
+                                                  [] __device__(auto val) { return val < 0.0; });
+      if constexpr (GraphViewType::is_multi_gpu) {
+        num_negative_values = host_scalar_allreduce(
+          handle.get_comms(), num_negative_values, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: personalization values should be non-negative.");
+    }
+  }
+
+  if ((num_columns == 0) || (pull_graph_view.number_of_vertices() == 0)) { return; }
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
+  if (!precomputed_vertex_out_weight_sums) {
+    if (edge_weight_view) {
+      tmp_vertex_out_weight_sums =
+        compute_out_weight_sums(handle, pull_graph_view, *edge_weight_view);
+    } else {
+      auto tmp_vertex_out_degrees = pull_graph_view.compute_out_degrees(handle);
+      tmp_vertex_out_weight_sums =
+        rmm::device_uvector<weight_t>(tmp_vertex_out_degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        tmp_vertex_out_degrees.begin(),
+                        tmp_vertex_out_degrees.end(),
+                        (*tmp_vertex_out_weight_sums).begin(),
+                        detail::typecast_t<edge_t, weight_t>{});
+    }
+  }
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                  ? *precomputed_vertex_out_weight_sums
+                                  : (*tmp_vertex_out_weight_sums).data();
+
+  rmm::device_uvector<vertex_t> dangling_vertex_offsets(num_local_vertices, handle.get_stream());
+  dangling_vertex_offsets.resize(
+    thrust::distance(dangling_vertex_offsets.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(vertex_t{0}),
+                                     thrust::make_counting_iterator(
+                                       static_cast<vertex_t>(num_local_vertices)),
+                                     vertex_out_weight_sums,
+                                     dangling_vertex_offsets.begin(),
+                                     [] __device__(auto out_weight_sum) {
+                                       return out_weight_sum == weight_t{0.0};
+                                     })),
+    handle.get_stream());
+
+  // 3. normalize the personalization values (per set)
+
+  auto const num_entries = personalization_vertices.size();
+  auto entry_column      = entry_column_t{personalization_offsets.data(), num_columns};
+
+  rmm::device_uvector<result_t> normalized_personalization_values(num_entries,
+                                                                  handle.get_stream());
+  if (personalization_values) {
+    thrust::copy(handle.get_thrust_policy(),
+                 (*personalization_values).begin(),
+                 (*personalization_values).end(),
+                 normalized_personalization_values.begin());
+  } else {
+    thrust::fill(handle.get_thrust_policy(),
+                 normalized_personalization_values.begin(),
+                 normalized_personalization_values.end(),
+                 result_t{1.0});
+  }
+
+  rmm::device_uvector<result_t> personalization_sums(num_columns, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               personalization_sums.begin(),
+               personalization_sums.end(),
+               result_t{0.0});
+  {
+    rmm::device_uvector<size_t> tmp_columns(num_columns, handle.get_stream());
+    rmm::device_uvector<result_t> tmp_sums(num_columns, handle.get_stream());
+    auto column_first =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}), entry_column);
+    auto num_nonempty_columns = static_cast<size_t>(thrust::distance(
+      tmp_columns.begin(),
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           column_first,
+                                           column_first + num_entries,
+                                           normalized_personalization_values.begin(),
+                                           tmp_columns.begin(),
+                                           tmp_sums.begin()))));
+    thrust::scatter(handle.get_thrust_policy(),
+                    tmp_sums.begin(),
+                    tmp_sums.begin() + num_nonempty_columns,
+                    tmp_columns.begin(),
+                    personalization_sums.begin());
+  }
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     personalization_sums.data(),
+                     personalization_sums.data(),
+                     num_columns,
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                   personalization_sums.begin(),
+                                   personalization_sums.end(),
+                                   [] __device__(auto sum) { return !(sum > result_t{0.0}); }) ==
+                    0,
+                  "Invalid input argument: sum of the personalization values of every set should "
+                  "be positive.");
+
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_entries),
+    [entry_column,
+     personalization_sums = personalization_sums.data(),
+     values               = normalized_personalization_values.data()] __device__(auto i) {
+      values[i] /= personalization_sums[entry_column(i)];
+    });
+
+  // 4. initialize pagerank values (to the normalized personalization vectors)
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    pull_graph_view.local_vertex_partition_view());
+
+  thrust::fill(handle.get_thrust_policy(),
+               pageranks,
+               pageranks + num_columns * num_local_vertices,
+               result_t{0.0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_entries),
+                   [entry_column,
+                    vertex_partition,
+                    vertices = personalization_vertices.data(),
+                    values   = normalized_personalization_values.data(),
+                    pageranks,
+                    num_local_vertices] __device__(auto i) {
+                     pageranks[entry_column(i) * num_local_vertices +
+                               vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(
+                                 vertices[i])] = values[i];
+                   });
+
+  // 5. pagerank iteration (the blocks are re-packed every iteration with the sets that have not
+  // converged yet)
+
+  std::vector<size_t> h_active_columns(num_columns);
+  std::iota(h_active_columns.begin(), h_active_columns.end(), size_t{0});
+
+  rmm::device_uvector<size_t> active_columns(num_columns, handle.get_stream());
+  rmm::device_uvector<result_t> dangling_sums(num_columns, handle.get_stream());
+  rmm::device_uvector<result_t> diff_sums(num_columns, handle.get_stream());
+  rmm::device_uvector<result_t> scaled_block(ppr_block_width * num_local_vertices,
+                                             handle.get_stream());
+  rmm::device_uvector<result_t> new_block(ppr_block_width * num_local_vertices,
+                                          handle.get_stream());
+  edge_src_property_t<GraphViewType, ppr_block_t<result_t>> edge_src_blocks(handle,
+                                                                             pull_graph_view);
+  std::vector<result_t> h_diff_sums{};
+  size_t iter{0};
+  while (true) {
+    auto const num_active_columns = h_active_columns.size();
+    raft::update_device(
+      active_columns.data(), h_active_columns.data(), num_active_columns, handle.get_stream());
+
+    // the sums of the scores of the dangling vertices (redistributed by the personalization
+    // vectors)
+
+    thrust::fill(handle.get_thrust_policy(),
+                 dangling_sums.begin(),
+                 dangling_sums.begin() + num_active_columns,
+                 result_t{0.0});
+    if (dangling_vertex_offsets.size() > 0) {
+      auto key_first = thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                                       divide_by_t{dangling_vertex_offsets.size()});
+      auto value_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        ppr_dangling_value_t<vertex_t, result_t>{active_columns.data(),
+                                                 dangling_vertex_offsets.data(),
+                                                 pageranks,
+                                                 dangling_vertex_offsets.size(),
+                                                 num_local_vertices});
+      thrust::reduce_by_key(handle.get_thrust_policy(),
+                            key_first,
+                            key_first + num_active_columns * dangling_vertex_offsets.size(),
+                            value_first,
+                            thrust::make_discard_iterator(),
+                            dangling_sums.begin());
+    }
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       dangling_sums.data(),
+                       dangling_sums.data(),
+                       num_active_columns,
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    thrust::fill(handle.get_thrust_policy(),
+                 diff_sums.begin(),
+                 diff_sums.begin() + num_active_columns,
+                 result_t{0.0});
+    for (size_t block_first = 0; block_first < num_active_columns;
+         block_first += ppr_block_width) {
+      ppr_block_columns_t block_columns{};
+      block_columns.num_columns = std::min(ppr_block_width, num_active_columns - block_first);
+      block_columns.active_column_idx_first = block_first;
+      for (size_t i = 0; i < block_columns.num_columns; ++i) {
+        auto column                        = h_active_columns[block_first + i];
+        block_columns.columns[i]           = column;
+        block_columns.entry_offsets[i + 1] = block_columns.entry_offsets[i] +
+                                             (h_personalization_offsets[column + 1] -
+                                              h_personalization_offsets[column]);
+      }
+      for (size_t i = block_columns.num_columns; i < ppr_block_width; ++i) {
+        block_columns.entry_offsets[i + 1] = block_columns.entry_offsets[i];
+      }
+
+      thrust::tabulate(handle.get_thrust_policy(),
+                       scaled_block.begin(),
+                       scaled_block.end(),
+                       ppr_scaled_block_value_t<result_t, weight_t>{
+                         block_columns, pageranks, vertex_out_weight_sums, num_local_vertices});
+      update_edge_src_property(
+        handle,
+        pull_graph_view,
+        make_lane_zip_iterator(scaled_block.data(),
+                               num_local_vertices,
+                               std::make_index_sequence<ppr_block_width>{}),
+        edge_src_blocks);
+
+      auto new_block_first = make_lane_zip_iterator(
+        new_block.data(), num_local_vertices, std::make_index_sequence<ppr_block_width>{});
+      if (edge_weight_view) {
+        per_v_transform_reduce_incoming_e(handle,
+                                          pull_graph_view,
+                                          edge_src_blocks.view(),
+                                          edge_dst_dummy_property_t{}.view(),
+                                          *edge_weight_view,
+                                          ppr_e_op_t<vertex_t, result_t>{alpha},
+                                          ppr_block_t<result_t>{},
+                                          reduce_op::plus<ppr_block_t<result_t>>{},
+                                          new_block_first);
+      } else {
+        per_v_transform_reduce_incoming_e(handle,
+                                          pull_graph_view,
+                                          edge_src_blocks.view(),
+                                          edge_dst_dummy_property_t{}.view(),
+                                          edge_dummy_property_t{}.view(),
+                                          ppr_e_op_t<vertex_t, result_t>{alpha},
+                                          ppr_block_t<result_t>{},
+                                          reduce_op::plus<ppr_block_t<result_t>>{},
+                                          new_block_first);
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(block_columns.entry_offsets[block_columns.num_columns]),
+        ppr_teleport_t<vertex_t, result_t, GraphViewType::is_multi_gpu>{
+          block_columns,
+          vertex_partition,
+          personalization_offsets.data(),
+          personalization_vertices.data(),
+          normalized_personalization_values.data(),
+          dangling_sums.data(),
+          alpha,
+          new_block.data(),
+          num_local_vertices});
+
+      if (num_local_vertices > 0) {
+        auto key_first = thrust::make_transform_iterator(
+          thrust::make_counting_iterator(size_t{0}), divide_by_t{num_local_vertices});
+        auto value_first = thrust::make_transform_iterator(
+          thrust::make_counting_iterator(size_t{0}),
+          ppr_block_diff_t<result_t>{
+            block_columns, new_block.data(), pageranks, num_local_vertices});
+        thrust::reduce_by_key(handle.get_thrust_policy(),
+                              key_first,
+                              key_first + block_columns.num_columns * num_local_vertices,
+                              value_first,
+                              thrust::make_discard_iterator(),
+                              diff_sums.begin() + block_first);
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(block_columns.num_columns * num_local_vertices),
+        ppr_block_store_t<result_t>{
+          block_columns, new_block.data(), pageranks, num_local_vertices});
+    }
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       diff_sums.data(),
+                       diff_sums.data(),
+                       num_active_columns,
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+    h_diff_sums.resize(num_active_columns);
+    raft::update_host(
+      h_diff_sums.data(), diff_sums.data(), num_active_columns, handle.get_stream());
+    handle.sync_stream();
+
+    size_t num_unconverged_columns{0};
+    for (size_t i = 0; i < num_active_columns; ++i) {
+      if (h_diff_sums[i] >= epsilon) {
+        h_active_columns[num_unconverged_columns++] = h_active_columns[i];
+      }
+    }
+    h_active_columns.resize(num_unconverged_columns);
+
+    iter++;
+
+    if (h_active_columns.size() == 0) {
+      break;
+    } else if (iter >= max_iterations) {
+      CUGRAPH_FAIL("PageRank failed to converge.");
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<vertex_t const> personalization_vertices,
+  std::optional<raft::device_span<result_t const>> personalization_values,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  detail::batched_personalized_pagerank(handle,
+                                        graph_view,
+                                        edge_weight_view,
+                                        precomputed_vertex_out_weight_sums,
+                                        personalization_offsets,
+                                        personalization_vertices,
+                                        personalization_values,
+                                        pageranks,
+                                        alpha,
+                                        epsilon,
+                                        max_iterations,
+                                        do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,687 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/count_if_e.cuh>
+#include <prims/count_if_v.cuh>
+#include <prims/property_op_utils.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_v_frontier.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename result_t>
+__device__ result_t residual_magnitude(result_t residual)
+{
+  return residual < result_t{0.0} ? -residual : residual;
+}
+
+// the state of a source vertex of the updated edges before and after the update
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+struct updated_source_t {
+  edge_t const* offsets{nullptr};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t const* pageranks{nullptr};
+  result_t alpha{};
+
+  // returns (the value to push per unit out-going edge weight (to correct the contributions over
+  // the edges of the updated graph), the inverse of the old out-going edge weight sum (0 if there
+  // was no out-going edge), the change in the score sum of the vertices without out-going edges)
+  __device__ thrust::tuple<result_t, result_t, result_t> operator()(
+    thrust::tuple<vertex_t, weight_t, edge_t> src_delta) const
+  {
+    auto v          = thrust::get<0>(src_delta);
+    auto new_count  = offsets[v + 1] - offsets[v];
+    auto old_count  = new_count - thrust::get<2>(src_delta);
+    auto new_sum    = vertex_out_weight_sums[v];
+    auto old_sum    = new_sum - thrust::get<1>(src_delta);
+    auto new_inv    = new_sum > weight_t{0.0} ? result_t{1.0} / static_cast<result_t>(new_sum)
+                                              : result_t{0.0};
+    auto old_inv    = ((old_count > 0) && (old_sum > weight_t{0.0}))
+                        ? result_t{1.0} / static_cast<result_t>(old_sum)
+                        : result_t{0.0};
+    auto dangling_change = (new_inv == result_t{0.0} ? pageranks[v] : result_t{0.0}) -
+                           (old_inv == result_t{0.0} ? pageranks[v] : result_t{0.0});
+    return thrust::make_tuple(alpha * pageranks[v] * (new_inv - old_inv), old_inv, dangling_change);
+  }
+};
+
+// the correction for an inserted (sign = 1) or deleted (sign = -1) edge, the contribution over the
+// edge under the old out-going edge weight sum is added (or removed)
+template <typename vertex_t, typename weight_t, typename result_t>
+struct updated_edge_correction_t {
+  vertex_t const* updated_srcs{nullptr};
+  result_t const* updated_src_old_invs{nullptr};
+  size_t num_updated_srcs{0};
+  result_t const* pageranks{nullptr};
+  result_t alpha{};
+
+  __device__ result_t operator()(thrust::tuple<vertex_t, weight_t> src_signed_weight) const
+  {
+    auto src = thrust::get<0>(src_signed_weight);
+    auto idx = thrust::distance(
+      updated_srcs,
+      thrust::lower_bound(thrust::seq, updated_srcs, updated_srcs + num_updated_srcs, src));
+    return alpha * pageranks[src] * updated_src_old_invs[idx] *
+           static_cast<result_t>(thrust::get<1>(src_signed_weight));
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct dangling_residual_t {
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t const* residuals{nullptr};
+
+  __device__ result_t operator()(vertex_t v) const
+  {
+    return vertex_out_weight_sums[v] == weight_t{0.0} ? residuals[v] : result_t{0.0};
+  }
+};
+
+// add the residual to the score and set the per unit out-going edge weight value to push to the
+// out-neighbors
+template <typename vertex_t, typename weight_t, typename result_t>
+struct absorb_residual_t {
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t* pageranks{nullptr};
+  result_t* residuals{nullptr};
+  result_t* push_values{nullptr};
+  result_t alpha{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto residual       = residuals[v];
+    auto out_weight_sum = vertex_out_weight_sums[v];
+    pageranks[v] += residual;
+    residuals[v] = result_t{0.0};
+    push_values[v] = out_weight_sum > weight_t{0.0}
+                       ? alpha * residual / static_cast<result_t>(out_weight_sum)
+                       : result_t{0.0};
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct push_e_op_t {
+  template <typename EdgeValue>
+  __device__ thrust::optional<result_t> operator()(
+    vertex_t, vertex_t, result_t src_val, thrust::nullopt_t, EdgeValue w) const
+  {
+    if constexpr (std::is_same_v<EdgeValue, thrust::nullopt_t>) {
+      return src_val;
+    } else {
+      return src_val * static_cast<result_t>(w);
+    }
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct push_v_op_t {
+  result_t threshold{};
+  size_t bucket_idx_next{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>, thrust::optional<result_t>> operator()(
+    vertex_t, result_t v_val, result_t pushed_val) const
+  {
+    auto new_residual = v_val + pushed_val;
+    return thrust::make_tuple(residual_magnitude(new_residual) >= threshold
+                                ? thrust::optional<size_t>{bucket_idx_next}
+                                : thrust::nullopt,
+                              thrust::optional<result_t>{new_residual});
+  }
+};
+
+template <typename result_t>
+struct above_threshold_t {
+  result_t const* residuals{nullptr};
+  result_t threshold{};
+
+  template <typename vertex_t>
+  __device__ bool operator()(vertex_t v) const
+  {
+    return residual_magnitude(residuals[v]) >= threshold;
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& push_graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<vertex_t const> inserted_edge_srcs,
+  raft::device_span<vertex_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> inserted_edge_weights,
+  raft::device_span<vertex_t const> deleted_edge_srcs,
+  raft::device_span<vertex_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> deleted_edge_weights,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+
+  auto const num_vertices = push_graph_view.number_of_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(inserted_edge_srcs.size() == inserted_edge_dsts.size(),
+                  "Invalid input argument: inserted_edge_srcs.size() should coincide with "
+                  "inserted_edge_dsts.size().");
+  CUGRAPH_EXPECTS(deleted_edge_srcs.size() == deleted_edge_dsts.size(),
+                  "Invalid input argument: deleted_edge_srcs.size() should coincide with "
+                  "deleted_edge_dsts.size().");
+  CUGRAPH_EXPECTS(
+    (inserted_edge_weights.has_value() == edge_weight_view.has_value()) &&
+      (deleted_edge_weights.has_value() == edge_weight_view.has_value()),
+    "Invalid input argument: updated edge weights should be provided if and only if the graph is "
+    "weighted.");
+  CUGRAPH_EXPECTS(
+    !inserted_edge_weights || ((*inserted_edge_weights).size() == inserted_edge_srcs.size()),
+    "Invalid input argument: inserted_edge_weights.size() should coincide with "
+    "inserted_edge_srcs.size().");
+  CUGRAPH_EXPECTS(
+    !deleted_edge_weights || ((*deleted_edge_weights).size() == deleted_edge_srcs.size()),
+    "Invalid input argument: deleted_edge_weights.size() should coincide with "
+    "deleted_edge_srcs.size().");
+  CUGRAPH_EXPECTS((num_vertices == 0) || (pageranks != nullptr),
+                  "Invalid input argument: pageranks cannot be null");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    auto is_invalid_vertex = [num_vertices] __device__(auto v) {
+      return !is_valid_vertex(num_vertices, v);
+    };
+    CUGRAPH_EXPECTS(
+      (thrust::count_if(handle.get_thrust_policy(),
+                        inserted_edge_srcs.begin(),
+                        inserted_edge_srcs.end(),
+                        is_invalid_vertex) == 0) &&
+        (thrust::count_if(handle.get_thrust_policy(),
+                          inserted_edge_dsts.begin(),
+                          inserted_edge_dsts.end(),
+                          is_invalid_vertex) == 0) &&
+        (thrust::count_if(handle.get_thrust_policy(),
+                          deleted_edge_srcs.begin(),
+                          deleted_edge_srcs.end(),
+                          is_invalid_vertex) == 0) &&
+        (thrust::count_if(handle.get_thrust_policy(),
+                          deleted_edge_dsts.begin(),
+                          deleted_edge_dsts.end(),
+                          is_invalid_vertex) == 0),
+      "Invalid input argument: updated edges have invalid vertex IDs.");
+
+    if (precomputed_vertex_out_weight_sums) {
+      auto num_negative_precomputed_vertex_out_weight_sums =
+        count_if_v(handle,
+                   push_graph_view,
+                   *precomputed_vertex_out_weight_sums,
+                   [] __device__(auto, auto val) { return val < weight_t{0.0}; });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (edge_weight_view) {
+      auto num_negative_edge_weights =
+        count_if_e(handle,
+                   push_graph_view,
+                   edge_src_dummy_property_t{}.view(),
+                   edge_dst_dummy_property_t{}.view(),
+                   *edge_weight_view,
+                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+      auto is_negative = [] __device__(auto w) { return w < weight_t{0.0}; };
+      CUGRAPH_EXPECTS(
+        (num_negative_edge_weights == 0) &&
+          (thrust::count_if(handle.get_thrust_policy(),
+                            (*inserted_edge_weights).begin(),
+                            (*inserted_edge_weights).end(),
+                            is_negative) == 0) &&
+          (thrust::count_if(handle.get_thrust_policy(),
+                            (*deleted_edge_weights).begin(),
+                            (*deleted_edge_weights).end(),
+                            is_negative) == 0),
+        "Invalid input argument: input edge weights should have non-negative values.");
+    }
+  }
+
+  auto const num_updated_edges = inserted_edge_srcs.size() + deleted_edge_srcs.size();
+  if ((num_vertices == 0) || (num_updated_edges == 0)) { return; }
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
+  if (!precomputed_vertex_out_weight_sums) {
+    if (edge_weight_view) {
+      tmp_vertex_out_weight_sums =
+        compute_out_weight_sums(handle, push_graph_view, *edge_weight_view);
+    } else {
+      auto tmp_vertex_out_degrees = push_graph_view.compute_out_degrees(handle);
+      tmp_vertex_out_weight_sums =
+        rmm::device_uvector<weight_t>(tmp_vertex_out_degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        tmp_vertex_out_degrees.begin(),
+                        tmp_vertex_out_degrees.end(),
+                        (*tmp_vertex_out_weight_sums).begin(),
+                        detail::typecast_t<edge_t, weight_t>{});
+    }
+  }
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                  ? *precomputed_vertex_out_weight_sums
+                                  : (*tmp_vertex_out_weight_sums).data();
+
+  // 3. the updated edges as (src, dst, signed weight) triplets (the signs are positive for the
+  // inserted edges and negative for the deleted edges)
+
+  rmm::device_uvector<vertex_t> updated_srcs(num_updated_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> updated_dsts(num_updated_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> updated_signed_weights(num_updated_edges, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               inserted_edge_srcs.begin(),
+               inserted_edge_srcs.end(),
+               updated_srcs.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               deleted_edge_srcs.begin(),
+               deleted_edge_srcs.end(),
+               updated_srcs.begin() + inserted_edge_srcs.size());
+  thrust::copy(handle.get_thrust_policy(),
+               inserted_edge_dsts.begin(),
+               inserted_edge_dsts.end(),
+               updated_dsts.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               deleted_edge_dsts.begin(),
+               deleted_edge_dsts.end(),
+               updated_dsts.begin() + inserted_edge_srcs.size());
+  if (edge_weight_view) {
+    thrust::copy(handle.get_thrust_policy(),
+                 (*inserted_edge_weights).begin(),
+                 (*inserted_edge_weights).end(),
+                 updated_signed_weights.begin());
+    thrust::transform(handle.get_thrust_policy(),
+                      (*deleted_edge_weights).begin(),
+                      (*deleted_edge_weights).end(),
+                      updated_signed_weights.begin() + inserted_edge_srcs.size(),
+                      thrust::negate<weight_t>{});
+  } else {
+    thrust::fill(handle.get_thrust_policy(),
+                 updated_signed_weights.begin(),
+                 updated_signed_weights.begin() + inserted_edge_srcs.size(),
+                 weight_t{1.0});
+    thrust::fill(handle.get_thrust_policy(),
+                 updated_signed_weights.begin() + inserted_edge_srcs.size(),
+                 updated_signed_weights.end(),
+                 weight_t{-1.0});
+  }
+
+  // 4. aggregate the changes per source vertex (the out-going edge weight sums and the out-degrees
+  // before the update are recovered from the values after the update)
+
+  rmm::device_uvector<vertex_t> unique_srcs(num_updated_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> src_weight_deltas(num_updated_edges, handle.get_stream());
+  rmm::device_uvector<edge_t> src_count_deltas(num_updated_edges, handle.get_stream());
+  {
+    rmm::device_uvector<vertex_t> tmp_srcs(num_updated_edges, handle.get_stream());
+    rmm::device_uvector<weight_t> tmp_weights(num_updated_edges, handle.get_stream());
+    rmm::device_uvector<edge_t> tmp_counts(num_updated_edges, handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), updated_srcs.begin(), updated_srcs.end(), tmp_srcs.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 updated_signed_weights.begin(),
+                 updated_signed_weights.end(),
+                 tmp_weights.begin());
+    thrust::fill(handle.get_thrust_policy(),
+                 tmp_counts.begin(),
+                 tmp_counts.begin() + inserted_edge_srcs.size(),
+                 edge_t{1});
+    thrust::fill(handle.get_thrust_policy(),
+                 tmp_counts.begin() + inserted_edge_srcs.size(),
+                 tmp_counts.end(),
+                 edge_t{-1});
+
+    auto tmp_value_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tmp_weights.begin(), tmp_counts.begin()));
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), tmp_srcs.begin(), tmp_srcs.end(), tmp_value_first);
+    auto num_unique_srcs = static_cast<size_t>(thrust::distance(
+      unique_srcs.begin(),
+      thrust::get<0>(thrust::reduce_by_key(
+        handle.get_thrust_policy(),
+        tmp_srcs.begin(),
+        tmp_srcs.end(),
+        tmp_value_first,
+        unique_srcs.begin(),
+        thrust::make_zip_iterator(
+          thrust::make_tuple(src_weight_deltas.begin(), src_count_deltas.begin())),
+        thrust::equal_to<vertex_t>{},
+        property_op<thrust::tuple<weight_t, edge_t>, thrust::plus>{}))));
+    unique_srcs.resize(num_unique_srcs, handle.get_stream());
+    src_weight_deltas.resize(num_unique_srcs, handle.get_stream());
+    src_count_deltas.resize(num_unique_srcs, handle.get_stream());
+  }
+
+  rmm::device_uvector<result_t> src_push_values(unique_srcs.size(), handle.get_stream());
+  rmm::device_uvector<result_t> src_old_invs(unique_srcs.size(), handle.get_stream());
+  rmm::device_uvector<result_t> src_dangling_changes(unique_srcs.size(), handle.get_stream());
+  {
+    auto offsets   = push_graph_view.local_edge_partition_view().offsets();
+    auto src_first = thrust::make_zip_iterator(thrust::make_tuple(
+      unique_srcs.begin(), src_weight_deltas.begin(), src_count_deltas.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      src_first,
+                      src_first + unique_srcs.size(),
+                      thrust::make_zip_iterator(thrust::make_tuple(src_push_values.begin(),
+                                                                   src_old_invs.begin(),
+                                                                   src_dangling_changes.begin())),
+                      updated_source_t<vertex_t, edge_t, weight_t, result_t>{
+                        offsets.data(), vertex_out_weight_sums, pageranks, alpha});
+  }
+  src_weight_deltas.resize(0, handle.get_stream());
+  src_weight_deltas.shrink_to_fit(handle.get_stream());
+  src_count_deltas.resize(0, handle.get_stream());
+  src_count_deltas.shrink_to_fit(handle.get_stream());
+
+  // the residual that every vertex receives (from the vertices without out-going edges), this is
+  // kept as a scalar (see step 6)
+  auto uniform_residual = alpha *
+                          thrust::reduce(handle.get_thrust_policy(),
+                                         src_dangling_changes.begin(),
+                                         src_dangling_changes.end(),
+                                         result_t{0.0}) /
+                          static_cast<result_t>(num_vertices);
+
+  // 5. compute the initial residuals: correct the contributions over the edges of the updated graph
+  // (with the new out-going edge weight sums) and over the inserted (added) & deleted (removed)
+  // edges (with the old out-going edge weight sums)
+
+  constexpr size_t bucket_idx_cur  = 0;
+  constexpr size_t bucket_idx_next = 1;
+  constexpr size_t num_buckets     = 2;
+
+  vertex_frontier_t<vertex_t, void, false, true> vertex_frontier(handle, num_buckets);
+
+  rmm::device_uvector<result_t> residuals(num_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> push_values(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+
+  auto push = [&](auto const& frontier_bucket) {
+    auto edge_src_value_view =
+      detail::edge_major_property_view_t<vertex_t, result_t const*>(push_values.data());
+    return edge_weight_view
+             ? transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                             push_graph_view,
+                                                             frontier_bucket,
+                                                             edge_src_value_view,
+                                                             edge_dst_dummy_property_t{}.view(),
+                                                             *edge_weight_view,
+                                                             push_e_op_t<vertex_t, result_t>{},
+                                                             reduce_op::plus<result_t>{})
+             : transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                             push_graph_view,
+                                                             frontier_bucket,
+                                                             edge_src_value_view,
+                                                             edge_dst_dummy_property_t{}.view(),
+                                                             edge_dummy_property_t{}.view(),
+                                                             push_e_op_t<vertex_t, result_t>{},
+                                                             reduce_op::plus<result_t>{});
+  };
+
+  rmm::device_uvector<vertex_t> candidates(0, handle.get_stream());
+  {
+    thrust::scatter(handle.get_thrust_policy(),
+                    src_push_values.begin(),
+                    src_push_values.end(),
+                    unique_srcs.begin(),
+                    push_values.begin());
+    vertex_frontier.bucket(bucket_idx_cur).insert(unique_srcs.begin(), unique_srcs.end());
+    auto [pushed_vertices, pushed_values] = push(vertex_frontier.bucket(bucket_idx_cur));
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+
+    auto num_pushed = pushed_vertices.size();
+    candidates.resize(num_pushed + num_updated_edges, handle.get_stream());
+    rmm::device_uvector<result_t> residual_deltas(candidates.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 pushed_vertices.begin(),
+                 pushed_vertices.end(),
+                 candidates.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 pushed_values.begin(),
+                 pushed_values.end(),
+                 residual_deltas.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 updated_dsts.begin(),
+                 updated_dsts.end(),
+                 candidates.begin() + num_pushed);
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(updated_srcs.begin(), updated_signed_weights.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      edge_first,
+                      edge_first + num_updated_edges,
+                      residual_deltas.begin() + num_pushed,
+                      updated_edge_correction_t<vertex_t, weight_t, result_t>{unique_srcs.data(),
+                                                                              src_old_invs.data(),
+                                                                              unique_srcs.size(),
+                                                                              pageranks,
+                                                                              alpha});
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), candidates.begin(), candidates.end(), residual_deltas.begin());
+    auto num_candidates = static_cast<size_t>(thrust::distance(
+      candidates.begin(),
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           candidates.begin(),
+                                           candidates.end(),
+                                           residual_deltas.begin(),
+                                           candidates.begin(),
+                                           residual_deltas.begin()))));
+    candidates.resize(num_candidates, handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    residual_deltas.begin(),
+                    residual_deltas.begin() + num_candidates,
+                    candidates.begin(),
+                    residuals.begin());
+  }
+
+  // 6. push the residuals above the threshold till the remaining residuals sum to at most
+  // (1.0 - alpha) * epsilon / 2.0, the uniform residual is kept as a scalar and folded into the
+  // scores at the end (this bounds the L1 error by epsilon)
+
+  auto const threshold =
+    (result_t{1.0} - alpha) * epsilon / (result_t{2.0} * static_cast<result_t>(num_vertices));
+
+  // a uniform residual of u per vertex contributes u * V / (1.0 - alpha) times the exact scores to
+  // the exact scores (the restart vector is uniform), so the exact scores are the scores reached by
+  // pushing the remaining residuals divided by (1.0 - u * V / (1.0 - alpha)); the remaining
+  // residual error is amplified by the inverse of this scale, so the uniform residual is spread to
+  // every vertex (an O(V + E) sweep) instead if the scale is below 0.5
+  auto fold_scale = [&]() {
+    return result_t{1.0} -
+           uniform_residual * static_cast<result_t>(num_vertices) / (result_t{1.0} - alpha);
+  };
+
+  auto spread_uniform_residual = [&]() {
+    thrust::transform(handle.get_thrust_policy(),
+                      residuals.begin(),
+                      residuals.end(),
+                      residuals.begin(),
+                      [uniform_residual] __device__(auto r) { return r + uniform_residual; });
+    uniform_residual = result_t{0.0};
+    rmm::device_uvector<vertex_t> active_vertices(num_vertices, handle.get_stream());
+    active_vertices.resize(
+      thrust::distance(active_vertices.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(vertex_t{0}),
+                                       thrust::make_counting_iterator(num_vertices),
+                                       active_vertices.begin(),
+                                       above_threshold_t<result_t>{residuals.data(), threshold})),
+      handle.get_stream());
+    vertex_frontier.bucket(bucket_idx_cur).insert(active_vertices.begin(), active_vertices.end());
+  };
+
+  candidates.resize(
+    thrust::distance(candidates.begin(),
+                     thrust::remove_if(handle.get_thrust_policy(),
+                                       candidates.begin(),
+                                       candidates.end(),
+                                       [residuals = residuals.data(), threshold] __device__(
+                                         auto v) {
+                                         return residual_magnitude(residuals[v]) < threshold;
+                                       })),
+    handle.get_stream());
+  vertex_frontier.bucket(bucket_idx_cur).insert(candidates.begin(), candidates.end());
+  candidates.resize(0, handle.get_stream());
+  candidates.shrink_to_fit(handle.get_stream());
+
+  while (true) {
+    if (vertex_frontier.bucket(bucket_idx_cur).size() == 0) {
+      if (std::abs(fold_scale()) < result_t{0.5}) {
+        spread_uniform_residual();
+        if (vertex_frontier.bucket(bucket_idx_cur).size() == 0) { break; }
+      } else {
+        break;
+      }
+    }
+    auto& cur_bucket = vertex_frontier.bucket(bucket_idx_cur);
+
+    auto dangling_sum =
+      thrust::transform_reduce(handle.get_thrust_policy(),
+                               cur_bucket.begin(),
+                               cur_bucket.end(),
+                               dangling_residual_t<vertex_t, weight_t, result_t>{
+                                 vertex_out_weight_sums, residuals.data()},
+                               result_t{0.0},
+                               thrust::plus<result_t>{});
+    uniform_residual += alpha * dangling_sum / static_cast<result_t>(num_vertices);
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      cur_bucket.begin(),
+      cur_bucket.end(),
+      absorb_residual_t<vertex_t, weight_t, result_t>{
+        vertex_out_weight_sums, pageranks, residuals.data(), push_values.data(), alpha});
+
+    auto [new_frontier_vertex_buffer, pushed_value_buffer] = push(cur_bucket);
+
+    cur_bucket.clear();
+    cur_bucket.shrink_to_fit();
+
+    update_v_frontier(handle,
+                      push_graph_view,
+                      std::move(new_frontier_vertex_buffer),
+                      std::move(pushed_value_buffer),
+                      vertex_frontier,
+                      std::vector<size_t>{bucket_idx_next},
+                      residuals.data(),
+                      residuals.data(),
+                      push_v_op_t<vertex_t, result_t>{threshold, bucket_idx_next});
+
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+  }
+
+  // 7. fold the uniform residual into the scores
+
+  if (uniform_residual != result_t{0.0}) {
+    auto inv_scale = result_t{1.0} / fold_scale();
+    thrust::transform(handle.get_thrust_policy(),
+                      pageranks,
+                      pageranks + num_vertices,
+                      pageranks,
+                      [inv_scale] __device__(auto pagerank) { return pagerank * inv_scale; });
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<vertex_t const> inserted_edge_srcs,
+  raft::device_span<vertex_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> inserted_edge_weights,
+  raft::device_span<vertex_t const> deleted_edge_srcs,
+  raft::device_span<vertex_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<weight_t const>> deleted_edge_weights,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  bool do_expensive_check)
+{
+  detail::incremental_pagerank(handle,
+                               graph_view,
+                               edge_weight_view,
+                               precomputed_vertex_out_weight_sums,
+                               inserted_edge_srcs,
+                               inserted_edge_dsts,
+                               inserted_edge_weights,
+                               deleted_edge_srcs,
+                               deleted_edge_dsts,
+                               deleted_edge_weights,
+                               pageranks,
+                               alpha,
+                               epsilon,
+                               do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <link_analysis/incremental_pagerank_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int32_t const> inserted_edge_srcs,
+  raft::device_span<int32_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<float const>> inserted_edge_weights,
+  raft::device_span<int32_t const> deleted_edge_srcs,
+  raft::device_span<int32_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<float const>> deleted_edge_weights,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int32_t const> inserted_edge_srcs,
+  raft::device_span<int32_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<double const>> inserted_edge_weights,
+  raft::device_span<int32_t const> deleted_edge_srcs,
+  raft::device_span<int32_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<double const>> deleted_edge_weights,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int32_t const> inserted_edge_srcs,
+  raft::device_span<int32_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<float const>> inserted_edge_weights,
+  raft::device_span<int32_t const> deleted_edge_srcs,
+  raft::device_span<int32_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<float const>> deleted_edge_weights,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int32_t const> inserted_edge_srcs,
+  raft::device_span<int32_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<double const>> inserted_edge_weights,
+  raft::device_span<int32_t const> deleted_edge_srcs,
+  raft::device_span<int32_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<double const>> deleted_edge_weights,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<float const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int64_t const> inserted_edge_srcs,
+  raft::device_span<int64_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<float const>> inserted_edge_weights,
+  raft::device_span<int64_t const> deleted_edge_srcs,
+  raft::device_span<int64_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<float const>> deleted_edge_weights,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<double const*> precomputed_vertex_out_weight_sums,
+  raft::device_span<int64_t const> inserted_edge_srcs,
+  raft::device_span<int64_t const> inserted_edge_dsts,
+  std::optional<raft::device_span<double const>> inserted_edge_weights,
+  raft::device_span<int64_t const> deleted_edge_srcs,
+  raft::device_span<int64_t const> deleted_edge_dsts,
+  std::optional<raft::device_span<double const>> deleted_edge_weights,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  bool do_expensive_check);
+
+}  // namespace cugraph
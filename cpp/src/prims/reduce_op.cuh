@@ -24,6 +24,7 @@
 
 #include <thrust/functional.h>
 
+#include <type_traits>
 #include <utility>
 
 namespace cugraph {
@@ -221,6 +222,20 @@ struct plus {
   __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return op(lhs, rhs); }
 };
 
+// Binary reduction operator computing the bitwise OR of the two input arguments, T should be an
+// unsigned integral type. A compatible raft comms op does not exist, so this can be used only with
+// the primitives that reduce values locally (e.g. transform_reduce_v_frontier_outgoing_e_by_dst).
+template <typename T>
+struct bitwise_or {
+  static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>);
+
+  using value_type                       = T;
+  static constexpr bool pure_function    = true;  // this can be called in any process
+  inline static T const identity_element = T{0};
+
+  __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return lhs | rhs; }
+};
+
 template <typename ReduceOp, typename = raft::comms::op_t>
 struct has_compatible_raft_comms_op : std::false_type {
 };
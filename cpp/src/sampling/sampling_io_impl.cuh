@@ -0,0 +1,849 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/sampling_io.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/find.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// sampling result file layout: sampling_result_file_header_t followed by num_batches batches, a
+// batch is sampling_result_batch_header_t followed by the columns (each column starts at a
+// sampling_result_column_alignment byte boundary and the gaps are zero-filled)
+
+constexpr char sampling_result_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'R'};
+constexpr uint32_t sampling_result_version{1};
+constexpr size_t sampling_result_column_alignment{8};
+
+constexpr uint32_t sampling_result_weights_flag{uint32_t{1} << 0};
+constexpr uint32_t sampling_result_hops_flag{uint32_t{1} << 1};
+
+struct sampling_result_file_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t result_type;
+  uint32_t flags;
+  uint32_t vertex_size;
+  uint32_t weight_size;  // 0 if edge weights are not stored
+  uint32_t reserved;
+  uint64_t num_batches;
+  uint64_t num_seeds;
+  uint64_t num_values;
+  uint64_t reserved2;
+};
+
+static_assert(sizeof(sampling_result_file_header_t) == 64);
+
+struct sampling_result_batch_header_t {
+  uint64_t num_seeds;
+  uint64_t num_values;
+};
+
+static_assert(sizeof(sampling_result_batch_header_t) % sampling_result_column_alignment == 0);
+
+inline size_t align_sampling_result_offset(size_t offset)
+{
+  return ((offset + (sampling_result_column_alignment - 1)) / sampling_result_column_alignment) *
+         sampling_result_column_alignment;
+}
+
+// byte offsets of the columns from the beginning of a batch (std::nullopt if a column is not
+// stored)
+struct sampling_result_batch_layout_t {
+  size_t offsets{0};
+  std::optional<size_t> srcs{std::nullopt};
+  size_t vertices{0};
+  std::optional<size_t> weights{std::nullopt};
+  std::optional<size_t> hops{std::nullopt};
+  size_t num_weights{0};
+  size_t size{0};  // batch size in bytes
+};
+
+inline sampling_result_batch_layout_t compute_sampling_result_batch_layout(
+  sampling_result_type_t result_type,
+  uint32_t flags,
+  size_t vertex_size,
+  size_t weight_size,
+  size_t num_seeds,
+  size_t num_values)
+{
+  sampling_result_batch_layout_t layout{};
+  size_t offset = sizeof(sampling_result_batch_header_t);
+
+  layout.offsets = offset;
+  offset         = align_sampling_result_offset(offset + (num_seeds + 1) * sizeof(uint64_t));
+  if (result_type == sampling_result_type_t::NEIGHBOR_SAMPLES) {
+    layout.srcs = offset;
+    offset      = align_sampling_result_offset(offset + num_values * vertex_size);
+  }
+  layout.vertices = offset;
+  offset          = align_sampling_result_offset(offset + num_values * vertex_size);
+  if (flags & sampling_result_weights_flag) {
+    // random walks store one less edge weight than path vertices per path
+    layout.num_weights =
+      result_type == sampling_result_type_t::RANDOM_WALKS ? num_values - num_seeds : num_values;
+    layout.weights = offset;
+    offset         = align_sampling_result_offset(offset + layout.num_weights * weight_size);
+  }
+  if (flags & sampling_result_hops_flag) {
+    layout.hops = offset;
+    offset      = align_sampling_result_offset(offset + num_values * sizeof(int32_t));
+  }
+  layout.size = offset;
+
+  return layout;
+}
+
+// Appends host buffers to a file from a writer thread. Two buffers are used in turn: the caller
+// fills one buffer (acquire_buffer()) while the writer thread writes the other (submit_buffer()),
+// so generating the next batch overlaps with writing the previous one.
+class double_buffered_file_writer_t {
+ public:
+  explicit double_buffered_file_writer_t(std::string const& file_path)
+    : file_(file_path, std::ios::binary | std::ios::trunc)
+  {
+    CUGRAPH_EXPECTS(
+      file_.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+    writer_ = std::thread([this]() { run(); });
+  }
+
+  double_buffered_file_writer_t(double_buffered_file_writer_t const&) = delete;
+  double_buffered_file_writer_t& operator=(double_buffered_file_writer_t const&) = delete;
+
+  ~double_buffered_file_writer_t()
+  {
+    stop();  // close() should be called to check for write errors
+  }
+
+  // block until a buffer is available for the caller to fill
+  std::vector<char>& acquire_buffer()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return error_ || (queue_.size() + in_flight_ < buffers_.size()); });
+    rethrow_error();
+    filling_idx_ = (next_idx_++) % buffers_.size();
+    return buffers_[filling_idx_];
+  }
+
+  // the acquired buffer is appended to the file asynchronously
+  void submit_buffer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(filling_idx_);
+    }
+    cv_.notify_all();
+  }
+
+  // block until every submitted buffer is written
+  void flush()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return error_ || (queue_.empty() && (in_flight_ == 0)); });
+    rethrow_error();
+  }
+
+  // overwrite previously written bytes (e.g. a header updated after the last buffer)
+  void write_at(size_t offset, void const* data, size_t size)
+  {
+    flush();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto end = file_.tellp();
+    file_.seekp(offset);
+    file_.write(static_cast<char const*>(data), size);
+    file_.seekp(end);
+    CUGRAPH_EXPECTS(file_.good(), "Failed to write a file.");
+  }
+
+  void close()
+  {
+    flush();
+    stop();
+    file_.close();
+    CUGRAPH_EXPECTS(!file_.fail(), "Failed to close a file.");
+  }
+
+ private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+      if (queue_.empty()) { break; }  // stop_ is set and every submitted buffer is written
+      auto idx = queue_.front();
+      queue_.pop_front();
+      ++in_flight_;
+      lock.unlock();
+      bool success{true};
+      if (!error_) {
+        file_.write(buffers_[idx].data(), buffers_[idx].size());
+        success = file_.good();
+      }
+      lock.lock();
+      --in_flight_;
+      if (!success && !error_) {
+        error_ = std::make_exception_ptr(cugraph::logic_error("Failed to write a file."));
+      }
+      cv_.notify_all();
+    }
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) { writer_.join(); }
+  }
+
+  void rethrow_error()
+  {
+    if (error_) { std::rethrow_exception(error_); }
+  }
+
+  std::ofstream file_;
+  std::array<std::vector<char>, 2> buffers_{};
+  size_t next_idx_{0};
+  size_t filling_idx_{0};
+
+  std::mutex mutex_{};
+  std::condition_variable cv_{};
+  std::deque<size_t> queue_{};
+  size_t in_flight_{0};
+  bool stop_{false};
+  std::exception_ptr error_{nullptr};
+
+  std::thread writer_{};
+};
+
+template <typename vertex_t, typename weight_t>
+class sampling_result_file_writer_t {
+ public:
+  sampling_result_file_writer_t(std::string const& file_path,
+                                sampling_result_type_t result_type,
+                                bool has_weights,
+                                bool has_hops)
+    : writer_(file_path), result_type_(result_type)
+  {
+    std::memset(&header_, 0, sizeof(header_));
+    std::memcpy(header_.magic, sampling_result_magic, sizeof(header_.magic));
+    header_.version     = sampling_result_version;
+    header_.result_type = static_cast<uint32_t>(result_type);
+    header_.flags = (has_weights ? sampling_result_weights_flag : uint32_t{0}) |
+                    (has_hops ? sampling_result_hops_flag : uint32_t{0});
+    header_.vertex_size = sizeof(vertex_t);
+    header_.weight_size = has_weights ? sizeof(weight_t) : uint32_t{0};
+
+    // the counts are updated in close()
+    auto& buffer = writer_.acquire_buffer();
+    buffer.assign(reinterpret_cast<char const*>(&header_),
+                  reinterpret_cast<char const*>(&header_) + sizeof(header_));
+    writer_.submit_buffer();
+  }
+
+  // copy a batch to a host buffer (returns once the copy completes, the device arrays can be freed
+  // afterwards) and write the buffer to the file asynchronously
+  void write_batch(raft::handle_t const& handle,
+                   raft::device_span<size_t const> offsets,
+                   std::optional<raft::device_span<vertex_t const>> srcs,
+                   raft::device_span<vertex_t const> vertices,
+                   std::optional<raft::device_span<weight_t const>> weights,
+                   std::optional<raft::device_span<int32_t const>> hops)
+  {
+    CUGRAPH_EXPECTS(offsets.size() > 0, "Invalid input argument: offsets should not be empty.");
+    auto num_seeds  = offsets.size() - 1;
+    auto num_values = vertices.size();
+    auto layout     = compute_sampling_result_batch_layout(
+      result_type_, header_.flags, sizeof(vertex_t), sizeof(weight_t), num_seeds, num_values);
+    CUGRAPH_EXPECTS(srcs.has_value() == layout.srcs.has_value() &&
+                      weights.has_value() == layout.weights.has_value() &&
+                      hops.has_value() == layout.hops.has_value() &&
+                      (!srcs || ((*srcs).size() == num_values)) &&
+                      (!weights || ((*weights).size() == layout.num_weights)) &&
+                      (!hops || ((*hops).size() == num_values)),
+                    "Invalid input argument: sampling result column size mismatch.");
+
+    auto& buffer = writer_.acquire_buffer();
+    buffer.resize(layout.size);
+    std::fill(buffer.begin(), buffer.end(), char{0});  // zero-fill the padding bytes
+    sampling_result_batch_header_t batch_header{num_seeds, num_values};
+    std::memcpy(buffer.data(), &batch_header, sizeof(batch_header));
+
+    raft::update_host(reinterpret_cast<size_t*>(buffer.data() + layout.offsets),
+                      offsets.data(),
+                      offsets.size(),
+                      handle.get_stream());
+    if (srcs) {
+      raft::update_host(reinterpret_cast<vertex_t*>(buffer.data() + *(layout.srcs)),
+                        (*srcs).data(),
+                        (*srcs).size(),
+                        handle.get_stream());
+    }
+    raft::update_host(reinterpret_cast<vertex_t*>(buffer.data() + layout.vertices),
+                      vertices.data(),
+                      vertices.size(),
+                      handle.get_stream());
+    if (weights) {
+      raft::update_host(reinterpret_cast<weight_t*>(buffer.data() + *(layout.weights)),
+                        (*weights).data(),
+                        (*weights).size(),
+                        handle.get_stream());
+    }
+    if (hops) {
+      raft::update_host(reinterpret_cast<int32_t*>(buffer.data() + *(layout.hops)),
+                        (*hops).data(),
+                        (*hops).size(),
+                        handle.get_stream());
+    }
+    handle.sync_stream();
+
+    writer_.submit_buffer();
+
+    ++header_.num_batches;
+    header_.num_seeds += num_seeds;
+    header_.num_values += num_values;
+  }
+
+  // returns the number of values written
+  size_t close()
+  {
+    writer_.write_at(0, &header_, sizeof(header_));
+    writer_.close();
+    return static_cast<size_t>(header_.num_values);
+  }
+
+ private:
+  double_buffered_file_writer_t writer_;
+  sampling_result_type_t result_type_{};
+  sampling_result_file_header_t header_{};
+};
+
+// compact the (max_length + 1) vertices (and max_length edge weights) per path output of the
+// random walk algorithms by dropping the invalid vertices (and the matching 0 edge weights) of
+// the paths terminated before max_length
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compact_random_walk_paths(raft::handle_t const& handle,
+                          rmm::device_uvector<vertex_t>&& vertices,
+                          std::optional<rmm::device_uvector<weight_t>>&& weights,
+                          size_t num_paths,
+                          size_t max_length)
+{
+  rmm::device_uvector<size_t> offsets(num_paths + 1, handle.get_stream());
+  offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::tabulate(handle.get_thrust_policy(),
+                   offsets.begin() + 1,
+                   offsets.end(),
+                   [vertices = vertices.data(), max_length] __device__(size_t i) {
+                     auto first = vertices + i * (max_length + 1);
+                     return static_cast<size_t>(thrust::distance(
+                       first,
+                       thrust::find(thrust::seq,
+                                    first,
+                                    first + (max_length + 1),
+                                    cugraph::invalid_vertex_id<vertex_t>::value)));
+                   });
+  thrust::inclusive_scan(
+    handle.get_thrust_policy(), offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  if (weights && (max_length > 0)) {
+    auto last = thrust::remove_if(
+      handle.get_thrust_policy(),
+      (*weights).begin(),
+      (*weights).end(),
+      thrust::make_counting_iterator(size_t{0}),
+      [offsets = offsets.data(), max_length] __device__(size_t i) {
+        auto path_idx = i / max_length;
+        return (i % max_length) + 1 >= offsets[path_idx + 1] - offsets[path_idx];
+      });
+    (*weights).resize(thrust::distance((*weights).begin(), last), handle.get_stream());
+    (*weights).shrink_to_fit(handle.get_stream());
+  }
+
+  auto last = thrust::remove(handle.get_thrust_policy(),
+                             vertices.begin(),
+                             vertices.end(),
+                             cugraph::invalid_vertex_id<vertex_t>::value);
+  vertices.resize(thrust::distance(vertices.begin(), last), handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+
+  return std::make_tuple(std::move(offsets), std::move(vertices), std::move(weights));
+}
+
+template <typename T>
+void permute_sampling_result_column(raft::handle_t const& handle,
+                                    rmm::device_uvector<T>& values,
+                                    rmm::device_uvector<size_t> const& permutation)
+{
+  rmm::device_uvector<T> tmps(values.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 permutation.begin(),
+                 permutation.end(),
+                 values.begin(),
+                 tmps.begin());
+  values = std::move(tmps);
+}
+
+inline uint64_t get_sampling_seed(uint64_t seed)
+{
+  // 0 means the system time as in the random walk algorithms
+  return seed == 0 ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now().time_since_epoch())
+                                             .count())
+                   : seed;
+}
+
+// derives the seed of the batch_idx'th batch; seed + batch_idx can wrap around to 0 (e.g. with
+// the default seed) which the random walk algorithms interpret as "use the system time", so mix
+// (seed, batch_idx) with the splitmix64 finalizer and never return 0
+inline uint64_t get_batch_sampling_seed(uint64_t seed, size_t batch_idx)
+{
+  uint64_t z = seed + (static_cast<uint64_t>(batch_idx) + 1) * uint64_t{0x9e3779b97f4a7c15};
+  z          = (z ^ (z >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  z          = (z ^ (z >> 27)) * uint64_t{0x94d049bb133111eb};
+  z          = z ^ (z >> 31);
+  return z == 0 ? uint64_t{1} : z;
+}
+
+// every GPU needs to participate in the same number of batches in multi-GPU
+template <bool multi_gpu>
+size_t compute_number_of_sampling_batches(raft::handle_t const& handle,
+                                          size_t num_seeds,
+                                          size_t batch_size)
+{
+  auto num_batches = (num_seeds + (batch_size - 1)) / batch_size;
+  if constexpr (multi_gpu) {
+    num_batches = host_scalar_allreduce(
+      handle.get_comms(), num_batches, raft::comms::op_t::MAX, handle.get_stream());
+  }
+  return num_batches;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename random_walks_op_t>
+size_t random_walks_to_file_impl(raft::handle_t const& handle,
+                                 raft::device_span<vertex_t const> start_vertices,
+                                 size_t max_length,
+                                 std::string const& file_path,
+                                 size_t batch_size,
+                                 bool has_weights,
+                                 random_walks_op_t random_walks_op)
+{
+  CUGRAPH_EXPECTS(batch_size > 0, "Invalid input argument: batch_size should be positive.");
+
+  sampling_result_file_writer_t<vertex_t, weight_t> writer(
+    file_path, sampling_result_type_t::RANDOM_WALKS, has_weights, false);
+
+  auto num_batches =
+    compute_number_of_sampling_batches<multi_gpu>(handle, start_vertices.size(), batch_size);
+  for (size_t i = 0; i < num_batches; ++i) {
+    auto batch_first = std::min(i * batch_size, start_vertices.size());
+    auto batch_last  = std::min(batch_first + batch_size, start_vertices.size());
+
+    auto [vertices, weights] = random_walks_op(
+      raft::device_span<vertex_t const>(start_vertices.data() + batch_first,
+                                        batch_last - batch_first),
+      i);
+    rmm::device_uvector<size_t> offsets(0, handle.get_stream());
+    std::tie(offsets, vertices, weights) = compact_random_walk_paths(
+      handle, std::move(vertices), std::move(weights), batch_last - batch_first, max_length);
+
+    writer.write_batch(
+      handle,
+      raft::device_span<size_t const>(offsets.data(), offsets.size()),
+      std::nullopt,
+      raft::device_span<vertex_t const>(vertices.data(), vertices.size()),
+      weights ? std::make_optional<raft::device_span<weight_t const>>((*weights).data(),
+                                                                       (*weights).size())
+              : std::nullopt,
+      std::nullopt);
+  }
+
+  return writer.close();
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t>
+sampling_result_reader_t<vertex_t, weight_t>::sampling_result_reader_t(
+  std::string const& file_path)
+  : file_(file_path, std::ios::binary)
+{
+  CUGRAPH_EXPECTS(
+    file_.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+
+  detail::sampling_result_file_header_t header{};
+  file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+  CUGRAPH_EXPECTS(
+    file_.good() &&
+      (std::memcmp(header.magic, detail::sampling_result_magic, sizeof(header.magic)) == 0),
+    "Invalid input argument: %s is not a sampling result file.",
+    file_path.c_str());
+  CUGRAPH_EXPECTS(header.version == detail::sampling_result_version,
+                  "Invalid input argument: unsupported sampling result file version (%u).",
+                  static_cast<unsigned>(header.version));
+  CUGRAPH_EXPECTS(header.vertex_size == sizeof(vertex_t),
+                  "Invalid template parameters: vertex_t should match with the type used in "
+                  "writing the sampling result file.");
+  CUGRAPH_EXPECTS(!(header.flags & detail::sampling_result_weights_flag) ||
+                    (header.weight_size == sizeof(weight_t)),
+                  "Invalid template parameters: weight_t should match with the type used in "
+                  "writing the sampling result file.");
+  CUGRAPH_EXPECTS(
+    header.result_type <= static_cast<uint32_t>(sampling_result_type_t::NEIGHBOR_SAMPLES),
+    "Invalid input argument: corrupted sampling result file (invalid result type).");
+
+  result_type_       = static_cast<sampling_result_type_t>(header.result_type);
+  has_weights_       = (header.flags & detail::sampling_result_weights_flag) != 0;
+  has_hops_          = (header.flags & detail::sampling_result_hops_flag) != 0;
+  number_of_batches_ = static_cast<size_t>(header.num_batches);
+  number_of_seeds_   = static_cast<size_t>(header.num_seeds);
+  number_of_values_  = static_cast<size_t>(header.num_values);
+}
+
+template <typename vertex_t, typename weight_t>
+std::optional<sampling_result_batch_t<vertex_t, weight_t>>
+sampling_result_reader_t<vertex_t, weight_t>::read_next_batch()
+{
+  if (next_batch_idx_ >= number_of_batches_) { return std::nullopt; }
+
+  detail::sampling_result_batch_header_t batch_header{};
+  file_.read(reinterpret_cast<char*>(&batch_header), sizeof(batch_header));
+  CUGRAPH_EXPECTS(file_.good(),
+                  "Invalid input argument: corrupted sampling result file (truncated batch).");
+
+  auto num_seeds  = static_cast<size_t>(batch_header.num_seeds);
+  auto num_values = static_cast<size_t>(batch_header.num_values);
+  auto layout     = detail::compute_sampling_result_batch_layout(
+    result_type_,
+    (has_weights_ ? detail::sampling_result_weights_flag : uint32_t{0}) |
+      (has_hops_ ? detail::sampling_result_hops_flag : uint32_t{0}),
+    sizeof(vertex_t),
+    sizeof(weight_t),
+    num_seeds,
+    num_values);
+
+  size_t offset = sizeof(batch_header);
+  auto read_column = [this, &offset](size_t column_offset, void* data, size_t size) {
+    file_.seekg(column_offset - offset, std::ios::cur);
+    file_.read(static_cast<char*>(data), size);
+    CUGRAPH_EXPECTS(file_.good(),
+                    "Invalid input argument: corrupted sampling result file (truncated batch).");
+    offset = column_offset + size;
+  };
+
+  sampling_result_batch_t<vertex_t, weight_t> batch{};
+  batch.offsets.resize(num_seeds + 1);
+  read_column(layout.offsets, batch.offsets.data(), batch.offsets.size() * sizeof(size_t));
+  CUGRAPH_EXPECTS((batch.offsets.front() == 0) && (batch.offsets.back() == num_values),
+                  "Invalid input argument: corrupted sampling result file (invalid offsets).");
+  if (layout.srcs) {
+    batch.srcs = std::vector<vertex_t>(num_values);
+    read_column(*(layout.srcs), (*(batch.srcs)).data(), num_values * sizeof(vertex_t));
+  }
+  batch.vertices.resize(num_values);
+  read_column(layout.vertices, batch.vertices.data(), num_values * sizeof(vertex_t));
+  if (layout.weights) {
+    batch.weights = std::vector<weight_t>(layout.num_weights);
+    read_column(
+      *(layout.weights), (*(batch.weights)).data(), layout.num_weights * sizeof(weight_t));
+  }
+  if (layout.hops) {
+    batch.hops = std::vector<int32_t>(num_values);
+    read_column(*(layout.hops), (*(batch.hops)).data(), num_values * sizeof(int32_t));
+  }
+  file_.seekg(layout.size - offset, std::ios::cur);  // skip the padding bytes
+
+  ++next_batch_idx_;
+
+  return batch;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed)
+{
+  seed = detail::get_sampling_seed(seed);
+
+  return detail::random_walks_to_file_impl<vertex_t, edge_t, weight_t, multi_gpu>(
+    handle,
+    start_vertices,
+    max_length,
+    file_path,
+    batch_size,
+    edge_weight_view.has_value(),
+    [&handle, &graph_view, edge_weight_view, max_length, seed](
+      raft::device_span<vertex_t const> batch_start_vertices, size_t batch_idx) {
+      return uniform_random_walks(handle,
+                                  graph_view,
+                                  edge_weight_view,
+                                  batch_start_vertices,
+                                  max_length,
+                                  detail::get_batch_sampling_seed(seed, batch_idx));
+    });
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length,
+  weight_t p,
+  weight_t q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed)
+{
+  seed = detail::get_sampling_seed(seed);
+
+  return detail::random_walks_to_file_impl<vertex_t, edge_t, weight_t, multi_gpu>(
+    handle,
+    start_vertices,
+    max_length,
+    file_path,
+    batch_size,
+    edge_weight_view.has_value(),
+    [&handle, &graph_view, edge_weight_view, max_length, p, q, seed](
+      raft::device_span<vertex_t const> batch_start_vertices, size_t batch_idx) {
+      return node2vec_random_walks(handle,
+                                   graph_view,
+                                   edge_weight_view,
+                                   batch_start_vertices,
+                                   max_length,
+                                   p,
+                                   q,
+                                   detail::get_batch_sampling_seed(seed, batch_idx));
+    });
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check)
+{
+  using label_t = int32_t;
+
+  CUGRAPH_EXPECTS(batch_size > 0, "Invalid input argument: batch_size should be positive.");
+  CUGRAPH_EXPECTS(
+    batch_size <= static_cast<size_t>(std::numeric_limits<label_t>::max()),
+    "Invalid input argument: batch_size should not overflow int32_t (used to label the starting "
+    "vertices of a batch).");
+
+  detail::sampling_result_file_writer_t<vertex_t, weight_t> writer(
+    file_path,
+    sampling_result_type_t::NEIGHBOR_SAMPLES,
+    edge_weight_view.has_value(),
+    return_hops);
+
+  auto num_batches = detail::compute_number_of_sampling_batches<multi_gpu>(
+    handle, starting_vertices.size(), batch_size);
+  for (size_t i = 0; i < num_batches; ++i) {
+    auto batch_first = std::min(i * batch_size, starting_vertices.size());
+    auto batch_last  = std::min(batch_first + batch_size, starting_vertices.size());
+    auto num_seeds   = batch_last - batch_first;
+
+    // label the starting vertices by their (global, in multi-GPU) indices in this batch
+
+    label_t label_first{0};
+    std::optional<rmm::device_uvector<label_t>> d_output_label_lasts{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> d_output_comm_ranks{std::nullopt};
+    if constexpr (multi_gpu) {
+      auto& comm           = handle.get_comms();
+      auto const comm_size = comm.get_size();
+      auto const comm_rank = comm.get_rank();
+
+      auto num_seeds_per_rank = host_scalar_allgather(comm, num_seeds, handle.get_stream());
+      std::vector<label_t> h_output_label_lasts(comm_size);
+      size_t label_last{0};
+      for (int j = 0; j < comm_size; ++j) {
+        if (j == comm_rank) { label_first = static_cast<label_t>(label_last); }
+        label_last += num_seeds_per_rank[j];
+        h_output_label_lasts[j] = static_cast<label_t>(label_last) - label_t{1};
+      }
+      CUGRAPH_EXPECTS(
+        label_last <= static_cast<size_t>(std::numeric_limits<label_t>::max()),
+        "Invalid input argument: the aggregate batch size over the GPUs overflows int32_t.");
+      std::vector<int32_t> h_output_comm_ranks(comm_size);
+      std::iota(h_output_comm_ranks.begin(), h_output_comm_ranks.end(), int32_t{0});
+
+      // the sampled edges are shuffled to the GPU owning the label (the first GPU whose last label
+      // is not smaller than the label)
+      d_output_label_lasts = rmm::device_uvector<label_t>(comm_size, handle.get_stream());
+      d_output_comm_ranks  = rmm::device_uvector<int32_t>(comm_size, handle.get_stream());
+      raft::update_device((*d_output_label_lasts).data(),
+                          h_output_label_lasts.data(),
+                          h_output_label_lasts.size(),
+                          handle.get_stream());
+      raft::update_device((*d_output_comm_ranks).data(),
+                          h_output_comm_ranks.data(),
+                          h_output_comm_ranks.size(),
+                          handle.get_stream());
+    }
+
+    rmm::device_uvector<label_t> d_labels(num_seeds, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), d_labels.begin(), d_labels.end(), label_first);
+
+    auto [srcs, dsts, weights, edge_ids, edge_types, hops, labels, label_offsets] =
+      uniform_neighbor_sample<vertex_t, edge_t, weight_t, int32_t, label_t, false, multi_gpu>(
+        handle,
+        graph_view,
+        edge_weight_view,
+        std::nullopt,
+        std::nullopt,
+        raft::device_span<vertex_t const>(starting_vertices.data() + batch_first, num_seeds),
+        std::make_optional<raft::device_span<label_t const>>(d_labels.data(), d_labels.size()),
+        d_output_label_lasts
+          ? std::make_optional(std::make_tuple(
+              raft::device_span<label_t const>((*d_output_label_lasts).data(),
+                                               (*d_output_label_lasts).size()),
+              raft::device_span<int32_t const>((*d_output_comm_ranks).data(),
+                                               (*d_output_comm_ranks).size())))
+          : std::nullopt,
+        fan_out,
+        rng_state,
+        return_hops,
+        with_replacement,
+        do_expensive_check);
+    CUGRAPH_EXPECTS(labels.has_value() && label_offsets.has_value(),
+                    "Invalid return value: labels and label offsets are expected.");
+
+    // expand the (unique label, offsets) pairs to per-edge labels
+
+    rmm::device_uvector<label_t> edge_labels(srcs.size(), handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator((*labels).size()),
+      [labels        = (*labels).data(),
+       label_offsets = (*label_offsets).data(),
+       edge_labels   = edge_labels.data()] __device__(size_t i) {
+        thrust::fill(thrust::seq,
+                     edge_labels + label_offsets[i],
+                     edge_labels + label_offsets[i + 1],
+                     labels[i]);
+      });
+
+    if constexpr (multi_gpu) {
+      // the shuffled edges from different GPUs are concatenated, group them by label again
+      rmm::device_uvector<size_t> permutation(edge_labels.size(), handle.get_stream());
+      thrust::sequence(handle.get_thrust_policy(), permutation.begin(), permutation.end());
+      thrust::stable_sort_by_key(
+        handle.get_thrust_policy(), edge_labels.begin(), edge_labels.end(), permutation.begin());
+      detail::permute_sampling_result_column(handle, srcs, permutation);
+      detail::permute_sampling_result_column(handle, dsts, permutation);
+      if (weights) { detail::permute_sampling_result_column(handle, *weights, permutation); }
+      if (hops) { detail::permute_sampling_result_column(handle, *hops, permutation); }
+    }
+
+    // per starting vertex offsets (starting vertices without any sampled edge have empty ranges)
+
+    rmm::device_uvector<size_t> offsets(num_seeds + 1, handle.get_stream());
+    thrust::tabulate(handle.get_thrust_policy(),
+                     offsets.begin(),
+                     offsets.end(),
+                     [edge_labels = raft::device_span<label_t const>(edge_labels.data(),
+                                                                     edge_labels.size()),
+                      label_first] __device__(size_t i) {
+                       return static_cast<size_t>(thrust::distance(
+                         edge_labels.begin(),
+                         thrust::lower_bound(thrust::seq,
+                                             edge_labels.begin(),
+                                             edge_labels.end(),
+                                             label_first + static_cast<label_t>(i))));
+                     });
+
+    writer.write_batch(
+      handle,
+      raft::device_span<size_t const>(offsets.data(), offsets.size()),
+      std::make_optional<raft::device_span<vertex_t const>>(srcs.data(), srcs.size()),
+      raft::device_span<vertex_t const>(dsts.data(), dsts.size()),
+      weights ? std::make_optional<raft::device_span<weight_t const>>((*weights).data(),
+                                                                       (*weights).size())
+              : std::nullopt,
+      hops ? std::make_optional<raft::device_span<int32_t const>>((*hops).data(), (*hops).size())
+           : std::nullopt);
+  }
+
+  return writer.close();
+}
+
+}  // namespace cugraph
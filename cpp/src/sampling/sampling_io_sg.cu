@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sampling/sampling_io_impl.cuh>
+
+namespace cugraph {
+
+// sampling_result_reader_t is independent of multi_gpu
+template class sampling_result_reader_t<int32_t, float>;
+template class sampling_result_reader_t<int32_t, double>;
+template class sampling_result_reader_t<int64_t, float>;
+template class sampling_result_reader_t<int64_t, double>;
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  float p,
+  float q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  float p,
+  float q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int64_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int64_t const> start_vertices,
+  size_t max_length,
+  float p,
+  float q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  double p,
+  double q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length,
+  double p,
+  double q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int64_t const> start_vertices,
+  size_t max_length,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t node2vec_random_walks_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int64_t const> start_vertices,
+  size_t max_length,
+  double p,
+  double q,
+  std::string const& file_path,
+  size_t batch_size,
+  uint64_t seed);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<int64_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+template size_t uniform_neighbor_sample_to_file(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<int64_t const> starting_vertices,
+  raft::host_span<int32_t const> fan_out,
+  raft::random::RngState& rng_state,
+  std::string const& file_path,
+  size_t batch_size,
+  bool return_hops,
+  bool with_replacement,
+  bool do_expensive_check);
+
+}  // namespace cugraph
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/graph_io.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// maximum number of evenly spaced positions to sample lines from
+constexpr size_t max_probe_windows{16};
+
+std::string to_lower(std::string str)
+{
+  std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  return str;
+}
+
+bool is_probe_delimiter(char c)
+{
+  return (c == ',') || (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+// split a line into (at most) max_tokens tokens and return the number of tokens in the line
+size_t tokenize_line(std::string_view line, std::string_view* tokens, size_t max_tokens)
+{
+  size_t num_tokens{0};
+  size_t i{0};
+  while (i < line.size()) {
+    while ((i < line.size()) && is_probe_delimiter(line[i])) {
+      ++i;
+    }
+    if (i == line.size()) { break; }
+    auto first = i;
+    while ((i < line.size()) && !is_probe_delimiter(line[i])) {
+      ++i;
+    }
+    if (num_tokens < max_tokens) { tokens[num_tokens] = line.substr(first, i - first); }
+    ++num_tokens;
+  }
+  return num_tokens;
+}
+
+bool parse_vertex_id(std::string_view token, int64_t& val)
+{
+  auto first = token.data();
+  auto last  = token.data() + token.size();
+  if ((first != last) && (*first == '+')) { ++first; }
+  auto [ptr, ec] = std::from_chars(first, last, val);
+  return (ec == std::errc{}) && (ptr == last);
+}
+
+}  // namespace
+
+graph_file_properties_t probe_graph_file(std::string const& file_path, size_t num_sample_lines)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  CUGRAPH_EXPECTS(file.is_open(), "open (%s) failure.", file_path.c_str());
+  file.seekg(0, std::ios::end);
+  auto file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+
+  graph_file_properties_t ret{};
+
+  // 1. read the Matrix Market banner, comments, and size line (if the file is a Matrix Market file)
+
+  size_t body_offset{0};
+  std::string line{};
+  std::getline(file, line);
+  if (to_lower(line.substr(0, 14)) == "%%matrixmarket") {
+    ret.format = graph_file_format_t::MATRIX_MARKET;
+
+    std::istringstream iss(to_lower(line));
+    std::string banner{}, object{}, format{}, field{}, symmetry{};
+    iss >> banner >> object >> format >> field >> symmetry;
+    CUGRAPH_EXPECTS((object == "matrix") && (format == "coordinate"),
+                    "file does not contain matrix in coordinate format.");
+    CUGRAPH_EXPECTS((field == "pattern") || (field == "real") || (field == "integer") ||
+                      (field == "complex"),
+                    "matrix entries are not valid type.");
+    CUGRAPH_EXPECTS((symmetry == "general") || (symmetry == "symmetric") ||
+                      (symmetry == "hermitian") || (symmetry == "skew-symmetric"),
+                    "matrix symmetry is not valid type.");
+
+    bool found_size_line{false};
+    while (std::getline(file, line)) {
+      auto first = line.find_first_not_of(" \t\r");
+      if ((first != std::string::npos) && (line[first] != '%')) {
+        found_size_line = true;
+        break;
+      }
+    }
+    CUGRAPH_EXPECTS(found_size_line, "could not read matrix dimensions.");
+    std::string_view tokens[3]{};
+    int64_t sizes[3]{};
+    CUGRAPH_EXPECTS(tokenize_line(line, tokens, 3) == 3, "could not read matrix dimensions.");
+    for (size_t i = 0; i < 3; ++i) {
+      CUGRAPH_EXPECTS(parse_vertex_id(tokens[i], sizes[i]) && (sizes[i] >= 0),
+                      "could not read matrix dimensions.");
+    }
+    body_offset = file.eof() ? file_size : static_cast<size_t>(file.tellg());
+
+    ret.number_of_vertices  = static_cast<size_t>(std::max(sizes[0], sizes[1]));
+    ret.number_of_entries   = static_cast<size_t>(sizes[2]);
+    ret.max_number_of_edges = (symmetry == "general") ? ret.number_of_entries
+                                                      : ret.number_of_entries * 2;
+    ret.is_weighted         = (field != "pattern");
+    ret.is_symmetric        = (symmetry == "symmetric");
+    ret.is_exact            = true;
+  } else {
+    ret.format       = graph_file_format_t::CSV;
+    num_sample_lines = std::max(num_sample_lines, min_csv_probe_sample_lines);
+  }
+
+  if ((num_sample_lines == 0) || (body_offset >= file_size)) { return ret; }
+
+  // 2. sample lines from (up to) max_probe_windows evenly spaced windows, every window starts at
+  // the first line boundary in the window and ends at the first line boundary after the window (so
+  // the windows do not overlap and cover the entire file if every window is read to the end)
+
+  auto body_size        = file_size - body_offset;
+  auto num_windows      = std::min(max_probe_windows, num_sample_lines);
+  auto lines_per_window = (num_sample_lines + num_windows - 1) / num_windows;
+
+  std::vector<std::pair<int64_t, int64_t>> entries{};
+  entries.reserve(num_windows * lines_per_window);
+  size_t num_sampled_bytes{0};
+  bool covered{true};
+  std::optional<bool> csv_is_weighted{std::nullopt};
+  for (size_t i = 0; i < num_windows; ++i) {
+    auto window_first = body_offset + (body_size * i) / num_windows;
+    auto window_last  = body_offset + (body_size * (i + 1)) / num_windows;
+    auto pos          = window_first;
+    file.clear();
+    if (window_first > body_offset) {
+      file.seekg(window_first - 1);
+      if (file.get() != '\n') {  // skip the partial line (read by the previous window)
+        std::getline(file, line);
+        pos += line.size() + (file.eof() ? 0 : 1);
+      }
+    } else {
+      file.seekg(window_first);
+    }
+
+    size_t num_window_lines{0};
+    while ((pos < window_last) && (num_window_lines < lines_per_window) &&
+           std::getline(file, line)) {
+      auto line_bytes = line.size() + (file.eof() ? 0 : 1);
+      pos += line_bytes;
+      num_sampled_bytes += line_bytes;
+
+      std::string_view tokens[3]{};
+      auto num_tokens = tokenize_line(line, tokens, 3);
+      if ((num_tokens == 0) || (tokens[0][0] == '%') ||
+          ((ret.format == graph_file_format_t::CSV) && (tokens[0][0] == '#'))) {
+        continue;  // comment lines (e.g. SNAP edge list headers)
+      }
+      int64_t src{}, dst{};
+      CUGRAPH_EXPECTS((num_tokens >= 2) && parse_vertex_id(tokens[0], src) &&
+                        parse_vertex_id(tokens[1], dst),
+                      "Invalid input file contents (%s).",
+                      line.c_str());
+      if (ret.format == graph_file_format_t::MATRIX_MARKET) {
+        --src;  // 1-based to 0-based
+        --dst;
+      } else {
+        if (!csv_is_weighted) { csv_is_weighted = (num_tokens >= 3); }
+      }
+      entries.emplace_back(src, dst);
+      ++num_window_lines;
+    }
+    if ((pos < window_last) && !file.eof()) { covered = false; }
+  }
+
+  // 3. estimate the vertex ID range and the duplicate entry rate (and the sizes for CSV files)
+
+  ret.number_of_sampled_entries = entries.size();
+  if (entries.size() > 0) {
+    auto min_id = std::min(entries[0].first, entries[0].second);
+    auto max_id = std::max(entries[0].first, entries[0].second);
+    for (auto const& entry : entries) {
+      min_id = std::min(min_id, std::min(entry.first, entry.second));
+      max_id = std::max(max_id, std::max(entry.first, entry.second));
+    }
+    ret.min_vertex_id = min_id;
+    ret.max_vertex_id = max_id;
+
+    std::sort(entries.begin(), entries.end());
+    auto num_unique_entries = static_cast<size_t>(
+      std::distance(entries.begin(), std::unique(entries.begin(), entries.end())));
+    ret.duplicate_entry_rate = static_cast<double>(ret.number_of_sampled_entries -
+                                                   num_unique_entries) /
+                               static_cast<double>(ret.number_of_sampled_entries);
+  }
+
+  if (ret.format == graph_file_format_t::CSV) {
+    ret.is_weighted = csv_is_weighted.value_or(false);
+    ret.is_exact    = covered;
+    if (covered) {
+      ret.number_of_entries = ret.number_of_sampled_entries;
+    } else {
+      ret.number_of_entries = static_cast<size_t>(
+        static_cast<double>(body_size) * static_cast<double>(ret.number_of_sampled_entries) /
+        static_cast<double>(std::max(num_sampled_bytes, size_t{1})));
+    }
+    ret.max_number_of_edges = ret.number_of_entries;
+    ret.number_of_vertices =
+      ret.max_vertex_id ? static_cast<size_t>(std::max(*(ret.max_vertex_id) + 1, int64_t{0})) : 0;
+  }
+
+  return ret;
+}
+
+}  // namespace cugraph
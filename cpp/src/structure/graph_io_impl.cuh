@@ -0,0 +1,1192 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_io.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/transform.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// graph snapshot file layout: graph_snapshot_header_t, a table of num_sections
+// graph_snapshot_section_t entries, and the sections (each section starts at a
+// graph_snapshot_section_alignment byte boundary and the gaps are zero-filled)
+
+constexpr char graph_snapshot_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'S'};
+constexpr uint32_t graph_snapshot_version{1};
+constexpr size_t graph_snapshot_section_alignment{64};
+
+constexpr uint32_t graph_snapshot_store_transposed_flag{uint32_t{1} << 0};
+constexpr uint32_t graph_snapshot_multi_gpu_flag{uint32_t{1} << 1};
+constexpr uint32_t graph_snapshot_symmetric_flag{uint32_t{1} << 2};
+constexpr uint32_t graph_snapshot_multigraph_flag{uint32_t{1} << 3};
+constexpr uint32_t graph_snapshot_dcs_flag{uint32_t{1} << 4};
+constexpr uint32_t graph_snapshot_segment_offsets_flag{uint32_t{1} << 5};
+constexpr uint32_t graph_snapshot_weights_flag{uint32_t{1} << 6};
+constexpr uint32_t graph_snapshot_renumber_map_flag{uint32_t{1} << 7};
+
+struct graph_snapshot_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t vertex_size;
+  uint32_t edge_size;
+  uint32_t weight_size;  // 0 if edge weights are not stored
+  int32_t major_comm_size;
+  int32_t minor_comm_size;
+  int32_t major_comm_rank;
+  int32_t minor_comm_rank;
+  uint32_t num_edge_partitions;
+  uint64_t number_of_vertices;
+  uint64_t number_of_edges;
+};
+
+static_assert(sizeof(graph_snapshot_header_t) == 64);
+
+struct graph_snapshot_section_t {
+  uint64_t offset;  // in bytes from the beginning of the file
+  uint64_t size;    // in bytes
+};
+
+// global sections followed by num_edge_partitions * num_graph_snapshot_sections_per_edge_partition
+// edge partition sections
+constexpr size_t graph_snapshot_vertex_partition_range_offsets_section{0};
+constexpr size_t graph_snapshot_segment_offsets_section{1};
+constexpr size_t graph_snapshot_renumber_map_section{2};
+constexpr size_t num_graph_snapshot_global_sections{3};
+
+constexpr size_t graph_snapshot_offsets_section{0};
+constexpr size_t graph_snapshot_indices_section{1};
+constexpr size_t graph_snapshot_dcs_nzd_vertices_section{2};
+constexpr size_t graph_snapshot_weights_section{3};
+constexpr size_t num_graph_snapshot_sections_per_edge_partition{4};
+
+inline size_t graph_snapshot_edge_partition_section_idx(size_t partition_idx, size_t section)
+{
+  return num_graph_snapshot_global_sections +
+         partition_idx * num_graph_snapshot_sections_per_edge_partition + section;
+}
+
+inline size_t align_graph_snapshot_offset(size_t offset)
+{
+  return ((offset + (graph_snapshot_section_alignment - 1)) / graph_snapshot_section_alignment) *
+         graph_snapshot_section_alignment;
+}
+
+// memory-map a file (read-only), returns the mapped address and the file size
+inline std::tuple<void const*, size_t> map_file(std::string const& file_path)
+{
+  auto fd = ::open(file_path.c_str(), O_RDONLY);
+  CUGRAPH_EXPECTS(fd != -1, "Invalid input argument: failed to open %s.", file_path.c_str());
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    CUGRAPH_FAIL("fstat (%s) failure.", file_path.c_str());
+  }
+  auto size = static_cast<size_t>(st.st_size);
+  if (size == 0) {  // mmap fails with a zero length
+    ::close(fd);
+    CUGRAPH_FAIL("Invalid input argument: %s is empty.", file_path.c_str());
+  }
+  auto ptr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);  // the mapping holds its own reference to the file
+  CUGRAPH_EXPECTS(ptr != MAP_FAILED, "mmap (%s) failure.", file_path.c_str());
+  return std::make_tuple(static_cast<void const*>(ptr), size);
+}
+
+template <typename T>
+raft::host_span<T const> get_graph_snapshot_section(void const* data,
+                                                    size_t file_size,
+                                                    graph_snapshot_section_t section)
+{
+  CUGRAPH_EXPECTS((section.offset <= file_size) && (section.size <= file_size - section.offset) &&
+                    (section.offset % graph_snapshot_section_alignment == 0) &&
+                    (section.size % sizeof(T) == 0),
+                  "Invalid input argument: corrupted graph snapshot file (invalid section).");
+  return raft::host_span<T const>(
+    reinterpret_cast<T const*>(static_cast<char const*>(data) + section.offset),
+    section.size / sizeof(T));
+}
+
+template <typename T>
+rmm::device_uvector<T> copy_graph_snapshot_section_to_device(raft::handle_t const& handle,
+                                                             raft::host_span<T const> h_section)
+{
+  rmm::device_uvector<T> d_buffer(h_section.size(), handle.get_stream());
+  raft::update_device(d_buffer.data(), h_section.data(), h_section.size(), handle.get_stream());
+  return d_buffer;
+}
+
+class graph_snapshot_writer_t {
+ public:
+  explicit graph_snapshot_writer_t(std::string const& file_path)
+    : file_(file_path, std::ios::binary | std::ios::trunc)
+  {
+    CUGRAPH_EXPECTS(
+      file_.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+  }
+
+  void write(void const* data, size_t size)
+  {
+    file_.write(static_cast<char const*>(data), size);
+    CUGRAPH_EXPECTS(file_.good(), "Failed to write a graph snapshot file.");
+    offset_ += size;
+  }
+
+  template <typename T>
+  void write_host_section(graph_snapshot_section_t section, T const* data)
+  {
+    pad(section.offset);
+    write(data, section.size);
+  }
+
+  // copy a device array to the file in chunks to limit the host memory footprint
+  template <typename T>
+  void write_device_section(raft::handle_t const& handle,
+                            graph_snapshot_section_t section,
+                            T const* data)
+  {
+    constexpr size_t chunk_size = std::max(size_t{1}, (size_t{1} << 26) / sizeof(T));
+
+    pad(section.offset);
+    auto size = section.size / sizeof(T);
+    std::vector<T> h_buffer(std::min(size, chunk_size));
+    for (size_t i = 0; i < size; i += chunk_size) {
+      auto this_chunk_size = std::min(size - i, chunk_size);
+      raft::update_host(h_buffer.data(), data + i, this_chunk_size, handle.get_stream());
+      handle.sync_stream();
+      write(h_buffer.data(), this_chunk_size * sizeof(T));
+    }
+  }
+
+  void close()
+  {
+    file_.close();
+    CUGRAPH_EXPECTS(!file_.fail(), "Failed to close a graph snapshot file.");
+  }
+
+ private:
+  void pad(size_t offset)
+  {
+    assert(offset >= offset_);
+    std::vector<char> zeros(offset - offset_, char{0});
+    write(zeros.data(), zeros.size());
+  }
+
+  std::ofstream file_;
+  size_t offset_{0};
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+graph_snapshot_t<vertex_t, edge_t, weight_t>::graph_snapshot_t(std::string const& file_path)
+{
+  std::tie(data_, size_) = detail::map_file(file_path);
+
+  try {
+    CUGRAPH_EXPECTS(size_ >= sizeof(detail::graph_snapshot_header_t),
+                    "Invalid input argument: %s is not a graph snapshot file.",
+                    file_path.c_str());
+    detail::graph_snapshot_header_t header{};
+    std::memcpy(&header, data_, sizeof(header));
+    CUGRAPH_EXPECTS(
+      std::memcmp(header.magic, detail::graph_snapshot_magic, sizeof(header.magic)) == 0,
+      "Invalid input argument: %s is not a graph snapshot file.",
+      file_path.c_str());
+    CUGRAPH_EXPECTS(header.version == detail::graph_snapshot_version,
+                    "Invalid input argument: unsupported graph snapshot version (%u).",
+                    static_cast<unsigned>(header.version));
+    CUGRAPH_EXPECTS(
+      (header.vertex_size == sizeof(vertex_t)) && (header.edge_size == sizeof(edge_t)),
+      "Invalid template parameters: vertex_t and edge_t should match with the types used in saving "
+      "the graph snapshot.");
+    CUGRAPH_EXPECTS(!(header.flags & detail::graph_snapshot_weights_flag) ||
+                      (header.weight_size == sizeof(weight_t)),
+                    "Invalid template parameters: weight_t should match with the type used in "
+                    "saving the graph snapshot.");
+
+    store_transposed_ = (header.flags & detail::graph_snapshot_store_transposed_flag) != 0;
+    multi_gpu_        = (header.flags & detail::graph_snapshot_multi_gpu_flag) != 0;
+    properties_       = graph_properties_t{
+      (header.flags & detail::graph_snapshot_symmetric_flag) != 0,
+      (header.flags & detail::graph_snapshot_multigraph_flag) != 0};
+    number_of_vertices_ = static_cast<vertex_t>(header.number_of_vertices);
+    number_of_edges_    = static_cast<edge_t>(header.number_of_edges);
+    major_comm_size_    = header.major_comm_size;
+    minor_comm_size_    = header.minor_comm_size;
+    major_comm_rank_    = header.major_comm_rank;
+    minor_comm_rank_    = header.minor_comm_rank;
+
+    auto num_sections =
+      detail::num_graph_snapshot_global_sections +
+      static_cast<size_t>(header.num_edge_partitions) *
+        detail::num_graph_snapshot_sections_per_edge_partition;
+    CUGRAPH_EXPECTS(
+      size_ >= sizeof(header) + num_sections * sizeof(detail::graph_snapshot_section_t),
+      "Invalid input argument: corrupted graph snapshot file (truncated section table).");
+    std::vector<detail::graph_snapshot_section_t> sections(num_sections);
+    std::memcpy(sections.data(),
+                static_cast<char const*>(data_) + sizeof(header),
+                num_sections * sizeof(detail::graph_snapshot_section_t));
+
+    vertex_partition_range_offsets_ = detail::get_graph_snapshot_section<vertex_t>(
+      data_, size_, sections[detail::graph_snapshot_vertex_partition_range_offsets_section]);
+    if (header.flags & detail::graph_snapshot_segment_offsets_flag) {
+      edge_partition_segment_offsets_ = detail::get_graph_snapshot_section<vertex_t>(
+        data_, size_, sections[detail::graph_snapshot_segment_offsets_section]);
+    }
+    if (header.flags & detail::graph_snapshot_renumber_map_flag) {
+      renumber_map_ = detail::get_graph_snapshot_section<vertex_t>(
+        data_, size_, sections[detail::graph_snapshot_renumber_map_section]);
+    }
+
+    edge_partition_offsets_.reserve(header.num_edge_partitions);
+    edge_partition_indices_.reserve(header.num_edge_partitions);
+    if (header.flags & detail::graph_snapshot_dcs_flag) {
+      edge_partition_dcs_nzd_vertices_ = std::vector<raft::host_span<vertex_t const>>{};
+      (*edge_partition_dcs_nzd_vertices_).reserve(header.num_edge_partitions);
+    }
+    if (header.flags & detail::graph_snapshot_weights_flag) {
+      edge_partition_weights_ = std::vector<raft::host_span<weight_t const>>{};
+      (*edge_partition_weights_).reserve(header.num_edge_partitions);
+    }
+    for (size_t i = 0; i < header.num_edge_partitions; ++i) {
+      edge_partition_offsets_.push_back(detail::get_graph_snapshot_section<edge_t>(
+        data_,
+        size_,
+        sections[detail::graph_snapshot_edge_partition_section_idx(
+          i, detail::graph_snapshot_offsets_section)]));
+      edge_partition_indices_.push_back(detail::get_graph_snapshot_section<vertex_t>(
+        data_,
+        size_,
+        sections[detail::graph_snapshot_edge_partition_section_idx(
+          i, detail::graph_snapshot_indices_section)]));
+      if (edge_partition_dcs_nzd_vertices_) {
+        (*edge_partition_dcs_nzd_vertices_)
+          .push_back(detail::get_graph_snapshot_section<vertex_t>(
+            data_,
+            size_,
+            sections[detail::graph_snapshot_edge_partition_section_idx(
+              i, detail::graph_snapshot_dcs_nzd_vertices_section)]));
+      }
+      if (edge_partition_weights_) {
+        (*edge_partition_weights_)
+          .push_back(detail::get_graph_snapshot_section<weight_t>(
+            data_,
+            size_,
+            sections[detail::graph_snapshot_edge_partition_section_idx(
+              i, detail::graph_snapshot_weights_section)]));
+        CUGRAPH_EXPECTS(
+          (*edge_partition_weights_).back().size() == edge_partition_indices_.back().size(),
+          "Invalid input argument: corrupted graph snapshot file (edge weight count mismatch).");
+      }
+      CUGRAPH_EXPECTS(edge_partition_offsets_.back().size() > 0,
+                      "Invalid input argument: corrupted graph snapshot file (empty offsets).");
+    }
+  } catch (...) {
+    unmap();
+    throw;
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+graph_snapshot_t<vertex_t, edge_t, weight_t>::graph_snapshot_t(graph_snapshot_t&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+graph_snapshot_t<vertex_t, edge_t, weight_t>& graph_snapshot_t<vertex_t, edge_t, weight_t>::
+operator=(graph_snapshot_t&& other) noexcept
+{
+  if (this != &other) {
+    unmap();
+    data_                            = std::exchange(other.data_, nullptr);
+    size_                            = std::exchange(other.size_, size_t{0});
+    store_transposed_                = other.store_transposed_;
+    multi_gpu_                       = other.multi_gpu_;
+    properties_                      = other.properties_;
+    number_of_vertices_              = other.number_of_vertices_;
+    number_of_edges_                 = other.number_of_edges_;
+    major_comm_size_                 = other.major_comm_size_;
+    minor_comm_size_                 = other.minor_comm_size_;
+    major_comm_rank_                 = other.major_comm_rank_;
+    minor_comm_rank_                 = other.minor_comm_rank_;
+    vertex_partition_range_offsets_  = std::exchange(other.vertex_partition_range_offsets_, {});
+    edge_partition_offsets_          = std::move(other.edge_partition_offsets_);
+    edge_partition_indices_          = std::move(other.edge_partition_indices_);
+    edge_partition_dcs_nzd_vertices_ = std::exchange(other.edge_partition_dcs_nzd_vertices_, {});
+    edge_partition_weights_          = std::exchange(other.edge_partition_weights_, {});
+    edge_partition_segment_offsets_  = std::exchange(other.edge_partition_segment_offsets_, {});
+    renumber_map_                    = std::exchange(other.renumber_map_, {});
+  }
+  return *this;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+graph_snapshot_t<vertex_t, edge_t, weight_t>::~graph_snapshot_t()
+{
+  unmap();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void graph_snapshot_t<vertex_t, edge_t, weight_t>::unmap()
+{
+  if (data_ != nullptr) { ::munmap(const_cast<void*>(data_), size_); }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void save_graph(raft::handle_t const& handle,
+                std::string const& file_path,
+                graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                std::optional<raft::device_span<vertex_t const>> renumber_map)
+{
+  CUGRAPH_EXPECTS(!renumber_map.has_value() ||
+                    ((*renumber_map).size() ==
+                     static_cast<size_t>(graph_view.local_vertex_partition_range_size())),
+                  "Invalid input arguments: (*renumber_map).size() should match with the local "
+                  "vertex partition range size.");
+
+  auto num_edge_partitions = graph_view.number_of_local_edge_partitions();
+
+  detail::graph_snapshot_header_t header{};
+  std::memcpy(header.magic, detail::graph_snapshot_magic, sizeof(header.magic));
+  header.version = detail::graph_snapshot_version;
+  header.flags   = 0;
+  if (store_transposed) { header.flags |= detail::graph_snapshot_store_transposed_flag; }
+  if (multi_gpu) { header.flags |= detail::graph_snapshot_multi_gpu_flag; }
+  if (graph_view.is_symmetric()) { header.flags |= detail::graph_snapshot_symmetric_flag; }
+  if (graph_view.is_multigraph()) { header.flags |= detail::graph_snapshot_multigraph_flag; }
+  if (graph_view.use_dcs()) { header.flags |= detail::graph_snapshot_dcs_flag; }
+  if (graph_view.local_edge_partition_segment_offsets(0)) {
+    header.flags |= detail::graph_snapshot_segment_offsets_flag;
+  }
+  if (edge_weight_view) { header.flags |= detail::graph_snapshot_weights_flag; }
+  if (renumber_map) { header.flags |= detail::graph_snapshot_renumber_map_flag; }
+  header.vertex_size = sizeof(vertex_t);
+  header.edge_size   = sizeof(edge_t);
+  header.weight_size = edge_weight_view ? sizeof(weight_t) : 0;
+  if constexpr (multi_gpu) {
+    auto& major_comm       = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm       = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    header.major_comm_size = major_comm.get_size();
+    header.minor_comm_size = minor_comm.get_size();
+    header.major_comm_rank = major_comm.get_rank();
+    header.minor_comm_rank = minor_comm.get_rank();
+  } else {
+    header.major_comm_size = 1;
+    header.minor_comm_size = 1;
+    header.major_comm_rank = 0;
+    header.minor_comm_rank = 0;
+  }
+  header.num_edge_partitions = static_cast<uint32_t>(num_edge_partitions);
+  header.number_of_vertices  = static_cast<uint64_t>(graph_view.number_of_vertices());
+  header.number_of_edges     = static_cast<uint64_t>(graph_view.number_of_edges());
+
+  auto vertex_partition_range_offsets = graph_view.vertex_partition_range_offsets();
+  std::vector<vertex_t> edge_partition_segment_offsets{};
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    auto segment_offsets = graph_view.local_edge_partition_segment_offsets(i);
+    if (segment_offsets) {
+      edge_partition_segment_offsets.insert(
+        edge_partition_segment_offsets.end(), (*segment_offsets).begin(), (*segment_offsets).end());
+    }
+  }
+
+  // compute the section layout
+
+  std::vector<detail::graph_snapshot_section_t> sections(
+    detail::num_graph_snapshot_global_sections +
+    num_edge_partitions * detail::num_graph_snapshot_sections_per_edge_partition);
+  auto offset = detail::align_graph_snapshot_offset(
+    sizeof(header) + sections.size() * sizeof(detail::graph_snapshot_section_t));
+  auto set_section = [&sections, &offset](size_t idx, size_t size) {
+    sections[idx] = detail::graph_snapshot_section_t{offset, size};
+    offset        = detail::align_graph_snapshot_offset(offset + size);
+  };
+
+  set_section(detail::graph_snapshot_vertex_partition_range_offsets_section,
+              vertex_partition_range_offsets.size() * sizeof(vertex_t));
+  set_section(detail::graph_snapshot_segment_offsets_section,
+              edge_partition_segment_offsets.size() * sizeof(vertex_t));
+  set_section(detail::graph_snapshot_renumber_map_section,
+              renumber_map ? (*renumber_map).size() * sizeof(vertex_t) : size_t{0});
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    auto edge_partition   = graph_view.local_edge_partition_view(i);
+    auto dcs_nzd_vertices = edge_partition.dcs_nzd_vertices();
+    set_section(
+      detail::graph_snapshot_edge_partition_section_idx(i, detail::graph_snapshot_offsets_section),
+      edge_partition.offsets().size() * sizeof(edge_t));
+    set_section(
+      detail::graph_snapshot_edge_partition_section_idx(i, detail::graph_snapshot_indices_section),
+      edge_partition.indices().size() * sizeof(vertex_t));
+    set_section(detail::graph_snapshot_edge_partition_section_idx(
+                  i, detail::graph_snapshot_dcs_nzd_vertices_section),
+                dcs_nzd_vertices ? (*dcs_nzd_vertices).size() * sizeof(vertex_t) : size_t{0});
+    set_section(
+      detail::graph_snapshot_edge_partition_section_idx(i, detail::graph_snapshot_weights_section),
+      edge_weight_view
+        ? static_cast<size_t>((*edge_weight_view).edge_counts()[i]) * sizeof(weight_t)
+        : size_t{0});
+  }
+
+  // write
+
+  detail::graph_snapshot_writer_t writer(file_path);
+  writer.write(&header, sizeof(header));
+  writer.write(sections.data(), sections.size() * sizeof(detail::graph_snapshot_section_t));
+  writer.write_host_section(
+    sections[detail::graph_snapshot_vertex_partition_range_offsets_section],
+    vertex_partition_range_offsets.data());
+  writer.write_host_section(sections[detail::graph_snapshot_segment_offsets_section],
+                            edge_partition_segment_offsets.data());
+  if (renumber_map) {
+    writer.write_device_section(
+      handle, sections[detail::graph_snapshot_renumber_map_section], (*renumber_map).data());
+  }
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    auto edge_partition   = graph_view.local_edge_partition_view(i);
+    auto dcs_nzd_vertices = edge_partition.dcs_nzd_vertices();
+    writer.write_device_section(handle,
+                                sections[detail::graph_snapshot_edge_partition_section_idx(
+                                  i, detail::graph_snapshot_offsets_section)],
+                                edge_partition.offsets().data());
+    writer.write_device_section(handle,
+                                sections[detail::graph_snapshot_edge_partition_section_idx(
+                                  i, detail::graph_snapshot_indices_section)],
+                                edge_partition.indices().data());
+    if (dcs_nzd_vertices) {
+      writer.write_device_section(handle,
+                                  sections[detail::graph_snapshot_edge_partition_section_idx(
+                                    i, detail::graph_snapshot_dcs_nzd_vertices_section)],
+                                  (*dcs_nzd_vertices).data());
+    }
+    if (edge_weight_view) {
+      writer.write_device_section(handle,
+                                  sections[detail::graph_snapshot_edge_partition_section_idx(
+                                    i, detail::graph_snapshot_weights_section)],
+                                  (*edge_weight_view).value_firsts()[i]);
+    }
+  }
+  writer.close();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+load_graph(raft::handle_t const& handle, std::string const& file_path, bool do_expensive_check)
+{
+  graph_snapshot_t<vertex_t, edge_t, weight_t> snapshot(file_path);
+
+  CUGRAPH_EXPECTS(
+    (snapshot.is_storage_transposed() == store_transposed) &&
+      (snapshot.is_multi_gpu() == multi_gpu),
+    "Invalid template parameters: store_transposed and multi_gpu should match with the values "
+    "used in saving the graph snapshot.");
+
+  auto copy_to_device = [&handle](auto h_section) {
+    return detail::copy_graph_snapshot_section_to_device(handle, h_section);
+  };
+
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> edge_weight_buffers{std::nullopt};
+  if (snapshot.edge_partition_weights(0)) {
+    edge_weight_buffers = std::vector<rmm::device_uvector<weight_t>>{};
+    (*edge_weight_buffers).reserve(snapshot.number_of_local_edge_partitions());
+    for (size_t i = 0; i < snapshot.number_of_local_edge_partitions(); ++i) {
+      (*edge_weight_buffers).push_back(copy_to_device(*(snapshot.edge_partition_weights(i))));
+    }
+  }
+
+  std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+  if (snapshot.renumber_map()) { renumber_map = copy_to_device(*(snapshot.renumber_map())); }
+
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu> graph(handle);
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    CUGRAPH_EXPECTS((snapshot.major_comm_size() == major_comm.get_size()) &&
+                      (snapshot.minor_comm_size() == minor_comm.get_size()) &&
+                      (snapshot.major_comm_rank() == major_comm.get_rank()) &&
+                      (snapshot.minor_comm_rank() == minor_comm.get_rank()),
+                    "Invalid input argument: the graph snapshot should be loaded with the graph "
+                    "sub-communicator sizes and ranks used in saving the snapshot.");
+    CUGRAPH_EXPECTS(
+      snapshot.number_of_local_edge_partitions() == static_cast<size_t>(minor_comm.get_size()),
+      "Invalid input argument: corrupted graph snapshot file (invalid edge partition count).");
+
+    std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets{};
+    std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices{};
+    std::optional<std::vector<rmm::device_uvector<vertex_t>>> edge_partition_dcs_nzd_vertices{
+      std::nullopt};
+    edge_partition_offsets.reserve(snapshot.number_of_local_edge_partitions());
+    edge_partition_indices.reserve(snapshot.number_of_local_edge_partitions());
+    if (snapshot.edge_partition_dcs_nzd_vertices(0)) {
+      edge_partition_dcs_nzd_vertices = std::vector<rmm::device_uvector<vertex_t>>{};
+      (*edge_partition_dcs_nzd_vertices).reserve(snapshot.number_of_local_edge_partitions());
+    }
+    for (size_t i = 0; i < snapshot.number_of_local_edge_partitions(); ++i) {
+      edge_partition_offsets.push_back(copy_to_device(snapshot.edge_partition_offsets(i)));
+      edge_partition_indices.push_back(copy_to_device(snapshot.edge_partition_indices(i)));
+      if (edge_partition_dcs_nzd_vertices) {
+        (*edge_partition_dcs_nzd_vertices)
+          .push_back(copy_to_device(*(snapshot.edge_partition_dcs_nzd_vertices(i))));
+      }
+    }
+
+    auto h_vertex_partition_range_offsets = snapshot.vertex_partition_range_offsets();
+    auto h_segment_offsets                = snapshot.edge_partition_segment_offsets();
+    partition_t<vertex_t> partition(
+      std::vector<vertex_t>(h_vertex_partition_range_offsets.begin(),
+                            h_vertex_partition_range_offsets.end()),
+      major_comm.get_size(),
+      minor_comm.get_size(),
+      major_comm.get_rank(),
+      minor_comm.get_rank());
+
+    graph = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(edge_partition_offsets),
+      std::move(edge_partition_indices),
+      std::move(edge_partition_dcs_nzd_vertices),
+      cugraph::graph_meta_t<vertex_t, edge_t, multi_gpu>{
+        snapshot.number_of_vertices(),
+        snapshot.number_of_edges(),
+        snapshot.properties(),
+        partition,
+        h_segment_offsets ? std::vector<vertex_t>((*h_segment_offsets).begin(),
+                                                  (*h_segment_offsets).end())
+                          : std::vector<vertex_t>{}},
+      do_expensive_check);
+  } else {
+    CUGRAPH_EXPECTS(
+      snapshot.number_of_local_edge_partitions() == size_t{1},
+      "Invalid input argument: corrupted graph snapshot file (invalid edge partition count).");
+
+    auto h_segment_offsets = snapshot.edge_partition_segment_offsets();
+
+    graph = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(
+      handle,
+      copy_to_device(snapshot.edge_partition_offsets(0)),
+      copy_to_device(snapshot.edge_partition_indices(0)),
+      cugraph::graph_meta_t<vertex_t, edge_t, multi_gpu>{
+        snapshot.number_of_vertices(),
+        snapshot.properties(),
+        h_segment_offsets ? std::optional<std::vector<vertex_t>>{std::vector<vertex_t>(
+                              (*h_segment_offsets).begin(), (*h_segment_offsets).end())}
+                          : std::nullopt},
+      do_expensive_check);
+  }
+
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>
+    edge_weights{std::nullopt};
+  if (edge_weight_buffers) {
+    edge_weights =
+      edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>(
+        std::move(*edge_weight_buffers));
+  }
+
+  handle.sync_stream();  // the host spans are invalidated when snapshot goes out of scope
+
+  return std::make_tuple(std::move(graph), std::move(edge_weights), std::move(renumber_map));
+}
+
+namespace detail {
+
+// edge property column file layout: edge_property_file_header_t, a table of num_edge_partitions
+// graph_snapshot_section_t entries, and the per edge partition values (each section starts at a
+// graph_snapshot_section_alignment byte boundary)
+
+constexpr char edge_property_file_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'E'};
+constexpr uint32_t edge_property_file_version{1};
+
+constexpr uint32_t edge_property_file_multi_gpu_flag{uint32_t{1} << 0};
+constexpr uint32_t edge_property_file_floating_point_value_flag{uint32_t{1} << 1};
+constexpr uint32_t edge_property_file_signed_value_flag{uint32_t{1} << 2};
+
+struct edge_property_file_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t edge_size;
+  uint32_t value_size;
+  int32_t major_comm_size;
+  int32_t minor_comm_size;
+  int32_t major_comm_rank;
+  int32_t minor_comm_rank;
+  uint32_t num_edge_partitions;
+  uint32_t reserved0;
+  uint64_t number_of_local_edges;
+  uint64_t reserved1;
+};
+
+static_assert(sizeof(edge_property_file_header_t) == 64);
+
+// value_t is identified by its size and these flags (so e.g. int32_t and float do not match)
+template <typename value_t>
+constexpr uint32_t edge_property_file_value_flags()
+{
+  static_assert(std::is_arithmetic_v<value_t>);
+  return (std::is_floating_point_v<value_t> ? edge_property_file_floating_point_value_flag : 0) |
+         (std::is_signed_v<value_t> ? edge_property_file_signed_value_flag : 0);
+}
+
+}  // namespace detail
+
+template <typename edge_t, typename value_t>
+edge_property_file_t<edge_t, value_t>::edge_property_file_t(std::string const& file_path)
+{
+  std::tie(data_, size_) = detail::map_file(file_path);
+
+  try {
+    CUGRAPH_EXPECTS(size_ >= sizeof(detail::edge_property_file_header_t),
+                    "Invalid input argument: %s is not an edge property file.",
+                    file_path.c_str());
+    detail::edge_property_file_header_t header{};
+    std::memcpy(&header, data_, sizeof(header));
+    CUGRAPH_EXPECTS(
+      std::memcmp(header.magic, detail::edge_property_file_magic, sizeof(header.magic)) == 0,
+      "Invalid input argument: %s is not an edge property file.",
+      file_path.c_str());
+    CUGRAPH_EXPECTS(header.version == detail::edge_property_file_version,
+                    "Invalid input argument: unsupported edge property file version (%u).",
+                    static_cast<unsigned>(header.version));
+    CUGRAPH_EXPECTS(
+      (header.edge_size == sizeof(edge_t)) && (header.value_size == sizeof(value_t)) &&
+        ((header.flags & ~detail::edge_property_file_multi_gpu_flag) ==
+         detail::edge_property_file_value_flags<value_t>()),
+      "Invalid template parameters: edge_t and value_t should match with the types used in saving "
+      "the edge property.");
+
+    multi_gpu_       = (header.flags & detail::edge_property_file_multi_gpu_flag) != 0;
+    major_comm_size_ = header.major_comm_size;
+    minor_comm_size_ = header.minor_comm_size;
+    major_comm_rank_ = header.major_comm_rank;
+    minor_comm_rank_ = header.minor_comm_rank;
+
+    auto num_sections = static_cast<size_t>(header.num_edge_partitions);
+    CUGRAPH_EXPECTS(
+      size_ >= sizeof(header) + num_sections * sizeof(detail::graph_snapshot_section_t),
+      "Invalid input argument: corrupted edge property file (truncated section table).");
+    std::vector<detail::graph_snapshot_section_t> sections(num_sections);
+    std::memcpy(sections.data(),
+                static_cast<char const*>(data_) + sizeof(header),
+                num_sections * sizeof(detail::graph_snapshot_section_t));
+
+    edge_partition_values_.reserve(num_sections);
+    size_t number_of_local_edges{0};
+    for (size_t i = 0; i < num_sections; ++i) {
+      edge_partition_values_.push_back(
+        detail::get_graph_snapshot_section<value_t>(data_, size_, sections[i]));
+      number_of_local_edges += edge_partition_values_.back().size();
+    }
+    CUGRAPH_EXPECTS(number_of_local_edges == header.number_of_local_edges,
+                    "Invalid input argument: corrupted edge property file (edge count mismatch).");
+  } catch (...) {
+    unmap();
+    throw;
+  }
+}
+
+template <typename edge_t, typename value_t>
+edge_property_file_t<edge_t, value_t>::edge_property_file_t(edge_property_file_t&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+template <typename edge_t, typename value_t>
+edge_property_file_t<edge_t, value_t>& edge_property_file_t<edge_t, value_t>::operator=(
+  edge_property_file_t&& other) noexcept
+{
+  if (this != &other) {
+    unmap();
+    data_                  = std::exchange(other.data_, nullptr);
+    size_                  = std::exchange(other.size_, size_t{0});
+    multi_gpu_             = other.multi_gpu_;
+    major_comm_size_       = other.major_comm_size_;
+    minor_comm_size_       = other.minor_comm_size_;
+    major_comm_rank_       = other.major_comm_rank_;
+    minor_comm_rank_       = other.minor_comm_rank_;
+    edge_partition_values_ = std::move(other.edge_partition_values_);
+  }
+  return *this;
+}
+
+template <typename edge_t, typename value_t>
+edge_property_file_t<edge_t, value_t>::~edge_property_file_t()
+{
+  unmap();
+}
+
+template <typename edge_t, typename value_t>
+void edge_property_file_t<edge_t, value_t>::unmap()
+{
+  if (data_ != nullptr) { ::munmap(const_cast<void*>(data_), size_); }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+void save_edge_property(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, value_t const*> edge_property_view)
+{
+  auto num_edge_partitions = graph_view.number_of_local_edge_partitions();
+  CUGRAPH_EXPECTS(edge_property_view.value_firsts().size() == num_edge_partitions,
+                  "Invalid input arguments: edge_property_view should have one value array per "
+                  "local edge partition of graph_view.");
+
+  detail::edge_property_file_header_t header{};
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, detail::edge_property_file_magic, sizeof(header.magic));
+  header.version = detail::edge_property_file_version;
+  header.flags   = detail::edge_property_file_value_flags<value_t>();
+  if (multi_gpu) { header.flags |= detail::edge_property_file_multi_gpu_flag; }
+  header.edge_size  = sizeof(edge_t);
+  header.value_size = sizeof(value_t);
+  if constexpr (multi_gpu) {
+    auto& major_comm       = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm       = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    header.major_comm_size = major_comm.get_size();
+    header.minor_comm_size = minor_comm.get_size();
+    header.major_comm_rank = major_comm.get_rank();
+    header.minor_comm_rank = minor_comm.get_rank();
+  } else {
+    header.major_comm_size = 1;
+    header.minor_comm_size = 1;
+    header.major_comm_rank = 0;
+    header.minor_comm_rank = 0;
+  }
+  header.num_edge_partitions = static_cast<uint32_t>(num_edge_partitions);
+
+  // compute the section layout
+
+  std::vector<detail::graph_snapshot_section_t> sections(num_edge_partitions);
+  auto offset = detail::align_graph_snapshot_offset(
+    sizeof(header) + sections.size() * sizeof(detail::graph_snapshot_section_t));
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    auto number_of_edges = graph_view.local_edge_partition_view(i).number_of_edges();
+    CUGRAPH_EXPECTS(edge_property_view.edge_counts()[i] == number_of_edges,
+                    "Invalid input arguments: edge_property_view edge counts should match with "
+                    "the local edge partition edge counts of graph_view.");
+    sections[i] = detail::graph_snapshot_section_t{
+      offset, static_cast<size_t>(number_of_edges) * sizeof(value_t)};
+    offset = detail::align_graph_snapshot_offset(offset + sections[i].size);
+    header.number_of_local_edges += static_cast<uint64_t>(number_of_edges);
+  }
+
+  // write
+
+  detail::graph_snapshot_writer_t writer(file_path);
+  writer.write(&header, sizeof(header));
+  writer.write(sections.data(), sections.size() * sizeof(detail::graph_snapshot_section_t));
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    writer.write_device_section(handle, sections[i], edge_property_view.value_firsts()[i]);
+  }
+  writer.close();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, value_t>
+load_edge_property(raft::handle_t const& handle,
+                   graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                   edge_property_file_t<edge_t, value_t> const& edge_property_file)
+{
+  CUGRAPH_EXPECTS(edge_property_file.is_multi_gpu() == multi_gpu,
+                  "Invalid template parameters: multi_gpu should match with the value used in "
+                  "saving the edge property.");
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    CUGRAPH_EXPECTS((edge_property_file.major_comm_size() == major_comm.get_size()) &&
+                      (edge_property_file.minor_comm_size() == minor_comm.get_size()) &&
+                      (edge_property_file.major_comm_rank() == major_comm.get_rank()) &&
+                      (edge_property_file.minor_comm_rank() == minor_comm.get_rank()),
+                    "Invalid input argument: the edge property should be loaded with the graph "
+                    "sub-communicator sizes and ranks used in saving the edge property.");
+  }
+  CUGRAPH_EXPECTS(edge_property_file.number_of_local_edge_partitions() ==
+                    graph_view.number_of_local_edge_partitions(),
+                  "Invalid input argument: edge_property_file should have one value array per "
+                  "local edge partition of graph_view.");
+
+  std::vector<rmm::device_uvector<value_t>> buffers{};
+  buffers.reserve(graph_view.number_of_local_edge_partitions());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    CUGRAPH_EXPECTS(edge_property_file.edge_partition_edge_count(i) ==
+                      graph_view.local_edge_partition_view(i).number_of_edges(),
+                    "Invalid input argument: edge_property_file edge counts should match with the "
+                    "local edge partition edge counts of graph_view.");
+    buffers.push_back(detail::copy_graph_snapshot_section_to_device(
+      handle, edge_property_file.edge_partition_values(i)));
+  }
+
+  // the host spans are valid as long as edge_property_file is alive, but the caller may release
+  // edge_property_file as soon as this function returns
+  handle.sync_stream();
+
+  return edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, value_t>(
+    std::move(buffers));
+}
+
+namespace detail {
+
+// renumber map file layout: renumber_map_header_t, the renumber map labels, and the index slots
+// (both arrays start at a graph_snapshot_section_alignment byte boundary)
+
+constexpr char renumber_map_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'M'};
+constexpr uint32_t renumber_map_version{1};
+
+struct renumber_map_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t vertex_size;
+  uint64_t local_int_vertex_first;
+  uint64_t num_vertices;
+  uint64_t num_index_slots;
+  uint64_t reserved[3];
+};
+
+static_assert(sizeof(renumber_map_header_t) == 64);
+
+inline std::tuple<size_t, size_t> renumber_map_section_offsets(size_t vertex_size,
+                                                               size_t num_vertices)
+{
+  auto labels_offset = align_graph_snapshot_offset(sizeof(renumber_map_header_t));
+  auto slots_offset  = align_graph_snapshot_offset(labels_offset + num_vertices * vertex_size);
+  return std::make_tuple(labels_offset, slots_offset);
+}
+
+// MurmurHash3 64 bit finalizer (this should be identical in the host and device code as the index
+// is built in the host and can be probed in both)
+__host__ __device__ inline uint64_t renumber_map_index_hash(uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return key;
+}
+
+// returns the position of ext_vertex in labels (invalid_vertex_id if not found), the slots are
+// validated only as they are probed (a slot value outside [0, num_labels) ends the probe as if the
+// slot were empty) so a look-up pages in only the probed slots
+template <typename vertex_t>
+__host__ __device__ vertex_t probe_renumber_map_index(vertex_t const* labels,
+                                                      size_t num_labels,
+                                                      vertex_t const* slots,
+                                                      size_t num_slots,
+                                                      vertex_t ext_vertex)
+{
+  if (ext_vertex == invalid_vertex_id<vertex_t>::value) { return ext_vertex; }
+  auto mask = num_slots - 1;
+  auto slot =
+    static_cast<size_t>(renumber_map_index_hash(static_cast<uint64_t>(ext_vertex))) & mask;
+  for (size_t i = 0; i < num_slots; ++i) {  // at least half of the slots are empty
+    auto pos = slots[slot];
+    if ((pos < vertex_t{0}) || (static_cast<size_t>(pos) >= num_labels)) {
+      return invalid_vertex_id<vertex_t>::value;  // an empty (or a corrupted) slot
+    }
+    if (labels[pos] == ext_vertex) { return pos; }
+    slot = (slot + 1) & mask;
+  }
+  return invalid_vertex_id<vertex_t>::value;  // reached only with a corrupted index
+}
+
+template <typename vertex_t>
+std::vector<vertex_t> build_renumber_map_index(std::vector<vertex_t> const& labels)
+{
+  size_t num_slots{1};
+  while (num_slots < labels.size() * 2) {
+    num_slots *= 2;
+  }
+  std::vector<vertex_t> slots(num_slots, invalid_vertex_id<vertex_t>::value);
+
+  auto mask = num_slots - 1;
+  for (size_t i = 0; i < labels.size(); ++i) {
+    CUGRAPH_EXPECTS(labels[i] != invalid_vertex_id<vertex_t>::value,
+                    "Invalid input argument: renumber_map_labels have invalid vertex IDs.");
+    auto slot =
+      static_cast<size_t>(renumber_map_index_hash(static_cast<uint64_t>(labels[i]))) & mask;
+    while (slots[slot] != invalid_vertex_id<vertex_t>::value) {
+      CUGRAPH_EXPECTS(labels[slots[slot]] != labels[i],
+                      "Invalid input argument: renumber_map_labels have duplicate elements.");
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = static_cast<vertex_t>(i);
+  }
+
+  return slots;
+}
+
+}  // namespace detail
+
+template <typename vertex_t>
+renumber_map_t<vertex_t>::renumber_map_t(std::string const& file_path, bool do_expensive_check)
+{
+  std::tie(data_, size_) = detail::map_file(file_path);
+
+  try {
+    detail::renumber_map_header_t header{};
+    CUGRAPH_EXPECTS(size_ >= sizeof(header),
+                    "Invalid input argument: %s is not a renumber map file.",
+                    file_path.c_str());
+    std::memcpy(&header, data_, sizeof(header));
+    CUGRAPH_EXPECTS(
+      std::memcmp(header.magic, detail::renumber_map_magic, sizeof(header.magic)) == 0,
+      "Invalid input argument: %s is not a renumber map file.",
+      file_path.c_str());
+    CUGRAPH_EXPECTS(header.version == detail::renumber_map_version,
+                    "Invalid input argument: unsupported renumber map version (%u).",
+                    static_cast<unsigned>(header.version));
+    CUGRAPH_EXPECTS(header.vertex_size == sizeof(vertex_t),
+                    "Invalid template parameters: vertex_t should match with the type used in "
+                    "saving the renumber map.");
+    CUGRAPH_EXPECTS((header.num_index_slots > header.num_vertices) &&
+                      ((header.num_index_slots & (header.num_index_slots - 1)) == 0),
+                    "Invalid input argument: corrupted renumber map file (invalid index size).");
+
+    auto [labels_offset, slots_offset] =
+      detail::renumber_map_section_offsets(sizeof(vertex_t), header.num_vertices);
+    local_int_vertex_first_ = static_cast<vertex_t>(header.local_int_vertex_first);
+    renumber_map_labels_    = detail::get_graph_snapshot_section<vertex_t>(
+      data_,
+      size_,
+      detail::graph_snapshot_section_t{labels_offset, header.num_vertices * sizeof(vertex_t)});
+    index_slots_ = detail::get_graph_snapshot_section<vertex_t>(
+      data_,
+      size_,
+      detail::graph_snapshot_section_t{slots_offset, header.num_index_slots * sizeof(vertex_t)});
+
+    if (do_expensive_check) {  // this pages in the entire index
+      size_t num_occupied_slots{0};
+      for (size_t i = 0; i < index_slots_.size(); ++i) {
+        auto pos = index_slots_[i];
+        if (pos != invalid_vertex_id<vertex_t>::value) {
+          CUGRAPH_EXPECTS(
+            (pos >= vertex_t{0}) && (static_cast<uint64_t>(pos) < header.num_vertices),
+            "Invalid input argument: corrupted renumber map file (invalid index slot).");
+          ++num_occupied_slots;
+        }
+      }
+      CUGRAPH_EXPECTS(
+        num_occupied_slots == header.num_vertices,
+        "Invalid input argument: corrupted renumber map file (invalid index size).");
+    }
+  } catch (...) {
+    unmap();
+    throw;
+  }
+}
+
+template <typename vertex_t>
+renumber_map_t<vertex_t>::renumber_map_t(renumber_map_t&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+template <typename vertex_t>
+renumber_map_t<vertex_t>& renumber_map_t<vertex_t>::operator=(renumber_map_t&& other) noexcept
+{
+  if (this != &other) {
+    unmap();
+    data_                   = std::exchange(other.data_, nullptr);
+    size_                   = std::exchange(other.size_, size_t{0});
+    local_int_vertex_first_ = other.local_int_vertex_first_;
+    renumber_map_labels_    = std::exchange(other.renumber_map_labels_, {});
+    index_slots_            = std::exchange(other.index_slots_, {});
+  }
+  return *this;
+}
+
+template <typename vertex_t>
+renumber_map_t<vertex_t>::~renumber_map_t()
+{
+  unmap();
+}
+
+template <typename vertex_t>
+void renumber_map_t<vertex_t>::unmap()
+{
+  if (data_ != nullptr) { ::munmap(const_cast<void*>(data_), size_); }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+template <typename vertex_t>
+vertex_t renumber_map_t<vertex_t>::find(vertex_t ext_vertex) const
+{
+  auto pos = detail::probe_renumber_map_index(renumber_map_labels_.data(),
+                                              renumber_map_labels_.size(),
+                                              index_slots_.data(),
+                                              index_slots_.size(),
+                                              ext_vertex);
+  return pos != invalid_vertex_id<vertex_t>::value ? local_int_vertex_first_ + pos : pos;
+}
+
+template <typename vertex_t>
+void renumber_map_t<vertex_t>::find(raft::host_span<vertex_t const> ext_vertices,
+                                    raft::host_span<vertex_t> int_vertices,
+                                    size_t num_threads) const
+{
+  CUGRAPH_EXPECTS(ext_vertices.size() == int_vertices.size(),
+                  "Invalid input argument: ext_vertices.size() and int_vertices.size() should "
+                  "coincide.");
+
+  constexpr size_t min_chunk_size{size_t{1} << 16};  // not worth spawning a thread for less
+
+  if (num_threads == 0) { num_threads = std::max(std::thread::hardware_concurrency(), 1u); }
+  num_threads = std::max(
+    std::min(num_threads, (ext_vertices.size() + (min_chunk_size - 1)) / min_chunk_size),
+    size_t{1});
+  auto chunk_size = (ext_vertices.size() + (num_threads - 1)) / num_threads;
+
+  auto find_chunk = [this, ext_vertices, int_vertices, chunk_size](size_t i) {
+    auto first = std::min(i * chunk_size, ext_vertices.size());
+    auto last  = std::min(first + chunk_size, ext_vertices.size());
+    for (auto j = first; j < last; ++j) {
+      int_vertices[j] = find(ext_vertices[j]);
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  threads.reserve(num_threads - 1);
+  for (size_t i = 1; i < num_threads; ++i) {
+    threads.emplace_back(find_chunk, i);
+  }
+  find_chunk(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename vertex_t>
+void save_renumber_map(raft::handle_t const& handle,
+                       std::string const& file_path,
+                       raft::device_span<vertex_t const> renumber_map_labels,
+                       vertex_t local_int_vertex_first)
+{
+  std::vector<vertex_t> h_labels(renumber_map_labels.size());
+  raft::update_host(
+    h_labels.data(), renumber_map_labels.data(), renumber_map_labels.size(), handle.get_stream());
+  handle.sync_stream();
+
+  auto h_slots = detail::build_renumber_map_index(h_labels);
+
+  detail::renumber_map_header_t header{};
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, detail::renumber_map_magic, sizeof(header.magic));
+  header.version                = detail::renumber_map_version;
+  header.vertex_size            = sizeof(vertex_t);
+  header.local_int_vertex_first = static_cast<uint64_t>(local_int_vertex_first);
+  header.num_vertices           = h_labels.size();
+  header.num_index_slots        = h_slots.size();
+
+  auto [labels_offset, slots_offset] =
+    detail::renumber_map_section_offsets(sizeof(vertex_t), h_labels.size());
+
+  detail::graph_snapshot_writer_t writer(file_path);
+  writer.write(&header, sizeof(header));
+  writer.write_host_section(
+    detail::graph_snapshot_section_t{labels_offset, h_labels.size() * sizeof(vertex_t)},
+    h_labels.data());
+  writer.write_host_section(
+    detail::graph_snapshot_section_t{slots_offset, h_slots.size() * sizeof(vertex_t)},
+    h_slots.data());
+  writer.close();
+}
+
+template <typename vertex_t>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           raft::device_span<vertex_t const> renumber_map_labels,
+                           raft::device_span<vertex_t const> index_slots,
+                           vertex_t local_int_vertex_first)
+{
+  CUGRAPH_EXPECTS((index_slots.size() > renumber_map_labels.size()) &&
+                    ((index_slots.size() & (index_slots.size() - 1)) == 0),
+                  "Invalid input argument: index_slots should be the index saved with "
+                  "renumber_map_labels.");
+
+  thrust::transform(
+    handle.get_thrust_policy(),
+    vertices,
+    vertices + num_vertices,
+    vertices,
+    [renumber_map_labels, index_slots, local_int_vertex_first] __device__(auto v) {
+      auto pos = detail::probe_renumber_map_index(renumber_map_labels.data(),
+                                                  renumber_map_labels.size(),
+                                                  index_slots.data(),
+                                                  index_slots.size(),
+                                                  v);
+      return pos != invalid_vertex_id<vertex_t>::value ? local_int_vertex_first + pos : pos;
+    });
+}
+
+}  // namespace cugraph
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <structure/graph_io_impl.cuh>
+
+namespace cugraph {
+
+// graph_snapshot_t is independent of multi_gpu
+
+template class graph_snapshot_t<int32_t, int32_t, float>;
+template class graph_snapshot_t<int32_t, int32_t, double>;
+template class graph_snapshot_t<int32_t, int64_t, float>;
+template class graph_snapshot_t<int32_t, int64_t, double>;
+template class graph_snapshot_t<int64_t, int64_t, float>;
+template class graph_snapshot_t<int64_t, int64_t, double>;
+
+// renumber map files are independent of multi_gpu
+
+template class renumber_map_t<int32_t>;
+template class renumber_map_t<int64_t>;
+
+template void save_renumber_map(raft::handle_t const& handle,
+                                std::string const& file_path,
+                                raft::device_span<int32_t const> renumber_map_labels,
+                                int32_t local_int_vertex_first);
+
+template void save_renumber_map(raft::handle_t const& handle,
+                                std::string const& file_path,
+                                raft::device_span<int64_t const> renumber_map_labels,
+                                int64_t local_int_vertex_first);
+
+template void renumber_ext_vertices(raft::handle_t const& handle,
+                                    int32_t* vertices /* [INOUT] */,
+                                    size_t num_vertices,
+                                    raft::device_span<int32_t const> renumber_map_labels,
+                                    raft::device_span<int32_t const> index_slots,
+                                    int32_t local_int_vertex_first);
+
+template void renumber_ext_vertices(raft::handle_t const& handle,
+                                    int64_t* vertices /* [INOUT] */,
+                                    size_t num_vertices,
+                                    raft::device_span<int64_t const> renumber_map_labels,
+                                    raft::device_span<int64_t const> index_slots,
+                                    int64_t local_int_vertex_first);
+
+// edge property files are independent of multi_gpu
+
+template class edge_property_file_t<int32_t, float>;
+template class edge_property_file_t<int32_t, double>;
+template class edge_property_file_t<int32_t, int32_t>;
+template class edge_property_file_t<int64_t, float>;
+template class edge_property_file_t<int64_t, double>;
+template class edge_property_file_t<int64_t, int32_t>;
+template class edge_property_file_t<int64_t, int64_t>;
+
+// SG instantiation
+
+template void save_graph<int32_t, int32_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int32_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int32_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int32_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int32_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map);
+
+template void save_graph<int64_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map);
+
+template void save_graph<int64_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map);
+
+template void save_graph<int64_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map);
+
+template void save_graph<int64_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int32_t, float, false, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int32_t, float, true, false>(raft::handle_t const& handle,
+                                                 std::string const& file_path,
+                                                 bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int32_t, double, false, false>(raft::handle_t const& handle,
+                                                   std::string const& file_path,
+                                                   bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int32_t, double, true, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int64_t, false, false>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int64_t, float, false, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int64_t, true, false>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int64_t, float, true, false>(raft::handle_t const& handle,
+                                                 std::string const& file_path,
+                                                 bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int64_t, false, false>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int64_t, double, false, false>(raft::handle_t const& handle,
+                                                   std::string const& file_path,
+                                                   bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int64_t, true, false>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+load_graph<int32_t, int64_t, double, true, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+load_graph<int64_t, int64_t, float, false, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+load_graph<int64_t, int64_t, float, true, false>(raft::handle_t const& handle,
+                                                 std::string const& file_path,
+                                                 bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+load_graph<int64_t, int64_t, double, false, false>(raft::handle_t const& handle,
+                                                   std::string const& file_path,
+                                                   bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+load_graph<int64_t, int64_t, double, true, false>(raft::handle_t const& handle,
+                                                  std::string const& file_path,
+                                                  bool do_expensive_check);
+
+template void save_edge_property<int32_t, int32_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_property_view);
+
+template void save_edge_property<int32_t, int32_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_property_view);
+
+template void save_edge_property<int32_t, int32_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_property_view);
+
+template void save_edge_property<int32_t, int32_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_property_view);
+
+template void save_edge_property<int32_t, int32_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int32_t, int32_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_property_view);
+
+template void save_edge_property<int32_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_property_view);
+
+template void save_edge_property<int64_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_property_view);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>
+load_edge_property<int32_t, int32_t, float, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_file_t<int32_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, false>, float>
+load_edge_property<int32_t, int32_t, float, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_file_t<int32_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>
+load_edge_property<int32_t, int32_t, double, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_file_t<int32_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, false>, double>
+load_edge_property<int32_t, int32_t, double, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_file_t<int32_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, false>, int32_t>
+load_edge_property<int32_t, int32_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_file_t<int32_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, false>, int32_t>
+load_edge_property<int32_t, int32_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_file_t<int32_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, false, false>, float>
+load_edge_property<int32_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, true, false>, float>
+load_edge_property<int32_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, false, false>, double>
+load_edge_property<int32_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, true, false>, double>
+load_edge_property<int32_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, false, false>, int32_t>
+load_edge_property<int32_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, true, false>, int32_t>
+load_edge_property<int32_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, false, false>, int64_t>
+load_edge_property<int32_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, int64_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int32_t, int64_t, true, false>, int64_t>
+load_edge_property<int32_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, int64_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>
+load_edge_property<int64_t, int64_t, float, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>
+load_edge_property<int64_t, int64_t, float, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, float> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>
+load_edge_property<int64_t, int64_t, double, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>
+load_edge_property<int64_t, int64_t, double, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, double> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int32_t>
+load_edge_property<int64_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int32_t>
+load_edge_property<int64_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, int32_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int64_t>
+load_edge_property<int64_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_file_t<int64_t, int64_t> const& edge_property_file);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int64_t>
+load_edge_property<int64_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_file_t<int64_t, int64_t> const& edge_property_file);
+
+}  // namespace cugraph
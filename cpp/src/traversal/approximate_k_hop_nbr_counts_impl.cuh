@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/update_edge_src_dst_property.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// registers are one byte each, packed four per word, and reduced 16 registers (a chunk) at a time
+using hll_chunk_t = thrust::tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+
+constexpr size_t hll_registers_per_word  = sizeof(uint32_t);
+constexpr size_t hll_words_per_chunk     = thrust::tuple_size<hll_chunk_t>::value;
+constexpr size_t hll_registers_per_chunk = hll_registers_per_word * hll_words_per_chunk;
+
+__host__ __device__ inline uint32_t hll_bytewise_max(uint32_t lhs, uint32_t rhs)
+{
+#ifdef __CUDA_ARCH__
+  return __vmaxu4(lhs, rhs);
+#else
+  uint32_t ret{0};
+  for (size_t i = 0; i < hll_registers_per_word; ++i) {
+    auto shift = static_cast<uint32_t>(i * 8);
+    ret |= std::max((lhs >> shift) & uint32_t{0xff}, (rhs >> shift) & uint32_t{0xff}) << shift;
+  }
+  return ret;
+#endif
+}
+
+// the union of two HyperLogLog sketches is the register-wise maximum
+struct hll_chunk_union_t {
+  using value_type                       = hll_chunk_t;
+  static constexpr bool pure_function    = true;  // this can be called in any process
+  inline static value_type const identity_element =
+    thrust::make_tuple(uint32_t{0}, uint32_t{0}, uint32_t{0}, uint32_t{0});
+
+  __host__ __device__ value_type operator()(value_type const& lhs, value_type const& rhs) const
+  {
+    return thrust::make_tuple(hll_bytewise_max(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              hll_bytewise_max(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                              hll_bytewise_max(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+                              hll_bytewise_max(thrust::get<3>(lhs), thrust::get<3>(rhs)));
+  }
+};
+
+// the chunk_idx'th chunk of the sketch of the v_offset'th vertex in the local vertex partition
+// range (or in the edge partition minor range in single-GPU)
+template <typename vertex_t>
+struct hll_chunk_reader_t {
+  uint32_t const* registers{nullptr};
+  size_t words_per_vertex{0};
+  size_t chunk_idx{0};
+
+  __device__ hll_chunk_t operator()(vertex_t v_offset) const
+  {
+    auto first = registers + static_cast<size_t>(v_offset) * words_per_vertex +
+                 chunk_idx * hll_words_per_chunk;
+    return thrust::make_tuple(*first, *(first + 1), *(first + 2), *(first + 3));
+  }
+};
+
+template <typename vertex_t>
+struct hll_init_t {
+  uint32_t* registers{nullptr};
+  size_t words_per_vertex{0};
+  size_t log2_num_registers{0};
+  vertex_t local_vertex_partition_range_first{0};
+
+  __device__ void operator()(vertex_t v_offset) const
+  {
+    // splitmix64 finalizer
+    auto h = static_cast<uint64_t>(local_vertex_partition_range_first + v_offset);
+    h      = (h ^ (h >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+    h      = (h ^ (h >> 27)) * uint64_t{0x94d049bb133111eb};
+    h      = h ^ (h >> 31);
+
+    // the low bits select the register, the register stores the position of the leading 1 bit in
+    // the remaining bits
+    auto register_idx = static_cast<size_t>(h & ((uint64_t{1} << log2_num_registers) - 1));
+    auto rank = static_cast<uint32_t>(
+      __clzll(static_cast<long long int>(h >> log2_num_registers)) - log2_num_registers + 1);
+    auto word = registers + static_cast<size_t>(v_offset) * words_per_vertex +
+                register_idx / hll_registers_per_word;
+    *word |= rank << ((register_idx % hll_registers_per_word) * 8);
+  }
+};
+
+template <typename vertex_t, typename NbrUnionIterator>
+struct hll_chunk_changed_t {
+  hll_chunk_reader_t<vertex_t> reader{};
+  NbrUnionIterator nbr_union_first{};
+
+  __device__ bool operator()(vertex_t v_offset) const
+  {
+    auto old_chunk        = reader(v_offset);
+    hll_chunk_t nbr_union = *(nbr_union_first + v_offset);
+    return hll_chunk_union_t{}(old_chunk, nbr_union) != old_chunk;
+  }
+};
+
+template <typename vertex_t, typename NbrUnionIterator>
+struct hll_chunk_update_t {
+  uint32_t* registers{nullptr};
+  size_t words_per_vertex{0};
+  size_t chunk_idx{0};
+  NbrUnionIterator nbr_union_first{};
+
+  __device__ void operator()(vertex_t v_offset) const
+  {
+    auto first = registers + static_cast<size_t>(v_offset) * words_per_vertex +
+                 chunk_idx * hll_words_per_chunk;
+    hll_chunk_t nbr_union = *(nbr_union_first + v_offset);
+    *first       = hll_bytewise_max(*first, thrust::get<0>(nbr_union));
+    *(first + 1) = hll_bytewise_max(*(first + 1), thrust::get<1>(nbr_union));
+    *(first + 2) = hll_bytewise_max(*(first + 2), thrust::get<2>(nbr_union));
+    *(first + 3) = hll_bytewise_max(*(first + 3), thrust::get<3>(nbr_union));
+  }
+};
+
+// the HyperLogLog cardinality estimate (with the small range correction) of Flajolet et al., 2007
+template <typename vertex_t>
+struct hll_estimate_t {
+  uint32_t const* registers{nullptr};
+  size_t words_per_vertex{0};
+  double alpha{0.0};
+
+  __device__ double operator()(vertex_t v_offset) const
+  {
+    auto first         = registers + static_cast<size_t>(v_offset) * words_per_vertex;
+    auto num_registers = static_cast<double>(words_per_vertex * hll_registers_per_word);
+    double sum{0.0};
+    size_t num_zeros{0};
+    for (size_t i = 0; i < words_per_vertex; ++i) {
+      auto word = *(first + i);
+      for (size_t j = 0; j < hll_registers_per_word; ++j) {
+        auto rank = static_cast<int>((word >> (j * 8)) & uint32_t{0xff});
+        sum += ldexp(1.0, -rank);
+        num_zeros += (rank == 0) ? size_t{1} : size_t{0};
+      }
+    }
+    auto estimate = alpha * num_registers * num_registers / sum;
+    if ((estimate <= 2.5 * num_registers) && (num_zeros > 0)) {
+      estimate = num_registers * log(num_registers / static_cast<double>(num_zeros));
+    }
+    return estimate;
+  }
+};
+
+template <typename vertex_t>
+struct hll_nbr_chunk_e_op_t {
+  __device__ hll_chunk_t operator()(
+    vertex_t, vertex_t, thrust::nullopt_t, hll_chunk_t dst_chunk, thrust::nullopt_t) const
+  {
+    return dst_chunk;
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<double>, std::vector<double>, double> approximate_k_hop_nbr_counts(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  size_t k,
+  size_t log2_num_registers,
+  double effective_diameter_quantile,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((log2_num_registers >= 4) && (log2_num_registers <= 16),
+                  "Invalid input argument: log2_num_registers should be in [4, 16].");
+  CUGRAPH_EXPECTS(
+    (effective_diameter_quantile > 0.0) && (effective_diameter_quantile <= 1.0),
+    "Invalid input argument: effective_diameter_quantile should be in (0.0, 1.0].");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto num_registers    = size_t{1} << log2_num_registers;
+  auto words_per_vertex = num_registers / hll_registers_per_word;
+  auto num_chunks       = num_registers / hll_registers_per_chunk;
+  auto alpha            = num_registers == 16   ? 0.673
+                          : num_registers == 32 ? 0.697
+                          : num_registers == 64 ? 0.709
+                                                : 0.7213 / (1.0 + 1.079 / num_registers);
+
+  auto const num_local_vertices = push_graph_view.local_vertex_partition_range_size();
+
+  // 2. initialize the sketches (every vertex is within 0 hops of itself)
+
+  rmm::device_uvector<uint32_t> registers(
+    static_cast<size_t>(num_local_vertices) * words_per_vertex, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), registers.begin(), registers.end(), uint32_t{0});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(num_local_vertices),
+    hll_init_t<vertex_t>{registers.data(),
+                         words_per_vertex,
+                         log2_num_registers,
+                         push_graph_view.local_vertex_partition_range_first()});
+
+  rmm::device_uvector<double> estimates(num_local_vertices, handle.get_stream());
+  auto update_estimates = [&]() {
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      estimates.begin(),
+                      hll_estimate_t<vertex_t>{registers.data(), words_per_vertex, alpha});
+    auto sum = thrust::reduce(
+      handle.get_thrust_policy(), estimates.begin(), estimates.end(), double{0.0});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      sum = host_scalar_allreduce(
+        handle.get_comms(), sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    return sum;
+  };
+
+  std::vector<double> neighborhood_function{};
+  neighborhood_function.reserve(k + 1);
+  neighborhood_function.push_back(update_estimates());
+
+  // 3. iterate (union the sketches of the outgoing neighbors)
+
+  auto dst_chunks = GraphViewType::is_multi_gpu
+                      ? edge_dst_property_t<GraphViewType, hll_chunk_t>(handle, push_graph_view)
+                      : edge_dst_property_t<GraphViewType, hll_chunk_t>(handle);
+  auto nbr_unions = allocate_dataframe_buffer<hll_chunk_t>(num_local_vertices, handle.get_stream());
+  for (size_t iter = 0; iter < k; ++iter) {
+    size_t num_changed_chunks{0};
+    for (size_t i = 0; i < num_chunks; ++i) {
+      auto chunk_reader = hll_chunk_reader_t<vertex_t>{registers.data(), words_per_vertex, i};
+      auto chunk_first =
+        thrust::make_transform_iterator(thrust::make_counting_iterator(vertex_t{0}), chunk_reader);
+      if constexpr (GraphViewType::is_multi_gpu) {
+        update_edge_dst_property(handle, push_graph_view, chunk_first, dst_chunks);
+        per_v_transform_reduce_outgoing_e(handle,
+                                          push_graph_view,
+                                          edge_src_dummy_property_t{}.view(),
+                                          dst_chunks.view(),
+                                          edge_dummy_property_t{}.view(),
+                                          hll_nbr_chunk_e_op_t<vertex_t>{},
+                                          hll_chunk_union_t::identity_element,
+                                          hll_chunk_union_t{},
+                                          get_dataframe_buffer_begin(nbr_unions));
+      } else {
+        per_v_transform_reduce_outgoing_e(
+          handle,
+          push_graph_view,
+          edge_src_dummy_property_t{}.view(),
+          detail::edge_minor_property_view_t<vertex_t, decltype(chunk_first)>(chunk_first,
+                                                                              vertex_t{0}),
+          edge_dummy_property_t{}.view(),
+          hll_nbr_chunk_e_op_t<vertex_t>{},
+          hll_chunk_union_t::identity_element,
+          hll_chunk_union_t{},
+          get_dataframe_buffer_begin(nbr_unions));
+      }
+
+      // the chunks of the iteration are independent, so a chunk is updated in place
+      auto nbr_union_first = get_dataframe_buffer_begin(nbr_unions);
+      num_changed_chunks += thrust::count_if(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(num_local_vertices),
+        hll_chunk_changed_t<vertex_t, decltype(nbr_union_first)>{chunk_reader, nbr_union_first});
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(vertex_t{0}),
+                       thrust::make_counting_iterator(num_local_vertices),
+                       hll_chunk_update_t<vertex_t, decltype(nbr_union_first)>{
+                         registers.data(), words_per_vertex, i, nbr_union_first});
+    }
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_changed_chunks = host_scalar_allreduce(
+        handle.get_comms(), num_changed_chunks, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_changed_chunks == 0) { break; }  // converged, the remaining iterations are no-ops
+    neighborhood_function.push_back(update_estimates());
+  }
+  neighborhood_function.resize(k + 1, neighborhood_function.back());
+
+  // 4. compute the effective diameter (linear interpolation between the hops)
+
+  auto threshold          = effective_diameter_quantile * neighborhood_function.back();
+  auto effective_diameter = 0.0;
+  for (size_t i = 0; i < neighborhood_function.size(); ++i) {
+    if (neighborhood_function[i] >= threshold) {
+      if (i > 0) {
+        effective_diameter =
+          static_cast<double>(i - 1) + (threshold - neighborhood_function[i - 1]) /
+                                         (neighborhood_function[i] - neighborhood_function[i - 1]);
+      }
+      break;
+    }
+  }
+
+  return std::make_tuple(
+    std::move(estimates), std::move(neighborhood_function), effective_diameter);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, std::vector<double>, double> approximate_k_hop_nbr_counts(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t k,
+  size_t log2_num_registers,
+  double effective_diameter_quantile,
+  bool do_expensive_check)
+{
+  return detail::approximate_k_hop_nbr_counts(
+    handle, graph_view, k, log2_num_registers, effective_diameter_quantile, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/approximate_k_hop_nbr_counts_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+template std::tuple<rmm::device_uvector<double>, std::vector<double>, double>
+approximate_k_hop_nbr_counts(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+                             size_t k,
+                             size_t log2_num_registers,
+                             double effective_diameter_quantile,
+                             bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, std::vector<double>, double>
+approximate_k_hop_nbr_counts(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int64_t, false, true> const& graph_view,
+                             size_t k,
+                             size_t log2_num_registers,
+                             double effective_diameter_quantile,
+                             bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, std::vector<double>, double>
+approximate_k_hop_nbr_counts(raft::handle_t const& handle,
+                             graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+                             size_t k,
+                             size_t log2_num_registers,
+                             double effective_diameter_quantile,
+                             bool do_expensive_check);
+
+}  // namespace cugraph
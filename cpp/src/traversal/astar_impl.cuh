@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/count_if_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_e.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_v_frontier.cuh>
+#include <prims/vertex_frontier.cuh>
+#include <traversal/detail/traversal_utils.cuh>
+#include <traversal/landmark_distance_oracle_impl.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/distance_oracle.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// the estimated length of the shortest source-destination path through v (std::numeric_limits<
+// weight_t>::max() if v is not reached or cannot reach the destination)
+template <typename vertex_t, typename weight_t, typename HeuristicOp>
+struct astar_priority_t {
+  weight_t const* distances{nullptr};
+  HeuristicOp heuristic{};
+
+  __device__ weight_t operator()(vertex_t v) const
+  {
+    auto distance = *(distances + v);
+    auto h        = heuristic(v);
+    return ((distance != std::numeric_limits<weight_t>::max()) &&
+            (h != std::numeric_limits<weight_t>::max()))
+             ? distance + h
+             : std::numeric_limits<weight_t>::max();
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename HeuristicOp>
+struct astar_e_op_t {
+  weight_t const* distances{nullptr};
+  HeuristicOp heuristic{};
+  vertex_t destination{};
+  weight_t cutoff{};
+
+  __device__ thrust::optional<thrust::tuple<weight_t, vertex_t>> operator()(
+    vertex_t src, vertex_t dst, thrust::nullopt_t, thrust::nullopt_t, weight_t w) const
+  {
+    auto new_distance = *(distances + src) + w;
+    if (new_distance >= *(distances + dst)) { return thrust::nullopt; }
+
+    // prune dst if no path through dst can be shorter than the best path found so far
+    auto h     = heuristic(dst);
+    auto bound = thrust::min(*(distances + destination), cutoff);
+    return ((h != std::numeric_limits<weight_t>::max()) && (new_distance + h < bound))
+             ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{thrust::make_tuple(
+                 new_distance, src)}
+             : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename HeuristicOp>
+struct astar_v_op_t {
+  HeuristicOp heuristic{};
+  weight_t near_far_threshold{};
+  size_t bucket_idx_next_near{};
+  size_t bucket_idx_far{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>,
+                           thrust::optional<thrust::tuple<weight_t, vertex_t>>>
+  operator()(vertex_t v, weight_t v_val, thrust::tuple<weight_t, vertex_t> pushed_val) const
+  {
+    auto new_dist = thrust::get<0>(pushed_val);
+    auto update   = (new_dist < v_val);
+    return thrust::make_tuple(
+      update ? thrust::optional<size_t>{new_dist + heuristic(v) < near_far_threshold
+                                          ? bucket_idx_next_near
+                                          : bucket_idx_far}
+             : thrust::nullopt,
+      update ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{pushed_val} : thrust::nullopt);
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+// h(v) = heuristic_values[v]
+template <typename vertex_t, typename weight_t>
+struct precomputed_astar_heuristic_t {
+  weight_t const* heuristic_values{nullptr};
+
+  __device__ weight_t operator()(vertex_t v) const { return *(heuristic_values + v); }
+};
+
+// h(v) = the landmark (triangle inequality) lower bound of d(v, destination), the ALT heuristic
+template <typename vertex_t, typename weight_t>
+struct landmark_astar_heuristic_t {
+  landmark_distance_bounds_t<vertex_t, weight_t> bounds{};
+  vertex_t destination{};
+
+  __device__ weight_t operator()(vertex_t v) const
+  {
+    return thrust::get<0>(bounds(thrust::make_tuple(v, destination)));
+  }
+};
+
+// goal-directed Near-Far search: the piles are ordered by distance + heuristic instead of
+// distance. HeuristicOp is a device functor (weight_t operator()(vertex_t v)) returning a lower
+// bound of the distance from v to the destination (std::numeric_limits<weight_t>::max() if v
+// cannot reach the destination). The heuristic needs to be admissible but not consistent (a vertex
+// is re-expanded if its distance improves after expansion).
+template <typename vertex_t, typename edge_t, typename weight_t, typename HeuristicOp>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  HeuristicOp heuristic,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_floating_point<weight_t>::value,
+                "weight_t should be a floating point type.");
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const num_edges    = graph_view.number_of_edges();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    is_valid_vertex(num_vertices, source) && is_valid_vertex(num_vertices, destination),
+    "Invalid input argument: source or destination vertex out-of-range.");
+
+  if (do_expensive_check) {
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input edge weights should have non-negative values.");
+  }
+
+  if (source == destination) {
+    rmm::device_uvector<vertex_t> path(1, handle.get_stream());
+    raft::update_device(path.data(), &source, size_t{1}, handle.get_stream());
+    return std::make_tuple(weight_t{0.0}, std::move(path));
+  }
+
+  if (num_edges == 0) {
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  // 2. initialize distances and predecessors
+
+  rmm::device_uvector<weight_t> distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), distances.begin(), distances.end(), invalid_distance);
+  thrust::fill(
+    handle.get_thrust_policy(), predecessors.begin(), predecessors.end(), invalid_vertex);
+  weight_t zero_distance{0.0};
+  raft::update_device(distances.data() + source, &zero_distance, size_t{1}, handle.get_stream());
+
+  auto priority_op = astar_priority_t<vertex_t, weight_t, HeuristicOp>{distances.data(), heuristic};
+  auto min_priority = [&handle, priority_op](auto first, auto last) {
+    return thrust::transform_reduce(handle.get_thrust_policy(),
+                                    first,
+                                    last,
+                                    priority_op,
+                                    invalid_distance,
+                                    thrust::minimum<weight_t>{});
+  };
+
+  auto source_priority = min_priority(thrust::make_counting_iterator(source),
+                                      thrust::make_counting_iterator(source + 1));
+  if (source_priority >= cutoff) {  // the destination is unreachable or farther than cutoff
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  // 3. compute the near-far threshold increment (identical to the Near-Far method in sssp)
+
+  weight_t average_vertex_degree{0.0};
+  weight_t average_edge_weight{0.0};
+  thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
+    handle,
+    graph_view,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_dummy_property_t{}.view(),
+    edge_weight_view,
+    [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) {
+      return thrust::make_tuple(weight_t{1.0}, w);
+    },
+    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
+  average_vertex_degree /= static_cast<weight_t>(num_vertices);
+  average_edge_weight /= static_cast<weight_t>(num_edges);
+  auto delta =
+    (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+  if (delta <= weight_t{0.0}) { delta = weight_t{1.0}; }  // every edge weight is 0
+
+  // 4. initialize the frontier
+
+  constexpr size_t bucket_idx_cur_near  = 0;
+  constexpr size_t bucket_idx_next_near = 1;
+  constexpr size_t bucket_idx_far       = 2;
+  constexpr size_t num_buckets          = 3;
+
+  vertex_frontier_t<vertex_t, void, false, true> vertex_frontier(handle, num_buckets);
+  vertex_frontier.bucket(bucket_idx_cur_near).insert(source);
+
+  // 5. relax the near pile (distance + heuristic < near_far_threshold) until no pending vertex can
+  // improve the best path found so far
+
+  auto near_far_threshold = source_priority + delta;
+  while (true) {
+    auto [new_frontier_vertex_buffer, distance_predecessor_buffer] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        graph_view,
+        vertex_frontier.bucket(bucket_idx_cur_near),
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_dummy_property_t{}.view(),
+        edge_weight_view,
+        astar_e_op_t<vertex_t, weight_t, HeuristicOp>{
+          distances.data(), heuristic, destination, cutoff},
+        reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+
+    update_v_frontier(
+      handle,
+      graph_view,
+      std::move(new_frontier_vertex_buffer),
+      std::move(distance_predecessor_buffer),
+      vertex_frontier,
+      std::vector<size_t>{bucket_idx_next_near, bucket_idx_far},
+      distances.data(),
+      thrust::make_zip_iterator(thrust::make_tuple(distances.data(), predecessors.data())),
+      astar_v_op_t<vertex_t, weight_t, HeuristicOp>{
+        heuristic, near_far_threshold, bucket_idx_next_near, bucket_idx_far});
+
+    vertex_frontier.bucket(bucket_idx_cur_near).clear();
+    vertex_frontier.bucket(bucket_idx_cur_near).shrink_to_fit();
+    if (vertex_frontier.bucket(bucket_idx_next_near).aggregate_size() > 0) {
+      vertex_frontier.swap_buckets(bucket_idx_cur_near, bucket_idx_next_near);
+      continue;
+    }
+    if (vertex_frontier.bucket(bucket_idx_far).aggregate_size() == 0) { break; }
+
+    // near pile is empty, move the threshold past the smallest pending priority (instead of
+    // stepping by delta, the heuristic can leave large gaps) and split the far pile, the vertices
+    // that cannot improve the best path found so far are dropped
+
+    weight_t destination_distance{};
+    raft::update_host(
+      &destination_distance, distances.data() + destination, size_t{1}, handle.get_stream());
+    handle.sync_stream();
+    auto bound = std::min(destination_distance, cutoff);
+
+    auto far_min_priority = min_priority(vertex_frontier.bucket(bucket_idx_far).begin(),
+                                         vertex_frontier.bucket(bucket_idx_far).end());
+    if (far_min_priority >= bound) { break; }
+
+    auto old_near_far_threshold = near_far_threshold;
+    near_far_threshold          = std::max(near_far_threshold, far_min_priority) + delta;
+    vertex_frontier.split_bucket(
+      bucket_idx_far,
+      std::vector<size_t>{bucket_idx_cur_near},
+      [priority_op, old_near_far_threshold, near_far_threshold, bound] __device__(auto v) {
+        auto priority = priority_op(v);
+        return ((priority >= old_near_far_threshold) && (priority < bound))
+                 ? thrust::optional<size_t>{priority < near_far_threshold ? bucket_idx_cur_near
+                                                                          : bucket_idx_far}
+                 : thrust::nullopt;
+      });
+    if (vertex_frontier.bucket(bucket_idx_cur_near).aggregate_size() == 0) { break; }
+  }
+
+  weight_t distance{};
+  raft::update_host(&distance, distances.data() + destination, size_t{1}, handle.get_stream());
+  handle.sync_stream();
+  if (distance >= cutoff) {
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  // 6. extract the path
+
+  rmm::device_uvector<vertex_t> hops(num_vertices, handle.get_stream());
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(size_t{1}),
+    predecessor_chain_length_t<vertex_t>{predecessors.data(), hops.data(), destination});
+
+  rmm::device_uvector<vertex_t> d_destination(1, handle.get_stream());
+  raft::update_device(d_destination.data(), &destination, size_t{1}, handle.get_stream());
+  auto [path, path_size] = extract_bfs_paths(
+    handle, graph_view, hops.data(), predecessors.data(), d_destination.data(), size_t{1});
+  path.resize(path_size, handle.get_stream());
+
+  return std::make_tuple(distance, std::move(path));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<weight_t const> heuristic_values,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(heuristic_values.size() == static_cast<size_t>(graph_view.number_of_vertices()),
+                  "Invalid input argument: heuristic_values.size() should coincide with the "
+                  "number of vertices.");
+
+  if (do_expensive_check) {
+    auto num_negative_values = thrust::count_if(handle.get_thrust_policy(),
+                                                heuristic_values.begin(),
+                                                heuristic_values.end(),
+                                                [] __device__(weight_t h) { return h < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: heuristic_values should be non-negative.");
+  }
+
+  return detail::astar(handle,
+                       graph_view,
+                       edge_weight_view,
+                       detail::precomputed_astar_heuristic_t<vertex_t, weight_t>{
+                         heuristic_values.data()},
+                       source,
+                       destination,
+                       cutoff,
+                       do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  landmark_distance_index_t<vertex_t, weight_t> const& index,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(index.number_of_vertices == graph_view.number_of_vertices(),
+                  "Invalid input argument: the landmark distance index is built for a graph with "
+                  "a different number of vertices.");
+
+  // the distances to the landmarks are the distances from the landmarks if the graph is symmetric
+  auto distances_from   = index.distances_from_landmarks.data();
+  auto distances_to     = index.distances_to_landmarks ? (*index.distances_to_landmarks).data()
+                                                       : distances_from;
+  auto has_distances_to = index.is_symmetric || index.distances_to_landmarks.has_value();
+
+  return detail::astar(
+    handle,
+    graph_view,
+    edge_weight_view,
+    detail::landmark_astar_heuristic_t<vertex_t, weight_t>{
+      detail::landmark_distance_bounds_t<vertex_t, weight_t>{
+        distances_from, distances_to, has_distances_to, index.landmarks.size()},
+      destination},
+    source,
+    destination,
+    cutoff,
+    do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/astar_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<float, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  raft::device_span<float const> heuristic_values,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  landmark_distance_index_t<int32_t, float> const& index,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  raft::device_span<double const> heuristic_values,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  landmark_distance_index_t<int32_t, double> const& index,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  raft::device_span<float const> heuristic_values,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  landmark_distance_index_t<int32_t, float> const& index,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  raft::device_span<double const> heuristic_values,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  landmark_distance_index_t<int32_t, double> const& index,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int64_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  raft::device_span<float const> heuristic_values,
+  int64_t source,
+  int64_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int64_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  landmark_distance_index_t<int64_t, float> const& index,
+  int64_t source,
+  int64_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int64_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  raft::device_span<double const> heuristic_values,
+  int64_t source,
+  int64_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int64_t>> astar(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  landmark_distance_index_t<int64_t, double> const& index,
+  int64_t source,
+  int64_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+}  // namespace cugraph
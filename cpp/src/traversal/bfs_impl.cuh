@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,10 +23,15 @@
 #include <prims/vertex_frontier.cuh>
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_endpoint_property_device_view.cuh>
 #include <cugraph/edge_property.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
@@ -40,8 +45,10 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <limits>
@@ -85,6 +92,116 @@ struct e_op_t {
   }
 };
 
+// pull (bottom-up) step: an unvisited major vertex scans its neighbors and stops at the first
+// neighbor in the current frontier (this early exit is where the bottom-up step saves edge
+// inspections), returns the neighbor (the predecessor) or invalid_vertex_id<vertex_t>::value
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct bottom_up_op_t {
+  edge_partition_device_view_t<vertex_t, edge_t, multi_gpu> edge_partition{};
+  std::conditional_t<
+    multi_gpu,
+    detail::edge_partition_endpoint_property_device_view_t<vertex_t, uint8_t const*>,
+    uint32_t const*>
+    major_visited_flags{};
+  std::conditional_t<
+    multi_gpu,
+    detail::edge_partition_endpoint_property_device_view_t<vertex_t, uint8_t const*>,
+    uint32_t const*>
+    minor_frontier_flags{};
+
+  __device__ vertex_t operator()(vertex_t major_offset) const
+  {
+    auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+    if constexpr (multi_gpu) {
+      if (major_visited_flags.get(major_offset) != uint8_t{0}) { return invalid_vertex; }
+    } else {
+      auto mask = uint32_t{1} << (major_offset % (sizeof(uint32_t) * 8));
+      if (*(major_visited_flags + (major_offset / (sizeof(uint32_t) * 8))) & mask) {
+        return invalid_vertex;
+      }
+    }
+
+    vertex_t const* indices{nullptr};
+    [[maybe_unused]] edge_t edge_offset{0};
+    edge_t local_degree{0};
+    if constexpr (multi_gpu) {
+      auto major                   = edge_partition.major_from_major_offset_nocheck(major_offset);
+      auto major_hypersparse_first = edge_partition.major_hypersparse_first();
+      if (major_hypersparse_first && (major >= *major_hypersparse_first)) {
+        auto major_hypersparse_idx = edge_partition.major_hypersparse_idx_from_major_nocheck(major);
+        if (major_hypersparse_idx) {
+          thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(
+            edge_partition.major_offset_from_major_nocheck(*major_hypersparse_first) +
+            *major_hypersparse_idx);
+        }
+      } else {
+        thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(major_offset);
+      }
+    } else {
+      thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(major_offset);
+    }
+
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor = indices[i];
+      bool in_frontier{false};
+      if constexpr (multi_gpu) {
+        in_frontier =
+          minor_frontier_flags.get(edge_partition.minor_offset_from_minor_nocheck(minor)) !=
+          uint8_t{0};
+      } else {
+        auto mask   = uint32_t{1} << (minor % (sizeof(uint32_t) * 8));
+        in_frontier = (*(minor_frontier_flags + (minor / (sizeof(uint32_t) * 8))) & mask) != 0;
+      }
+      if (in_frontier) { return minor; }
+    }
+
+    return invalid_vertex;
+  }
+};
+
+template <typename vertex_t, bool multi_gpu>
+struct mark_visited_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+  uint32_t* visited_flags{nullptr};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto v_offset = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+    auto mask     = uint32_t{1} << (v_offset % (sizeof(uint32_t) * 8));
+    atomicOr(visited_flags + (v_offset / (sizeof(uint32_t) * 8)), mask);
+  }
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct out_degree_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+  edge_t const* out_degrees{nullptr};
+
+  __device__ edge_t operator()(vertex_t v) const
+  {
+    return *(out_degrees + vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v));
+  }
+};
+
+template <typename vertex_t>
+struct is_visited_t {
+  __device__ uint8_t operator()(vertex_t distance) const
+  {
+    return distance != std::numeric_limits<vertex_t>::max() ? uint8_t{1} : uint8_t{0};
+  }
+};
+
+template <typename vertex_t>
+struct is_in_frontier_t {
+  vertex_t depth{};
+
+  __device__ uint8_t operator()(vertex_t distance) const
+  {
+    return distance == depth ? uint8_t{1} : uint8_t{0};
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -98,9 +215,12 @@ void bfs(raft::handle_t const& handle,
          size_t n_sources,
          bool direction_optimizing,
          typename GraphViewType::vertex_type depth_limit,
-         bool do_expensive_check)
+         bool do_expensive_check,
+         double direction_optimizing_alpha,
+         double direction_optimizing_beta)
 {
   using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
 
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
@@ -126,6 +246,11 @@ void bfs(raft::handle_t const& handle,
   CUGRAPH_EXPECTS(
     push_graph_view.is_symmetric() || !direction_optimizing,
     "Invalid input argument: input graph should be symmetric for direction optimizing BFS.");
+  CUGRAPH_EXPECTS(
+    !direction_optimizing ||
+      ((direction_optimizing_alpha > 0.0) && (direction_optimizing_beta > 0.0)),
+    "Invalid input argument: direction_optimizing_alpha and direction_optimizing_beta should be "
+    "positive.");
 
   if (do_expensive_check) {
     auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
@@ -187,6 +312,11 @@ void bfs(raft::handle_t const& handle,
       (sizeof(uint32_t) * 8),
     handle.get_stream());
   thrust::fill(handle.get_thrust_policy(), visited_flags.begin(), visited_flags.end(), uint32_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   sources,
+                   sources + n_sources,
+                   mark_visited_t<vertex_t, GraphViewType::is_multi_gpu>{vertex_partition,
+                                                                        visited_flags.data()});
   rmm::device_uvector<uint32_t> prev_visited_flags(
     GraphViewType::is_multi_gpu ? size_t{0} : visited_flags.size(),
     handle.get_stream());  // relevant only if GraphViewType::is_multi_gpu is false
@@ -199,11 +329,191 @@ void bfs(raft::handle_t const& handle,
     fill_edge_dst_property(handle, push_graph_view, uint8_t{0}, dst_visited_flags);
   }
 
-  // 4. BFS iteration
+  // 4. initialize direction optimization (Beamer et al., "Direction-Optimizing Breadth-First
+  // Search", SC 2012)
+
+  // the pull step reads the visited flags of the edge partition major vertices and the frontier
+  // flags of the edge partition minor vertices (bitmaps in SG, edge src/dst properties in MG)
+  rmm::device_uvector<uint32_t> frontier_flags(
+    (direction_optimizing && !GraphViewType::is_multi_gpu) ? visited_flags.size() : size_t{0},
+    handle.get_stream());  // relevant only if GraphViewType::is_multi_gpu is false
+  auto src_visited_flags =
+    (direction_optimizing && GraphViewType::is_multi_gpu)
+      ? edge_src_property_t<GraphViewType, uint8_t>(handle, push_graph_view)
+      : edge_src_property_t<GraphViewType, uint8_t>(
+          handle);  // relevant only if GraphViewType::is_multi_gpu is true
+  auto dst_frontier_flags =
+    (direction_optimizing && GraphViewType::is_multi_gpu)
+      ? edge_dst_property_t<GraphViewType, uint8_t>(handle, push_graph_view)
+      : edge_dst_property_t<GraphViewType, uint8_t>(
+          handle);  // relevant only if GraphViewType::is_multi_gpu is true
+
+  rmm::device_uvector<edge_t> out_degrees(size_t{0}, handle.get_stream());
+  if (direction_optimizing) { out_degrees = push_graph_view.compute_out_degrees(handle); }
+
+  // m_u: # edges of the unvisited vertices, n_f & m_f: # vertices & edges of the current frontier
+  edge_t unvisited_edge_count = push_graph_view.number_of_edges();
+  vertex_t prev_frontier_size{0};
+  bool pull{false};
+
+  // 5. BFS iteration
   vertex_t depth{0};
   while (true) {
     if (direction_optimizing) {
-      CUGRAPH_FAIL("unimplemented.");
+      auto frontier_size =
+        static_cast<vertex_t>(vertex_frontier.bucket(bucket_idx_cur).aggregate_size());
+      auto frontier_edges = thrust::transform_reduce(
+        handle.get_thrust_policy(),
+        vertex_frontier.bucket(bucket_idx_cur).begin(),
+        vertex_frontier.bucket(bucket_idx_cur).end(),
+        out_degree_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>{vertex_partition,
+                                                                    out_degrees.data()},
+        edge_t{0},
+        thrust::plus<edge_t>{});
+      if constexpr (GraphViewType::is_multi_gpu) {
+        frontier_edges = host_scalar_allreduce(
+          handle.get_comms(), frontier_edges, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (!pull) {  // switch to pull if m_f > m_u / alpha
+        pull = static_cast<double>(frontier_edges) >
+               static_cast<double>(unvisited_edge_count) / direction_optimizing_alpha;
+      } else {  // switch back to push if the frontier is shrinking and n_f < n / beta
+        pull = !((frontier_size < prev_frontier_size) &&
+                 (static_cast<double>(frontier_size) <
+                  static_cast<double>(num_vertices) / direction_optimizing_beta));
+        if (!pull) {  // the push step assumes that the visited vertices are flagged
+          if constexpr (GraphViewType::is_multi_gpu) {
+            update_edge_dst_property(
+              handle,
+              push_graph_view,
+              thrust::make_transform_iterator(distances, is_visited_t<vertex_t>{}),
+              dst_visited_flags);
+          }
+        }
+      }
+      unvisited_edge_count -= frontier_edges;
+      prev_frontier_size = frontier_size;
+    }
+
+    if (pull) {
+      if constexpr (GraphViewType::is_multi_gpu) {
+        update_edge_src_property(
+          handle,
+          push_graph_view,
+          thrust::make_transform_iterator(distances, is_visited_t<vertex_t>{}),
+          src_visited_flags);
+        update_edge_dst_property(
+          handle,
+          push_graph_view,
+          thrust::make_transform_iterator(distances, is_in_frontier_t<vertex_t>{depth}),
+          dst_frontier_flags);
+      } else {
+        thrust::fill(
+          handle.get_thrust_policy(), frontier_flags.begin(), frontier_flags.end(), uint32_t{0});
+        thrust::for_each(handle.get_thrust_policy(),
+                         vertex_frontier.bucket(bucket_idx_cur).begin(),
+                         vertex_frontier.bucket(bucket_idx_cur).end(),
+                         [frontier_flags = frontier_flags.data()] __device__(auto v) {
+                           auto mask = uint32_t{1} << (v % (sizeof(uint32_t) * 8));
+                           atomicOr(frontier_flags + (v / (sizeof(uint32_t) * 8)), mask);
+                         });
+      }
+
+      // every unvisited vertex looks for a predecessor in the current frontier, in MG, the
+      // candidates found in the edge partition i are reduced to the GPU owning the major vertices
+      // (minor_comm rank i)
+
+      rmm::device_uvector<vertex_t> parents(push_graph_view.local_vertex_partition_range_size(),
+                                            handle.get_stream());
+      for (size_t i = 0; i < push_graph_view.number_of_local_edge_partitions(); ++i) {
+        auto edge_partition =
+          edge_partition_device_view_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+            push_graph_view.local_edge_partition_view(i));
+
+        bottom_up_op_t<vertex_t, edge_t, GraphViewType::is_multi_gpu> bottom_up_op{};
+        bottom_up_op.edge_partition = edge_partition;
+        if constexpr (GraphViewType::is_multi_gpu) {
+          bottom_up_op.major_visited_flags =
+            detail::edge_partition_endpoint_property_device_view_t<vertex_t, uint8_t const*>(
+              src_visited_flags.view(), i);
+          bottom_up_op.minor_frontier_flags =
+            detail::edge_partition_endpoint_property_device_view_t<vertex_t, uint8_t const*>(
+              dst_frontier_flags.view());
+
+          auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+          rmm::device_uvector<vertex_t> edge_partition_parents(edge_partition.major_range_size(),
+                                                               handle.get_stream());
+          thrust::transform(handle.get_thrust_policy(),
+                            thrust::make_counting_iterator(vertex_t{0}),
+                            thrust::make_counting_iterator(edge_partition.major_range_size()),
+                            edge_partition_parents.begin(),
+                            bottom_up_op);
+          static_assert(invalid_vertex < vertex_t{0});  // any valid candidate wins in MAX
+          device_reduce(minor_comm,
+                        edge_partition_parents.begin(),
+                        parents.begin(),
+                        edge_partition_parents.size(),
+                        raft::comms::op_t::MAX,
+                        static_cast<int>(i),
+                        handle.get_stream());
+        } else {
+          bottom_up_op.major_visited_flags  = visited_flags.data();
+          bottom_up_op.minor_frontier_flags = frontier_flags.data();
+          thrust::transform(handle.get_thrust_policy(),
+                            thrust::make_counting_iterator(vertex_t{0}),
+                            thrust::make_counting_iterator(edge_partition.major_range_size()),
+                            parents.begin(),
+                            bottom_up_op);
+        }
+      }
+
+      auto num_new_frontier_vertices = static_cast<size_t>(
+        thrust::count_if(handle.get_thrust_policy(),
+                         parents.begin(),
+                         parents.end(),
+                         [] __device__(auto parent) { return parent != invalid_vertex; }));
+      rmm::device_uvector<vertex_t> new_frontier_vertex_buffer(num_new_frontier_vertices,
+                                                               handle.get_stream());
+      rmm::device_uvector<vertex_t> predecessor_buffer(num_new_frontier_vertices,
+                                                       handle.get_stream());
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(
+          thrust::make_counting_iterator(push_graph_view.local_vertex_partition_range_first()),
+          parents.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(
+          thrust::make_counting_iterator(push_graph_view.local_vertex_partition_range_last()),
+          parents.end())),
+        parents.begin(),
+        thrust::make_zip_iterator(
+          thrust::make_tuple(new_frontier_vertex_buffer.begin(), predecessor_buffer.begin())),
+        [] __device__(auto parent) { return parent != invalid_vertex; });
+      parents.resize(0, handle.get_stream());
+      parents.shrink_to_fit(handle.get_stream());
+
+      thrust::for_each(handle.get_thrust_policy(),
+                       new_frontier_vertex_buffer.begin(),
+                       new_frontier_vertex_buffer.end(),
+                       mark_visited_t<vertex_t, GraphViewType::is_multi_gpu>{vertex_partition,
+                                                                            visited_flags.data()});
+
+      update_v_frontier(
+        handle,
+        push_graph_view,
+        std::move(new_frontier_vertex_buffer),
+        std::move(predecessor_buffer),
+        vertex_frontier,
+        std::vector<size_t>{bucket_idx_next},
+        distances,
+        thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
+        [depth] __device__(auto v, auto v_val, auto pushed_val) {
+          auto update = (v_val == invalid_distance);
+          return thrust::make_tuple(
+            update ? thrust::optional<size_t>{bucket_idx_next} : thrust::nullopt,
+            update ? thrust::optional<thrust::tuple<vertex_t, vertex_t>>{thrust::make_tuple(
+                       depth + 1, pushed_val)}
+                   : thrust::nullopt);
+        });
     } else {
       if (GraphViewType::is_multi_gpu) {
         update_edge_dst_property(handle,
@@ -274,13 +584,13 @@ void bfs(raft::handle_t const& handle,
                        depth + 1, pushed_val)}
                    : thrust::nullopt);
         });
-
-      vertex_frontier.bucket(bucket_idx_cur).clear();
-      vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
-      vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
-      if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
     }
 
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+
     depth++;
     if (depth >= depth_limit) { break; }
   }
@@ -297,7 +607,9 @@ void bfs(raft::handle_t const& handle,
          size_t n_sources,
          bool direction_optimizing,
          vertex_t depth_limit,
-         bool do_expensive_check)
+         bool do_expensive_check,
+         double direction_optimizing_alpha,
+         double direction_optimizing_beta)
 {
   if (predecessors != nullptr) {
     detail::bfs(handle,
@@ -308,7 +620,9 @@ void bfs(raft::handle_t const& handle,
                 n_sources,
                 direction_optimizing,
                 depth_limit,
-                do_expensive_check);
+                do_expensive_check,
+                direction_optimizing_alpha,
+                direction_optimizing_beta);
   } else {
     detail::bfs(handle,
                 graph_view,
@@ -318,7 +632,9 @@ void bfs(raft::handle_t const& handle,
                 n_sources,
                 direction_optimizing,
                 depth_limit,
-                do_expensive_check);
+                do_expensive_check,
+                direction_optimizing_alpha,
+                direction_optimizing_beta);
   }
 }
 
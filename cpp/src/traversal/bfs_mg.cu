@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,7 +28,9 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  double direction_optimizing_alpha,
+                  double direction_optimizing_beta);
 
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int32_t, int64_t, false, true> const& graph_view,
@@ -38,7 +40,9 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int32_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  double direction_optimizing_alpha,
+                  double direction_optimizing_beta);
 
 template void bfs(raft::handle_t const& handle,
                   graph_view_t<int64_t, int64_t, false, true> const& graph_view,
@@ -48,6 +52,8 @@ template void bfs(raft::handle_t const& handle,
                   size_t n_sources,
                   bool direction_optimizing,
                   int64_t depth_limit,
-                  bool do_expensive_check);
+                  bool do_expensive_check,
+                  double direction_optimizing_alpha,
+                  double direction_optimizing_beta);
 
 }  // namespace cugraph
@@ -0,0 +1,661 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/count_if_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_e.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_v_frontier.cuh>
+#include <prims/vertex_frontier.cuh>
+#include <traversal/detail/traversal_utils.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reverse.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct bidirectional_bfs_e_op_t {
+  vertex_t const* distances{nullptr};
+
+  __device__ thrust::optional<vertex_t> operator()(
+    vertex_t src, vertex_t dst, thrust::nullopt_t, thrust::nullopt_t, thrust::nullopt_t) const
+  {
+    return *(distances + dst) == std::numeric_limits<vertex_t>::max()
+             ? thrust::optional<vertex_t>{src}
+             : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t>
+struct bidirectional_bfs_v_op_t {
+  vertex_t depth{};
+  size_t bucket_idx_next{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>,
+                           thrust::optional<thrust::tuple<vertex_t, vertex_t>>>
+  operator()(vertex_t v, vertex_t v_val, vertex_t pushed_val) const
+  {
+    auto update = (v_val == std::numeric_limits<vertex_t>::max());
+    return thrust::make_tuple(
+      update ? thrust::optional<size_t>{bucket_idx_next} : thrust::nullopt,
+      update ? thrust::optional<thrust::tuple<vertex_t, vertex_t>>{thrust::make_tuple(
+                 depth + 1, pushed_val)}
+             : thrust::nullopt);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct bidirectional_sssp_e_op_t {
+  weight_t const* distances{nullptr};
+  weight_t cutoff{};
+
+  __device__ thrust::optional<thrust::tuple<weight_t, vertex_t>> operator()(
+    vertex_t src, vertex_t dst, thrust::nullopt_t, thrust::nullopt_t, weight_t w) const
+  {
+    auto new_distance = *(distances + src) + w;
+    auto threshold    = thrust::min(*(distances + dst), cutoff);
+    return new_distance < threshold ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{
+                                        thrust::make_tuple(new_distance, src)}
+                                    : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct bidirectional_sssp_v_op_t {
+  weight_t near_far_threshold{};
+  size_t bucket_idx_next_near{};
+  size_t bucket_idx_far{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>,
+                           thrust::optional<thrust::tuple<weight_t, vertex_t>>>
+  operator()(vertex_t v, weight_t v_val, thrust::tuple<weight_t, vertex_t> pushed_val) const
+  {
+    auto new_dist = thrust::get<0>(pushed_val);
+    auto update   = (new_dist < v_val);
+    return thrust::make_tuple(
+      update ? thrust::optional<size_t>{new_dist < near_far_threshold ? bucket_idx_next_near
+                                                                      : bucket_idx_far}
+             : thrust::nullopt,
+      update ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{pushed_val} : thrust::nullopt);
+  }
+};
+
+// (distance on this side, distance on this side + distance on the other side, vertex)
+template <typename vertex_t, typename distance_t>
+struct meeting_candidate_t {
+  distance_t const* distances{nullptr};
+  distance_t const* other_distances{nullptr};
+
+  __device__ thrust::tuple<distance_t, distance_t, vertex_t> operator()(vertex_t v) const
+  {
+    auto distance       = *(distances + v);
+    auto other_distance = *(other_distances + v);
+    return other_distance != std::numeric_limits<distance_t>::max()
+             ? thrust::make_tuple(distance, distance + other_distance, v)
+             : thrust::make_tuple(distance,
+                                  std::numeric_limits<distance_t>::max(),
+                                  invalid_vertex_id<vertex_t>::value);
+  }
+};
+
+// minimum distance on this side & minimum (path length, vertex) pair
+template <typename vertex_t, typename distance_t>
+struct min_meeting_candidate_t {
+  __host__ __device__ thrust::tuple<distance_t, distance_t, vertex_t> operator()(
+    thrust::tuple<distance_t, distance_t, vertex_t> lhs,
+    thrust::tuple<distance_t, distance_t, vertex_t> rhs) const
+  {
+    auto lhs_wins = (thrust::get<1>(lhs) < thrust::get<1>(rhs)) ||
+                    ((thrust::get<1>(lhs) == thrust::get<1>(rhs)) &&
+                     (thrust::get<2>(lhs) < thrust::get<2>(rhs)));
+    return thrust::make_tuple(thrust::min(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              lhs_wins ? thrust::get<1>(lhs) : thrust::get<1>(rhs),
+                              lhs_wins ? thrust::get<2>(lhs) : thrust::get<2>(rhs));
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename vertex_t, typename distance_t>
+thrust::tuple<distance_t, distance_t, vertex_t> reduce_meeting_candidates(
+  raft::handle_t const& handle,
+  vertex_frontier_t<vertex_t, void, false, true> const& vertex_frontier,
+  std::vector<size_t> const& bucket_indices,
+  meeting_candidate_t<vertex_t, distance_t> op)
+{
+  auto ret = thrust::make_tuple(std::numeric_limits<distance_t>::max(),
+                                std::numeric_limits<distance_t>::max(),
+                                invalid_vertex_id<vertex_t>::value);
+  for (auto idx : bucket_indices) {
+    ret = min_meeting_candidate_t<vertex_t, distance_t>{}(
+      ret,
+      thrust::transform_reduce(handle.get_thrust_policy(),
+                               vertex_frontier.bucket(idx).begin(),
+                               vertex_frontier.bucket(idx).end(),
+                               op,
+                               ret,
+                               min_meeting_candidate_t<vertex_t, distance_t>{}));
+  }
+  return ret;
+}
+
+// concatenate the source-to-meet path of the forward search and the reversed destination-to-meet
+// path of the backward search
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<vertex_t> join_bidirectional_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  graph_view_t<vertex_t, edge_t, false, false> const& backward_graph_view,
+  vertex_t const* forward_hops,
+  vertex_t const* forward_predecessors,
+  vertex_t const* backward_hops,
+  vertex_t const* backward_predecessors,
+  vertex_t meet)
+{
+  rmm::device_uvector<vertex_t> d_meet(1, handle.get_stream());
+  raft::update_device(d_meet.data(), &meet, size_t{1}, handle.get_stream());
+
+  auto [forward_path, forward_path_size] = extract_bfs_paths(
+    handle, graph_view, forward_hops, forward_predecessors, d_meet.data(), size_t{1});
+  auto [backward_path, backward_path_size] = extract_bfs_paths(
+    handle, backward_graph_view, backward_hops, backward_predecessors, d_meet.data(), size_t{1});
+
+  // backward_path is (destination, ..., meet), drop meet and reverse the rest
+  forward_path.resize(forward_path_size + (backward_path_size - 1), handle.get_stream());
+  thrust::reverse_copy(handle.get_thrust_policy(),
+                       backward_path.begin(),
+                       backward_path.begin() + (backward_path_size - 1),
+                       forward_path.begin() + forward_path_size);
+
+  return std::move(forward_path);
+}
+
+template <typename vertex_t, typename edge_t>
+std::tuple<vertex_t, rmm::device_uvector<vertex_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  vertex_t source,
+  vertex_t destination,
+  vertex_t depth_limit,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    is_valid_vertex(num_vertices, source) && is_valid_vertex(num_vertices, destination),
+    "Invalid input argument: source or destination vertex out-of-range.");
+  CUGRAPH_EXPECTS(graph_view.is_symmetric() || reversed_graph_view.has_value(),
+                  "Invalid input argument: reversed_graph_view is required for a directed graph.");
+  CUGRAPH_EXPECTS(
+    !reversed_graph_view ||
+      (((*reversed_graph_view).number_of_vertices() == num_vertices) &&
+       ((*reversed_graph_view).number_of_edges() == graph_view.number_of_edges())),
+    "Invalid input argument: reversed_graph_view should have the same number of vertices and edges "
+    "with graph_view.");
+
+  if (source == destination) {
+    rmm::device_uvector<vertex_t> path(1, handle.get_stream());
+    raft::update_device(path.data(), &source, size_t{1}, handle.get_stream());
+    return std::make_tuple(vertex_t{0}, std::move(path));
+  }
+
+  auto backward_graph_view = reversed_graph_view ? *reversed_graph_view : graph_view;
+
+  // 2. initialize distances and predecessors of both searches
+
+  rmm::device_uvector<vertex_t> forward_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> forward_predecessors(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> backward_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> backward_predecessors(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               forward_distances.begin(),
+               forward_distances.end(),
+               invalid_distance);
+  thrust::fill(handle.get_thrust_policy(),
+               backward_distances.begin(),
+               backward_distances.end(),
+               invalid_distance);
+  thrust::fill(handle.get_thrust_policy(),
+               forward_predecessors.begin(),
+               forward_predecessors.end(),
+               invalid_vertex);
+  thrust::fill(handle.get_thrust_policy(),
+               backward_predecessors.begin(),
+               backward_predecessors.end(),
+               invalid_vertex);
+  vertex_t zero_distance{0};
+  raft::update_device(
+    forward_distances.data() + source, &zero_distance, size_t{1}, handle.get_stream());
+  raft::update_device(
+    backward_distances.data() + destination, &zero_distance, size_t{1}, handle.get_stream());
+
+  // 3. initialize BFS frontiers
+
+  constexpr size_t bucket_idx_cur  = 0;
+  constexpr size_t bucket_idx_next = 1;
+  constexpr size_t num_buckets     = 2;
+
+  vertex_frontier_t<vertex_t, void, false, true> forward_frontier(handle, num_buckets);
+  vertex_frontier_t<vertex_t, void, false, true> backward_frontier(handle, num_buckets);
+  forward_frontier.bucket(bucket_idx_cur).insert(source);
+  backward_frontier.bucket(bucket_idx_cur).insert(destination);
+
+  // 4. advance the side with the smaller frontier by one level until the two searches meet
+
+  vertex_t forward_depth{0};
+  vertex_t backward_depth{0};
+  auto meet = invalid_vertex;
+  while ((meet == invalid_vertex) && (forward_depth + backward_depth < depth_limit)) {
+    auto forward_size  = forward_frontier.bucket(bucket_idx_cur).aggregate_size();
+    auto backward_size = backward_frontier.bucket(bucket_idx_cur).aggregate_size();
+    if ((forward_size == 0) || (backward_size == 0)) { break; }
+
+    auto forward         = forward_size <= backward_size;
+    auto& frontier       = forward ? forward_frontier : backward_frontier;
+    auto& search_view    = forward ? graph_view : backward_graph_view;
+    auto& depth          = forward ? forward_depth : backward_depth;
+    auto distances       = forward ? forward_distances.data() : backward_distances.data();
+    auto predecessors    = forward ? forward_predecessors.data() : backward_predecessors.data();
+    auto other_distances = forward ? backward_distances.data() : forward_distances.data();
+
+    auto [new_frontier_vertex_buffer, predecessor_buffer] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    search_view,
+                                                    frontier.bucket(bucket_idx_cur),
+                                                    edge_src_dummy_property_t{}.view(),
+                                                    edge_dst_dummy_property_t{}.view(),
+                                                    edge_dummy_property_t{}.view(),
+                                                    bidirectional_bfs_e_op_t<vertex_t>{distances},
+                                                    reduce_op::any<vertex_t>());
+
+    update_v_frontier(handle,
+                      search_view,
+                      std::move(new_frontier_vertex_buffer),
+                      std::move(predecessor_buffer),
+                      frontier,
+                      std::vector<size_t>{bucket_idx_next},
+                      distances,
+                      thrust::make_zip_iterator(thrust::make_tuple(distances, predecessors)),
+                      bidirectional_bfs_v_op_t<vertex_t>{depth, bucket_idx_next});
+
+    frontier.bucket(bucket_idx_cur).clear();
+    frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+    ++depth;
+
+    // every vertex of the new level reached by the other side lies on a shortest path (no vertex
+    // of the previous levels was reached by both sides)
+    meet = thrust::get<2>(reduce_meeting_candidates(
+      handle,
+      frontier,
+      std::vector<size_t>{bucket_idx_cur},
+      meeting_candidate_t<vertex_t, vertex_t>{distances, other_distances}));
+  }
+
+  if (meet == invalid_vertex) {
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  // 5. extract the path
+
+  auto path = join_bidirectional_paths(handle,
+                                       graph_view,
+                                       backward_graph_view,
+                                       forward_distances.data(),
+                                       forward_predecessors.data(),
+                                       backward_distances.data(),
+                                       backward_predecessors.data(),
+                                       meet);
+
+  return std::make_tuple(static_cast<vertex_t>(path.size() - 1), std::move(path));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> reversed_edge_weight_view,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_floating_point<weight_t>::value,
+                "weight_t should be a floating point type.");
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const num_edges    = graph_view.number_of_edges();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    is_valid_vertex(num_vertices, source) && is_valid_vertex(num_vertices, destination),
+    "Invalid input argument: source or destination vertex out-of-range.");
+  CUGRAPH_EXPECTS(graph_view.is_symmetric() || reversed_graph_view.has_value(),
+                  "Invalid input argument: reversed_graph_view is required for a directed graph.");
+  CUGRAPH_EXPECTS(reversed_graph_view.has_value() == reversed_edge_weight_view.has_value(),
+                  "Invalid input argument: reversed_graph_view and reversed_edge_weight_view "
+                  "should be both valid or both std::nullopt.");
+  CUGRAPH_EXPECTS(
+    !reversed_graph_view ||
+      (((*reversed_graph_view).number_of_vertices() == num_vertices) &&
+       ((*reversed_graph_view).number_of_edges() == num_edges)),
+    "Invalid input argument: reversed_graph_view should have the same number of vertices and edges "
+    "with graph_view.");
+
+  if (do_expensive_check) {
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input edge weights should have non-negative values.");
+  }
+
+  if (source == destination) {
+    rmm::device_uvector<vertex_t> path(1, handle.get_stream());
+    raft::update_device(path.data(), &source, size_t{1}, handle.get_stream());
+    return std::make_tuple(weight_t{0.0}, std::move(path));
+  }
+
+  if (num_edges == 0) {
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  auto backward_graph_view       = reversed_graph_view ? *reversed_graph_view : graph_view;
+  auto backward_edge_weight_view =
+    reversed_edge_weight_view ? *reversed_edge_weight_view : edge_weight_view;
+
+  // 2. initialize distances and predecessors of both searches
+
+  rmm::device_uvector<weight_t> forward_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> forward_predecessors(num_vertices, handle.get_stream());
+  rmm::device_uvector<weight_t> backward_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> backward_predecessors(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               forward_distances.begin(),
+               forward_distances.end(),
+               invalid_distance);
+  thrust::fill(handle.get_thrust_policy(),
+               backward_distances.begin(),
+               backward_distances.end(),
+               invalid_distance);
+  thrust::fill(handle.get_thrust_policy(),
+               forward_predecessors.begin(),
+               forward_predecessors.end(),
+               invalid_vertex);
+  thrust::fill(handle.get_thrust_policy(),
+               backward_predecessors.begin(),
+               backward_predecessors.end(),
+               invalid_vertex);
+  weight_t zero_distance{0.0};
+  raft::update_device(
+    forward_distances.data() + source, &zero_distance, size_t{1}, handle.get_stream());
+  raft::update_device(
+    backward_distances.data() + destination, &zero_distance, size_t{1}, handle.get_stream());
+
+  // 3. compute the near-far threshold increment (identical to the Near-Far method in sssp)
+
+  weight_t average_vertex_degree{0.0};
+  weight_t average_edge_weight{0.0};
+  thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
+    handle,
+    graph_view,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_dummy_property_t{}.view(),
+    edge_weight_view,
+    [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) {
+      return thrust::make_tuple(weight_t{1.0}, w);
+    },
+    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
+  average_vertex_degree /= static_cast<weight_t>(num_vertices);
+  average_edge_weight /= static_cast<weight_t>(num_edges);
+  auto delta =
+    (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+
+  // 4. initialize the frontiers (a near-far pile per side)
+
+  constexpr size_t bucket_idx_cur_near  = 0;
+  constexpr size_t bucket_idx_next_near = 1;
+  constexpr size_t bucket_idx_far       = 2;
+  constexpr size_t num_buckets          = 3;
+
+  vertex_frontier_t<vertex_t, void, false, true> forward_frontier(handle, num_buckets);
+  vertex_frontier_t<vertex_t, void, false, true> backward_frontier(handle, num_buckets);
+  forward_frontier.bucket(bucket_idx_cur_near).insert(source);
+  backward_frontier.bucket(bucket_idx_cur_near).insert(destination);
+
+  auto forward_near_far_threshold  = delta;
+  auto backward_near_far_threshold = delta;
+
+  // the smallest pending distance of each side bounds the distances of the vertices to be settled
+  // later (every shortest path not found yet passes through a pending vertex with an exact
+  // distance on each side)
+  weight_t forward_min_pending{0.0};
+  weight_t backward_min_pending{0.0};
+  size_t forward_num_pending{1};
+  size_t backward_num_pending{1};
+
+  // 5. relax the near pile of the side with fewer pending vertices until the bidirectional
+  // Dijkstra stopping criterion holds
+
+  auto mu   = invalid_distance;  // the length of the shortest path found so far
+  auto meet = invalid_vertex;
+  while ((forward_num_pending > 0) && (backward_num_pending > 0) &&
+         (forward_min_pending + backward_min_pending < std::min(mu, cutoff))) {
+    auto forward            = forward_num_pending <= backward_num_pending;
+    auto& frontier          = forward ? forward_frontier : backward_frontier;
+    auto& search_view       = forward ? graph_view : backward_graph_view;
+    auto search_weight_view = forward ? edge_weight_view : backward_edge_weight_view;
+    auto& near_far_threshold =
+      forward ? forward_near_far_threshold : backward_near_far_threshold;
+    auto distances       = forward ? forward_distances.data() : backward_distances.data();
+    auto predecessors    = forward ? forward_predecessors.data() : backward_predecessors.data();
+    auto other_distances = forward ? backward_distances.data() : forward_distances.data();
+
+    auto [new_frontier_vertex_buffer, distance_predecessor_buffer] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        search_view,
+        frontier.bucket(bucket_idx_cur_near),
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_dummy_property_t{}.view(),
+        search_weight_view,
+        bidirectional_sssp_e_op_t<vertex_t, weight_t>{distances, cutoff},
+        reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+
+    update_v_frontier(handle,
+                      search_view,
+                      std::move(new_frontier_vertex_buffer),
+                      std::move(distance_predecessor_buffer),
+                      frontier,
+                      std::vector<size_t>{bucket_idx_next_near, bucket_idx_far},
+                      distances,
+                      thrust::make_zip_iterator(thrust::make_tuple(distances, predecessors)),
+                      bidirectional_sssp_v_op_t<vertex_t, weight_t>{
+                        near_far_threshold, bucket_idx_next_near, bucket_idx_far});
+
+    frontier.bucket(bucket_idx_cur_near).clear();
+    frontier.bucket(bucket_idx_cur_near).shrink_to_fit();
+    if (frontier.bucket(bucket_idx_next_near).aggregate_size() > 0) {
+      frontier.swap_buckets(bucket_idx_cur_near, bucket_idx_next_near);
+    } else if (frontier.bucket(bucket_idx_far).aggregate_size() >
+               0) {  // near queue is empty, split the far queue
+      auto old_near_far_threshold = near_far_threshold;
+      near_far_threshold += delta;
+
+      while (true) {
+        frontier.split_bucket(
+          bucket_idx_far,
+          std::vector<size_t>{bucket_idx_cur_near},
+          [distances, old_near_far_threshold, near_far_threshold] __device__(auto v) {
+            auto dist = *(distances + v);
+            return dist >= old_near_far_threshold
+                     ? thrust::optional<size_t>{dist < near_far_threshold ? bucket_idx_cur_near
+                                                                          : bucket_idx_far}
+                     : thrust::nullopt;
+          });
+        if ((frontier.bucket(bucket_idx_cur_near).aggregate_size() > 0) ||
+            (frontier.bucket(bucket_idx_far).aggregate_size() == 0)) {
+          break;
+        } else {
+          near_far_threshold += delta;
+        }
+      }
+    }
+
+    // every vertex with an updated distance is in the near or far pile
+    weight_t min_pending{};
+    weight_t path_length{};
+    vertex_t candidate{};
+    thrust::tie(min_pending, path_length, candidate) = reduce_meeting_candidates(
+      handle,
+      frontier,
+      std::vector<size_t>{bucket_idx_cur_near, bucket_idx_far},
+      meeting_candidate_t<vertex_t, weight_t>{distances, other_distances});
+    auto num_pending = frontier.bucket(bucket_idx_cur_near).aggregate_size() +
+                       frontier.bucket(bucket_idx_far).aggregate_size();
+    if (forward) {
+      forward_min_pending = min_pending;
+      forward_num_pending = num_pending;
+    } else {
+      backward_min_pending = min_pending;
+      backward_num_pending = num_pending;
+    }
+    if (path_length < mu) {
+      mu   = path_length;
+      meet = candidate;
+    }
+  }
+
+  if ((meet == invalid_vertex) || (mu >= cutoff)) {
+    return std::make_tuple(invalid_distance, rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  // 6. extract the path
+
+  rmm::device_uvector<vertex_t> forward_hops(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> backward_hops(num_vertices, handle.get_stream());
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(size_t{1}),
+    predecessor_chain_length_t<vertex_t>{forward_predecessors.data(), forward_hops.data(), meet});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(size_t{1}),
+    predecessor_chain_length_t<vertex_t>{backward_predecessors.data(), backward_hops.data(), meet});
+
+  auto path = join_bidirectional_paths(handle,
+                                       graph_view,
+                                       backward_graph_view,
+                                       forward_hops.data(),
+                                       forward_predecessors.data(),
+                                       backward_hops.data(),
+                                       backward_predecessors.data(),
+                                       meet);
+
+  return std::make_tuple(mu, std::move(path));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t>
+std::tuple<vertex_t, rmm::device_uvector<vertex_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  vertex_t source,
+  vertex_t destination,
+  vertex_t depth_limit,
+  bool do_expensive_check)
+{
+  return detail::bidirectional_bfs(
+    handle, graph_view, reversed_graph_view, source, destination, depth_limit, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<weight_t, rmm::device_uvector<vertex_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  std::optional<graph_view_t<vertex_t, edge_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> reversed_edge_weight_view,
+  vertex_t source,
+  vertex_t destination,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  return detail::bidirectional_sssp(handle,
+                                    graph_view,
+                                    edge_weight_view,
+                                    reversed_graph_view,
+                                    reversed_edge_weight_view,
+                                    source,
+                                    destination,
+                                    cutoff,
+                                    do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/bidirectional_search_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<int32_t, rmm::device_uvector<int32_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<graph_view_t<int32_t, int32_t, false, false>> reversed_graph_view,
+  int32_t source,
+  int32_t destination,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template std::tuple<int32_t, rmm::device_uvector<int32_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<graph_view_t<int32_t, int64_t, false, false>> reversed_graph_view,
+  int32_t source,
+  int32_t destination,
+  int32_t depth_limit,
+  bool do_expensive_check);
+
+template std::tuple<int64_t, rmm::device_uvector<int64_t>> bidirectional_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<graph_view_t<int64_t, int64_t, false, false>> reversed_graph_view,
+  int64_t source,
+  int64_t destination,
+  int64_t depth_limit,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int32_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  std::optional<graph_view_t<int32_t, int32_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> reversed_edge_weight_view,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  std::optional<graph_view_t<int32_t, int32_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> reversed_edge_weight_view,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int32_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  std::optional<graph_view_t<int32_t, int64_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> reversed_edge_weight_view,
+  int32_t source,
+  int32_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int32_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  std::optional<graph_view_t<int32_t, int64_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> reversed_edge_weight_view,
+  int32_t source,
+  int32_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+template std::tuple<float, rmm::device_uvector<int64_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  std::optional<graph_view_t<int64_t, int64_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> reversed_edge_weight_view,
+  int64_t source,
+  int64_t destination,
+  float cutoff,
+  bool do_expensive_check);
+
+template std::tuple<double, rmm::device_uvector<int64_t>> bidirectional_sssp(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  std::optional<graph_view_t<int64_t, int64_t, false, false>> reversed_graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> reversed_edge_weight_view,
+  int64_t source,
+  int64_t destination,
+  double cutoff,
+  bool do_expensive_check);
+
+}  // namespace cugraph
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+
+namespace cugraph {
+namespace detail {
+
+// the number of hops from the search root to v in the predecessor tree (the weighted searches do
+// not track hop counts, extract_bfs_paths() reads the hop count of the destination only)
+template <typename vertex_t>
+struct predecessor_chain_length_t {
+  vertex_t const* predecessors{nullptr};
+  vertex_t* hops{nullptr};
+  vertex_t v{};
+
+  __device__ void operator()(size_t) const
+  {
+    vertex_t count{0};
+    for (auto u = *(predecessors + v); u != invalid_vertex_id<vertex_t>::value;
+         u      = *(predecessors + u)) {
+      ++count;
+    }
+    *(hops + v) = count;
+  }
+};
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct vertex_value_lookup_t {
+  vertex_t const* values{nullptr};
+
+  __device__ vertex_t operator()(vertex_t v) const
+  {
+    return v != invalid_vertex_id<vertex_t>::value ? values[v]
+                                                   : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct is_new_forest_vertex_t {
+  vertex_t const* forest_indices{nullptr};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return (v != invalid_vertex_id<vertex_t>::value) &&
+           (forest_indices[v] == invalid_vertex_id<vertex_t>::value);
+  }
+};
+
+template <typename vertex_t>
+struct set_forest_index_t {
+  vertex_t const* new_forest_vertices{nullptr};
+  vertex_t* forest_indices{nullptr};
+  vertex_t forest_index_first{0};
+
+  __device__ void operator()(vertex_t i) const
+  {
+    forest_indices[new_forest_vertices[i]] = forest_index_first + i;
+  }
+};
+
+// after the k'th round, depths[i] is the number of hops from the i'th forest vertex to
+// ancestors[i], its 2^k'th ancestor (or to the root if ancestors[i] is invalid)
+template <typename vertex_t>
+struct pointer_jump_t {
+  vertex_t const* depths{nullptr};
+  vertex_t const* ancestors{nullptr};
+  vertex_t* new_depths{nullptr};
+  vertex_t* new_ancestors{nullptr};
+
+  __device__ void operator()(vertex_t i) const
+  {
+    auto a = ancestors[i];
+    if (a == invalid_vertex_id<vertex_t>::value) {
+      new_depths[i]    = depths[i];
+      new_ancestors[i] = a;
+    } else {
+      new_depths[i]    = depths[i] + depths[a];
+      new_ancestors[i] = ancestors[a];
+    }
+  }
+};
+
+template <typename vertex_t>
+struct path_length_t {
+  vertex_t const* depths{nullptr};
+
+  __device__ size_t operator()(vertex_t forest_index) const
+  {
+    return static_cast<size_t>(depths[forest_index]) + size_t{1};
+  }
+};
+
+template <typename vertex_t>
+struct is_invalid_input_vertex_t {
+  vertex_t num_vertices{0};
+  bool allow_invalid_vertex{false};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return !is_valid_vertex(num_vertices, v) &&
+           !(allow_invalid_vertex && (v == invalid_vertex_id<vertex_t>::value));
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<size_t>>
+extract_path_forest(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+                    vertex_t const* predecessors,
+                    vertex_t const* destinations,
+                    size_t n_destinations,
+                    bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_vertices == 0) || (predecessors != nullptr),
+                  "Invalid input argument: predecessors cannot be null");
+  CUGRAPH_EXPECTS((n_destinations == 0) || (destinations != nullptr),
+                  "Invalid input argument: destinations cannot be null");
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     destinations,
+                                     destinations + n_destinations,
+                                     is_invalid_input_vertex_t<vertex_t>{num_vertices, false}) == 0,
+                    "Invalid input argument: destinations have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     predecessors,
+                                     predecessors + num_vertices,
+                                     is_invalid_input_vertex_t<vertex_t>{num_vertices, true}) == 0,
+                    "Invalid input argument: predecessors have invalid vertex IDs.");
+  }
+
+  // 2. collect the vertices on the paths, walking back from the destinations one hop at a time; a
+  // vertex is added to the forest when it is first reached and the walks stop at the vertices
+  // already in the forest (so every forest vertex is visited once)
+
+  rmm::device_uvector<vertex_t> forest_indices(num_vertices, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), forest_indices.begin(), forest_indices.end(), invalid_vertex);
+
+  rmm::device_uvector<vertex_t> forest_vertices(0, handle.get_stream());
+
+  rmm::device_uvector<vertex_t> frontier(n_destinations, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), destinations, destinations + n_destinations, frontier.begin());
+  thrust::sort(handle.get_thrust_policy(), frontier.begin(), frontier.end());
+  frontier.resize(
+    thrust::distance(frontier.begin(),
+                     thrust::unique(handle.get_thrust_policy(), frontier.begin(), frontier.end())),
+    handle.get_stream());
+
+  while (frontier.size() > 0) {
+    auto forest_index_first = static_cast<vertex_t>(forest_vertices.size());
+    forest_vertices.resize(forest_vertices.size() + frontier.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 frontier.begin(),
+                 frontier.end(),
+                 forest_vertices.begin() + forest_index_first);
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(static_cast<vertex_t>(frontier.size())),
+      set_forest_index_t<vertex_t>{frontier.data(), forest_indices.data(), forest_index_first});
+
+    rmm::device_uvector<vertex_t> new_frontier(frontier.size(), handle.get_stream());
+    auto predecessor_first = thrust::make_transform_iterator(
+      frontier.begin(), vertex_value_lookup_t<vertex_t>{predecessors});
+    new_frontier.resize(
+      thrust::distance(new_frontier.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       predecessor_first,
+                                       predecessor_first + frontier.size(),
+                                       new_frontier.begin(),
+                                       is_new_forest_vertex_t<vertex_t>{forest_indices.data()})),
+      handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), new_frontier.begin(), new_frontier.end());
+    new_frontier.resize(thrust::distance(new_frontier.begin(),
+                                         thrust::unique(handle.get_thrust_policy(),
+                                                        new_frontier.begin(),
+                                                        new_frontier.end())),
+                        handle.get_stream());
+    frontier = std::move(new_frontier);
+  }
+  auto const num_forest_vertices = static_cast<vertex_t>(forest_vertices.size());
+
+  // 3. link the forest vertices to their parents (the predecessor of every non-root forest vertex
+  // is a forest vertex)
+
+  rmm::device_uvector<vertex_t> forest_parents(num_forest_vertices, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    forest_vertices.begin(),
+    forest_vertices.end(),
+    forest_parents.begin(),
+    [predecessor_lookup  = vertex_value_lookup_t<vertex_t>{predecessors},
+     forest_index_lookup = vertex_value_lookup_t<vertex_t>{forest_indices.data()}] __device__(
+      auto v) { return forest_index_lookup(predecessor_lookup(v)); });
+
+  rmm::device_uvector<vertex_t> destination_forest_indices(n_destinations, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    destinations,
+                    destinations + n_destinations,
+                    destination_forest_indices.begin(),
+                    vertex_value_lookup_t<vertex_t>{forest_indices.data()});
+  forest_indices.resize(0, handle.get_stream());
+  forest_indices.shrink_to_fit(handle.get_stream());
+
+  // 4. compute the depths of the forest vertices (by pointer jumping, this takes
+  // ceil(log2(maximum depth)) rounds)
+
+  rmm::device_uvector<vertex_t> depths(num_forest_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> ancestors(num_forest_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    forest_parents.begin(),
+                    forest_parents.end(),
+                    depths.begin(),
+                    [invalid_vertex] __device__(auto parent) {
+                      return parent != invalid_vertex ? vertex_t{1} : vertex_t{0};
+                    });
+  thrust::copy(
+    handle.get_thrust_policy(), forest_parents.begin(), forest_parents.end(), ancestors.begin());
+
+  rmm::device_uvector<vertex_t> new_depths(num_forest_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> new_ancestors(num_forest_vertices, handle.get_stream());
+  for (size_t round = 0;; ++round) {
+    auto num_unresolved = thrust::count_if(handle.get_thrust_policy(),
+                                           ancestors.begin(),
+                                           ancestors.end(),
+                                           [invalid_vertex] __device__(auto a) {
+                                             return a != invalid_vertex;
+                                           });
+    if (num_unresolved == 0) { break; }
+    CUGRAPH_EXPECTS(round < sizeof(vertex_t) * 8,
+                    "Invalid input argument: predecessors should not have a cycle.");
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_forest_vertices),
+      pointer_jump_t<vertex_t>{
+        depths.data(), ancestors.data(), new_depths.data(), new_ancestors.data()});
+    std::swap(depths, new_depths);
+    std::swap(ancestors, new_ancestors);
+  }
+
+  // 5. compute the path offsets
+
+  rmm::device_uvector<size_t> path_offsets(n_destinations + 1, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    destination_forest_indices.begin(),
+                    destination_forest_indices.end(),
+                    path_offsets.begin(),
+                    path_length_t<vertex_t>{depths.data()});
+  path_offsets.set_element_to_zero_async(n_destinations, handle.get_stream());
+  thrust::exclusive_scan(
+    handle.get_thrust_policy(), path_offsets.begin(), path_offsets.end(), path_offsets.begin());
+
+  return std::make_tuple(std::move(forest_vertices),
+                         std::move(forest_parents),
+                         std::move(destination_forest_indices),
+                         std::move(path_offsets));
+}
+
+}  // namespace cugraph
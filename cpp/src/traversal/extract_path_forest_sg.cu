@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/extract_path_forest_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>>
+extract_path_forest(raft::handle_t const& handle,
+                    graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                    int32_t const* predecessors,
+                    int32_t const* destinations,
+                    size_t n_destinations,
+                    bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<size_t>>
+extract_path_forest(raft::handle_t const& handle,
+                    graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+                    int32_t const* predecessors,
+                    int32_t const* destinations,
+                    size_t n_destinations,
+                    bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<size_t>>
+extract_path_forest(raft::handle_t const& handle,
+                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                    int64_t const* predecessors,
+                    int64_t const* destinations,
+                    size_t n_destinations,
+                    bool do_expensive_check);
+
+}  // namespace cugraph
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/host_traversal.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// OpenMP pragmas are dropped if cugraph_host is built without OpenMP (instead of triggering
+// -Wunknown-pragmas)
+#ifdef _OPENMP
+#define CUGRAPH_HOST_OMP(directive) _Pragma(#directive)
+#else
+#define CUGRAPH_HOST_OMP(directive)
+#endif
+
+namespace cugraph {
+namespace host {
+
+namespace {
+
+// identical to cugraph::invalid_vertex_id<vertex_t>::value (graph.hpp is not host-only)
+template <typename vertex_t>
+constexpr vertex_t invalid_vertex =
+  std::is_signed<vertex_t>::value ? vertex_t{-1} : std::numeric_limits<vertex_t>::max();
+
+// the frontier of a step is scanned in chunks of this many vertices (dynamic scheduling)
+constexpr size_t frontier_chunk_size{64};
+
+size_t resolve_num_threads(size_t num_threads)
+{
+#ifdef _OPENMP
+  return num_threads > 0 ? num_threads : static_cast<size_t>(omp_get_max_threads());
+#else
+  return size_t{1};
+#endif
+}
+
+size_t thread_idx()
+{
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_thread_num());
+#else
+  return size_t{0};
+#endif
+}
+
+// the vertices are partitioned to the threads in contiguous ranges, a thread owns (and is the
+// only writer of) the distances, predecessors, and buckets of the vertices in its range
+template <typename vertex_t>
+class vertex_owner_t {
+ public:
+  vertex_owner_t(vertex_t num_vertices, size_t num_threads)
+    : range_size_(std::max(
+        vertex_t{1},
+        static_cast<vertex_t>((static_cast<size_t>(num_vertices) + (num_threads - 1)) /
+                              num_threads)))
+  {
+  }
+
+  size_t operator()(vertex_t v) const { return static_cast<size_t>(v / range_size_); }
+
+ private:
+  vertex_t range_size_{1};
+};
+
+// updates buffered by the scanning thread for the owner thread of the updated vertex
+template <typename update_t>
+class update_buffers_t {
+ public:
+  update_buffers_t(size_t num_threads)
+    : num_threads_(num_threads), buffers_(num_threads * num_threads)
+  {
+  }
+
+  void push(size_t scanning_thread, size_t owner_thread, update_t const& update)
+  {
+    buffers_[scanning_thread * num_threads_ + owner_thread].push_back(update);
+  }
+
+  // should be called by the owner thread only, clears the consumed buffers (but keeps their
+  // capacity for the following steps)
+  template <typename UpdateOp>
+  void consume(size_t owner_thread, UpdateOp update_op)
+  {
+    for (size_t i = 0; i < num_threads_; ++i) {
+      auto& buffer = buffers_[i * num_threads_ + owner_thread];
+      for (auto const& update : buffer) {
+        update_op(update);
+      }
+      buffer.clear();
+    }
+  }
+
+ private:
+  size_t num_threads_{0};
+  std::vector<std::vector<update_t>> buffers_{};
+};
+
+template <typename vertex_t>
+void concatenate(std::vector<std::vector<vertex_t>> const& lists, std::vector<vertex_t>& output)
+{
+  output.clear();
+  for (auto const& list : lists) {
+    output.insert(output.end(), list.begin(), list.end());
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+void check_csr(edge_t const* offsets,
+               vertex_t const* indices,
+               vertex_t num_vertices,
+               void const* distances)
+{
+  CUGRAPH_EXPECTS(num_vertices >= vertex_t{0},
+                  "Invalid input argument: num_vertices should be non-negative.");
+  CUGRAPH_EXPECTS(offsets != nullptr, "Invalid input argument: offsets should not be nullptr.");
+  CUGRAPH_EXPECTS((indices != nullptr) || (offsets[num_vertices] == edge_t{0}),
+                  "Invalid input argument: indices should not be nullptr.");
+  CUGRAPH_EXPECTS(distances != nullptr,
+                  "Invalid input argument: distances should not be nullptr.");
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t>
+void bfs(edge_t const* offsets,
+         vertex_t const* indices,
+         vertex_t num_vertices,
+         vertex_t* distances,
+         vertex_t* predecessors,
+         vertex_t const* sources,
+         size_t n_sources,
+         vertex_t depth_limit,
+         size_t num_threads)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_integral<edge_t>::value, "edge_t should be integral.");
+
+  constexpr auto invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  // 1. check input arguments
+
+  check_csr(offsets, indices, num_vertices, distances);
+  CUGRAPH_EXPECTS((n_sources == 0) || (sources != nullptr),
+                  "Invalid input argument: sources should not be nullptr.");
+  for (size_t i = 0; i < n_sources; ++i) {
+    CUGRAPH_EXPECTS((sources[i] >= vertex_t{0}) && (sources[i] < num_vertices),
+                    "Invalid input argument: source vertex out-of-range.");
+  }
+
+  num_threads = resolve_num_threads(num_threads);
+  vertex_owner_t<vertex_t> owner(num_vertices, num_threads);
+
+  // 2. initialize distances and predecessors
+
+  CUGRAPH_HOST_OMP(omp parallel for schedule(static) num_threads(num_threads))
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    distances[v] = invalid_distance;
+    if (predecessors != nullptr) { predecessors[v] = invalid_vertex<vertex_t>; }
+  }
+
+  std::vector<std::vector<vertex_t>> owned_frontiers(num_threads);
+  for (size_t i = 0; i < n_sources; ++i) {
+    auto s = sources[i];
+    if (distances[s] == invalid_distance) {
+      distances[s] = vertex_t{0};
+      owned_frontiers[owner(s)].push_back(s);
+    }
+  }
+
+  // 3. expand the frontier one level at a time
+
+  update_buffers_t<std::tuple<vertex_t, vertex_t>> buffers(num_threads);  // (vertex, predecessor)
+  std::vector<vertex_t> frontier{};
+  for (vertex_t depth = 0; depth < depth_limit; ++depth) {
+    concatenate(owned_frontiers, frontier);
+    if (frontier.size() == 0) { break; }
+
+    CUGRAPH_HOST_OMP(
+      omp parallel for schedule(dynamic, frontier_chunk_size) num_threads(num_threads))
+    for (size_t i = 0; i < frontier.size(); ++i) {
+      auto t = thread_idx();
+      auto u = frontier[i];
+      for (auto e = offsets[u]; e < offsets[u + 1]; ++e) {
+        auto v = indices[e];
+        if (distances[v] == invalid_distance) { buffers.push(t, owner(v), std::make_tuple(v, u)); }
+      }
+    }
+
+    CUGRAPH_HOST_OMP(omp parallel for schedule(static, 1) num_threads(num_threads))
+    for (size_t t = 0; t < num_threads; ++t) {
+      owned_frontiers[t].clear();
+      buffers.consume(t, [&](auto const& update) {
+        auto [v, u] = update;
+        if (distances[v] == invalid_distance) {
+          distances[v] = depth + 1;
+          if (predecessors != nullptr) { predecessors[v] = u; }
+          owned_frontiers[t].push_back(v);
+        }
+      });
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void sssp(edge_t const* offsets,
+          vertex_t const* indices,
+          weight_t const* weights,
+          vertex_t num_vertices,
+          weight_t* distances,
+          vertex_t* predecessors,
+          vertex_t source,
+          weight_t cutoff,
+          std::optional<weight_t> delta,
+          size_t num_threads)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_integral<edge_t>::value, "edge_t should be integral.");
+  static_assert(std::is_floating_point<weight_t>::value,
+                "weight_t should be a floating point type.");
+
+  constexpr auto invalid_distance = std::numeric_limits<weight_t>::max();
+
+  // 1. check input arguments
+
+  check_csr(offsets, indices, num_vertices, distances);
+  auto const num_edges = offsets[num_vertices];
+  CUGRAPH_EXPECTS((weights != nullptr) || (num_edges == edge_t{0}),
+                  "Invalid input argument: weights should not be nullptr.");
+  CUGRAPH_EXPECTS((source >= vertex_t{0}) && (source < num_vertices),
+                  "Invalid input argument: source vertex out-of-range.");
+  CUGRAPH_EXPECTS(!delta || (*delta > weight_t{0.0}),
+                  "Invalid input argument: delta should be positive.");
+
+  num_threads = resolve_num_threads(num_threads);
+  vertex_owner_t<vertex_t> owner(num_vertices, num_threads);
+
+  // 2. initialize distances and predecessors
+
+  CUGRAPH_HOST_OMP(omp parallel for schedule(static) num_threads(num_threads))
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    distances[v] = invalid_distance;
+    if (predecessors != nullptr) { predecessors[v] = invalid_vertex<vertex_t>; }
+  }
+  distances[source] = weight_t{0.0};
+  if (num_edges == edge_t{0}) { return; }
+
+  // 3. set delta (identical to sssp_method_t::DELTA_STEPPING in sssp())
+
+  if (!delta) {
+    weight_t weight_sum{0.0};
+    weight_t max_weight{0.0};
+    CUGRAPH_HOST_OMP(omp parallel for schedule(static) num_threads(num_threads)
+                       reduction(+ : weight_sum) reduction(max : max_weight))
+    for (edge_t e = 0; e < num_edges; ++e) {
+      weight_sum += weights[e];
+      max_weight = std::max(max_weight, weights[e]);
+    }
+    auto average_vertex_degree = static_cast<weight_t>(num_edges) / num_vertices;
+    auto average_edge_weight   = weight_sum / static_cast<weight_t>(num_edges);
+    delta = std::min(max_weight / average_vertex_degree, average_edge_weight);
+    if (*delta <= weight_t{0.0}) { delta = weight_t{1.0}; }  // every edge weight is 0
+  }
+  auto bucket_idx = [delta = *delta](weight_t distance) {
+    return static_cast<size_t>(distance / delta);
+  };
+
+  // 4. delta-stepping iteration (the buckets of the vertices a thread owns are kept by the thread,
+  // bucket indices can be sparse for a wide edge weight spread)
+
+  std::vector<std::map<size_t, std::vector<vertex_t>>> owned_buckets(num_threads);
+  owned_buckets[owner(source)][0].push_back(source);
+
+  // a vertex can appear in a bucket multiple times, these stamp the last iteration (phase) that
+  // took the vertex from the current bucket (moved the vertex to the settled list)
+  std::vector<size_t> iteration_stamps(num_vertices, 0);
+  std::vector<size_t> phase_stamps(num_vertices, 0);
+
+  update_buffers_t<std::tuple<vertex_t, weight_t, vertex_t>> buffers(num_threads);
+  std::vector<std::vector<vertex_t>> owned_current(num_threads);
+  std::vector<std::vector<vertex_t>> owned_settled(num_threads);
+  std::vector<vertex_t> frontier{};
+
+  auto relax = [&](bool light) {
+    CUGRAPH_HOST_OMP(
+      omp parallel for schedule(dynamic, frontier_chunk_size) num_threads(num_threads))
+    for (size_t i = 0; i < frontier.size(); ++i) {
+      auto t          = thread_idx();
+      auto u          = frontier[i];
+      auto u_distance = distances[u];
+      for (auto e = offsets[u]; e < offsets[u + 1]; ++e) {
+        auto w = weights[e];
+        if ((w <= *delta) != light) { continue; }
+        auto v            = indices[e];
+        auto new_distance = u_distance + w;
+        if (new_distance < std::min(distances[v], cutoff)) {
+          buffers.push(t, owner(v), std::make_tuple(v, new_distance, u));
+        }
+      }
+    }
+
+    CUGRAPH_HOST_OMP(omp parallel for schedule(static, 1) num_threads(num_threads))
+    for (size_t t = 0; t < num_threads; ++t) {
+      buffers.consume(t, [&](auto const& update) {
+        auto [v, new_distance, u] = update;
+        if (new_distance < distances[v]) {
+          distances[v] = new_distance;
+          if (predecessors != nullptr) { predecessors[v] = u; }
+          owned_buckets[t][bucket_idx(new_distance)].push_back(v);
+        }
+      });
+    }
+  };
+
+  size_t iteration{0};
+  size_t phase{0};
+  while (true) {
+    auto cur_bucket_idx = std::numeric_limits<size_t>::max();
+    for (auto const& buckets : owned_buckets) {
+      if (buckets.size() > 0) { cur_bucket_idx = std::min(cur_bucket_idx, buckets.begin()->first); }
+    }
+    if (cur_bucket_idx == std::numeric_limits<size_t>::max()) { break; }
+    ++phase;
+
+    // relax the light edges until the current bucket stops changing
+
+    while (true) {
+      ++iteration;
+      CUGRAPH_HOST_OMP(omp parallel for schedule(static, 1) num_threads(num_threads))
+      for (size_t t = 0; t < num_threads; ++t) {
+        owned_current[t].clear();
+        auto it = owned_buckets[t].find(cur_bucket_idx);
+        if (it == owned_buckets[t].end()) { continue; }
+        for (auto v : it->second) {
+          if ((bucket_idx(distances[v]) == cur_bucket_idx) && (iteration_stamps[v] != iteration)) {
+            iteration_stamps[v] = iteration;
+            owned_current[t].push_back(v);
+            if (phase_stamps[v] != phase) {
+              phase_stamps[v] = phase;
+              owned_settled[t].push_back(v);
+            }
+          }
+        }
+        owned_buckets[t].erase(it);
+      }
+      concatenate(owned_current, frontier);
+      if (frontier.size() == 0) { break; }
+      relax(true);
+    }
+
+    // the distances of the settled vertices are final, relax the heavy edges (w > delta, so the
+    // new distances fall in the following buckets)
+
+    concatenate(owned_settled, frontier);
+    for (auto& settled : owned_settled) {
+      settled.clear();
+    }
+    relax(false);
+  }
+}
+
+// explicit instantiations
+
+template void bfs(int32_t const* offsets,
+                  int32_t const* indices,
+                  int32_t num_vertices,
+                  int32_t* distances,
+                  int32_t* predecessors,
+                  int32_t const* sources,
+                  size_t n_sources,
+                  int32_t depth_limit,
+                  size_t num_threads);
+
+template void bfs(int64_t const* offsets,
+                  int32_t const* indices,
+                  int32_t num_vertices,
+                  int32_t* distances,
+                  int32_t* predecessors,
+                  int32_t const* sources,
+                  size_t n_sources,
+                  int32_t depth_limit,
+                  size_t num_threads);
+
+template void bfs(int64_t const* offsets,
+                  int64_t const* indices,
+                  int64_t num_vertices,
+                  int64_t* distances,
+                  int64_t* predecessors,
+                  int64_t const* sources,
+                  size_t n_sources,
+                  int64_t depth_limit,
+                  size_t num_threads);
+
+template void sssp(int32_t const* offsets,
+                   int32_t const* indices,
+                   float const* weights,
+                   int32_t num_vertices,
+                   float* distances,
+                   int32_t* predecessors,
+                   int32_t source,
+                   float cutoff,
+                   std::optional<float> delta,
+                   size_t num_threads);
+
+template void sssp(int32_t const* offsets,
+                   int32_t const* indices,
+                   double const* weights,
+                   int32_t num_vertices,
+                   double* distances,
+                   int32_t* predecessors,
+                   int32_t source,
+                   double cutoff,
+                   std::optional<double> delta,
+                   size_t num_threads);
+
+template void sssp(int64_t const* offsets,
+                   int32_t const* indices,
+                   float const* weights,
+                   int32_t num_vertices,
+                   float* distances,
+                   int32_t* predecessors,
+                   int32_t source,
+                   float cutoff,
+                   std::optional<float> delta,
+                   size_t num_threads);
+
+template void sssp(int64_t const* offsets,
+                   int32_t const* indices,
+                   double const* weights,
+                   int32_t num_vertices,
+                   double* distances,
+                   int32_t* predecessors,
+                   int32_t source,
+                   double cutoff,
+                   std::optional<double> delta,
+                   size_t num_threads);
+
+template void sssp(int64_t const* offsets,
+                   int64_t const* indices,
+                   float const* weights,
+                   int64_t num_vertices,
+                   float* distances,
+                   int64_t* predecessors,
+                   int64_t source,
+                   float cutoff,
+                   std::optional<float> delta,
+                   size_t num_threads);
+
+template void sssp(int64_t const* offsets,
+                   int64_t const* indices,
+                   double const* weights,
+                   int64_t num_vertices,
+                   double* distances,
+                   int64_t* predecessors,
+                   int64_t source,
+                   double cutoff,
+                   std::optional<double> delta,
+                   size_t num_threads);
+
+}  // namespace host
+}  // namespace cugraph
@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/distance_oracle.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// landmark distance index file layout: landmark_distance_index_header_t, the landmarks, the
+// distances from the landmarks, and the distances to the landmarks (if stored), each section
+// starts at a landmark_distance_index_section_alignment byte boundary (the gaps are zero-filled)
+
+constexpr char landmark_distance_index_magic[8] = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'L'};
+constexpr uint32_t landmark_distance_index_version{1};
+constexpr size_t landmark_distance_index_section_alignment{64};
+
+constexpr uint32_t landmark_distance_index_symmetric_flag{uint32_t{1} << 0};
+constexpr uint32_t landmark_distance_index_distances_to_flag{uint32_t{1} << 1};
+
+struct landmark_distance_index_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t vertex_size;
+  uint32_t weight_size;
+  uint64_t num_vertices;
+  uint64_t num_landmarks;
+  uint64_t reserved[3];
+};
+
+static_assert(sizeof(landmark_distance_index_header_t) == 64);
+
+inline size_t align_landmark_distance_index_offset(size_t offset)
+{
+  return ((offset + (landmark_distance_index_section_alignment - 1)) /
+          landmark_distance_index_section_alignment) *
+         landmark_distance_index_section_alignment;
+}
+
+inline void write_landmark_distance_index_bytes(std::ofstream& file,
+                                               size_t& offset,
+                                               void const* data,
+                                               size_t size)
+{
+  file.write(static_cast<char const*>(data), size);
+  CUGRAPH_EXPECTS(file.good(), "Failed to write a landmark distance index file.");
+  offset += size;
+}
+
+template <typename T>
+void write_landmark_distance_index_section(raft::handle_t const& handle,
+                                           std::ofstream& file,
+                                           size_t& offset,
+                                           rmm::device_uvector<T> const& d_values)
+{
+  std::vector<char> zeros(align_landmark_distance_index_offset(offset) - offset, char{0});
+  write_landmark_distance_index_bytes(file, offset, zeros.data(), zeros.size());
+  std::vector<T> h_values(d_values.size());
+  raft::update_host(h_values.data(), d_values.data(), d_values.size(), handle.get_stream());
+  handle.sync_stream();
+  write_landmark_distance_index_bytes(file, offset, h_values.data(), h_values.size() * sizeof(T));
+}
+
+template <typename T>
+rmm::device_uvector<T> read_landmark_distance_index_section(raft::handle_t const& handle,
+                                                            std::ifstream& file,
+                                                            size_t& offset,
+                                                            size_t size)
+{
+  offset = align_landmark_distance_index_offset(offset);
+  file.seekg(offset);
+  std::vector<T> h_values(size);
+  file.read(reinterpret_cast<char*>(h_values.data()), size * sizeof(T));
+  CUGRAPH_EXPECTS(file.good(), "Invalid input argument: truncated landmark distance index file.");
+  offset += size * sizeof(T);
+
+  rmm::device_uvector<T> d_values(size, handle.get_stream());
+  raft::update_device(d_values.data(), h_values.data(), size, handle.get_stream());
+  handle.sync_stream();
+  return d_values;
+}
+
+// [num_landmarks x V] BFS hop counts => [V x num_landmarks] distances
+template <typename vertex_t, typename weight_t>
+struct hops_to_landmark_distance_t {
+  vertex_t const* hops{nullptr};
+  size_t num_vertices{0};
+  size_t num_landmarks{0};
+
+  __device__ weight_t operator()(size_t i) const
+  {
+    auto hop = *(hops + (i % num_landmarks) * num_vertices + i / num_landmarks);
+    return hop == std::numeric_limits<vertex_t>::max() ? std::numeric_limits<weight_t>::max()
+                                                       : static_cast<weight_t>(hop);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct landmark_distance_bounds_t {
+  weight_t const* distances_from{nullptr};
+  weight_t const* distances_to{nullptr};  // same as distances_from if the graph is symmetric
+  bool has_distances_to{false};
+  size_t num_landmarks{0};
+
+  __device__ thrust::tuple<weight_t, weight_t> operator()(
+    thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    constexpr auto invalid_distance = std::numeric_limits<weight_t>::max();
+
+    auto s = thrust::get<0>(pair);
+    auto t = thrust::get<1>(pair);
+    if (s == t) { return thrust::make_tuple(weight_t{0.0}, weight_t{0.0}); }
+
+    auto s_from = distances_from + static_cast<size_t>(s) * num_landmarks;
+    auto t_from = distances_from + static_cast<size_t>(t) * num_landmarks;
+    auto s_to   = distances_to + static_cast<size_t>(s) * num_landmarks;
+    auto t_to   = distances_to + static_cast<size_t>(t) * num_landmarks;
+
+    weight_t lower{0.0};
+    weight_t upper{invalid_distance};
+    for (size_t i = 0; i < num_landmarks; ++i) {
+      auto ls = *(s_from + i);  // d(l, s)
+      auto lt = *(t_from + i);  // d(l, t)
+      if (ls != invalid_distance) {
+        if (lt == invalid_distance) {  // l reaches s but not t
+          return thrust::make_tuple(invalid_distance, invalid_distance);
+        }
+        lower = std::max(lower, lt - ls);
+      }
+      if (has_distances_to) {
+        auto sl = *(s_to + i);  // d(s, l)
+        auto tl = *(t_to + i);  // d(t, l)
+        if (tl != invalid_distance) {
+          if (sl == invalid_distance) {  // t reaches l but s does not
+            return thrust::make_tuple(invalid_distance, invalid_distance);
+          }
+          lower = std::max(lower, sl - tl);
+        }
+        if ((sl != invalid_distance) && (lt != invalid_distance)) {
+          upper = std::min(upper, sl + lt);
+        }
+      }
+    }
+
+    return thrust::make_tuple(lower, upper);
+  }
+};
+
+// distances from the landmarks ([V x num_landmarks])
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> compute_landmark_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> landmarks,
+  bool do_expensive_check)
+{
+  auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+  rmm::device_uvector<weight_t> distances(num_vertices * landmarks.size(), handle.get_stream());
+
+  if (edge_weight_view) {
+    multi_source_sssp(handle,
+                      graph_view,
+                      *edge_weight_view,
+                      landmarks,
+                      distances.data(),
+                      static_cast<vertex_t*>(nullptr),
+                      std::numeric_limits<weight_t>::max(),
+                      do_expensive_check);
+  } else {
+    rmm::device_uvector<vertex_t> hops(num_vertices * landmarks.size(), handle.get_stream());
+    multi_source_bfs(handle,
+                     graph_view,
+                     landmarks,
+                     hops.data(),
+                     std::numeric_limits<vertex_t>::max(),
+                     do_expensive_check);
+    thrust::tabulate(handle.get_thrust_policy(),
+                     distances.begin(),
+                     distances.end(),
+                     hops_to_landmark_distance_t<vertex_t, weight_t>{
+                       hops.data(), num_vertices, landmarks.size()});
+  }
+
+  return distances;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+landmark_distance_index_t<vertex_t, weight_t> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check)
+{
+  auto num_vertices = graph_view.number_of_vertices();
+
+  CUGRAPH_EXPECTS(
+    num_landmarks <= static_cast<size_t>(num_vertices),
+    "Invalid input argument: num_landmarks should not exceed the number of vertices.");
+
+  // 1. select landmarks
+
+  rmm::device_uvector<vertex_t> landmarks(0, handle.get_stream());
+  if (selection == landmark_selection_t::RANDOM) {
+    landmarks = select_random_vertices(handle, graph_view, rng_state, num_landmarks, false, true);
+  } else {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    if (!graph_view.is_symmetric()) {
+      auto in_degrees = graph_view.compute_in_degrees(handle);
+      thrust::transform(handle.get_thrust_policy(),
+                        degrees.begin(),
+                        degrees.end(),
+                        in_degrees.begin(),
+                        degrees.begin(),
+                        thrust::plus<edge_t>{});
+    }
+    rmm::device_uvector<vertex_t> vertices(num_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), vertices.begin(), vertices.end(), vertex_t{0});
+    thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                               degrees.begin(),
+                               degrees.end(),
+                               vertices.begin(),
+                               thrust::greater<edge_t>{});
+    vertices.resize(num_landmarks, handle.get_stream());
+    vertices.shrink_to_fit(handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), vertices.begin(), vertices.end());
+    landmarks = std::move(vertices);
+  }
+
+  // 2. compute the distances from the landmarks
+
+  auto distances_from_landmarks = detail::compute_landmark_distances(
+    handle,
+    graph_view,
+    edge_weight_view,
+    raft::device_span<vertex_t const>(landmarks.data(), landmarks.size()),
+    do_expensive_check);
+
+  // 3. compute the distances to the landmarks on the reversed graph
+
+  std::optional<rmm::device_uvector<weight_t>> distances_to_landmarks{std::nullopt};
+  if (bidirectional && !graph_view.is_symmetric()) {
+    auto [srcs, dsts, weights] = decompress_to_edgelist(
+      handle, graph_view, edge_weight_view, std::optional<raft::device_span<vertex_t const>>{});
+
+    rmm::device_uvector<vertex_t> vertices(num_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), vertices.begin(), vertices.end(), vertex_t{0});
+
+    graph_t<vertex_t, edge_t, false, false> reversed_graph(handle);
+    std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+      reversed_edge_weights{std::nullopt};
+    std::tie(reversed_graph, reversed_edge_weights, std::ignore, std::ignore, std::ignore) =
+      create_graph_from_edgelist<vertex_t, edge_t, weight_t, edge_t, int32_t, false, false>(
+        handle,
+        std::make_optional(std::move(vertices)),
+        std::move(dsts),
+        std::move(srcs),
+        std::move(weights),
+        std::nullopt,
+        std::nullopt,
+        graph_properties_t{false, graph_view.is_multigraph()},
+        false);
+
+    distances_to_landmarks = detail::compute_landmark_distances(
+      handle,
+      reversed_graph.view(),
+      reversed_edge_weights
+        ? std::make_optional<edge_property_view_t<edge_t, weight_t const*>>(
+            (*reversed_edge_weights).view())
+        : std::nullopt,
+      raft::device_span<vertex_t const>(landmarks.data(), landmarks.size()),
+      false);
+  }
+
+  return landmark_distance_index_t<vertex_t, weight_t>{num_vertices,
+                                                       graph_view.is_symmetric(),
+                                                       std::move(landmarks),
+                                                       std::move(distances_from_landmarks),
+                                                       std::move(distances_to_landmarks)};
+}
+
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<weight_t>, rmm::device_uvector<weight_t>> landmark_distance_bounds(
+  raft::handle_t const& handle,
+  landmark_distance_index_t<vertex_t, weight_t> const& index,
+  raft::device_span<vertex_t const> srcs,
+  raft::device_span<vertex_t const> dsts,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(srcs.size() == dsts.size(),
+                  "Invalid input argument: srcs.size() and dsts.size() should coincide.");
+
+  if (do_expensive_check) {
+    auto pair_first  = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+    auto num_invalid = thrust::count_if(
+      handle.get_thrust_policy(),
+      pair_first,
+      pair_first + srcs.size(),
+      [num_vertices = index.number_of_vertices] __device__(auto pair) {
+        return !is_valid_vertex(num_vertices, thrust::get<0>(pair)) ||
+               !is_valid_vertex(num_vertices, thrust::get<1>(pair));
+      });
+    CUGRAPH_EXPECTS(num_invalid == 0,
+                    "Invalid input argument: srcs or dsts have invalid vertex IDs.");
+  }
+
+  rmm::device_uvector<weight_t> lower_bounds(srcs.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> upper_bounds(srcs.size(), handle.get_stream());
+
+  // the distances to the landmarks are the distances from the landmarks if the graph is symmetric
+  auto distances_from   = index.distances_from_landmarks.data();
+  auto distances_to     = index.distances_to_landmarks ? (*index.distances_to_landmarks).data()
+                                                       : distances_from;
+  auto has_distances_to = index.is_symmetric || index.distances_to_landmarks.has_value();
+
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  thrust::transform(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + srcs.size(),
+    thrust::make_zip_iterator(thrust::make_tuple(lower_bounds.begin(), upper_bounds.begin())),
+    detail::landmark_distance_bounds_t<vertex_t, weight_t>{
+      distances_from, distances_to, has_distances_to, index.landmarks.size()});
+
+  return std::make_tuple(std::move(lower_bounds), std::move(upper_bounds));
+}
+
+template <typename vertex_t, typename weight_t>
+void save_landmark_distance_index(raft::handle_t const& handle,
+                                  landmark_distance_index_t<vertex_t, weight_t> const& index,
+                                  std::string const& file_path)
+{
+  detail::landmark_distance_index_header_t header{};
+  std::memcpy(header.magic, detail::landmark_distance_index_magic, sizeof(header.magic));
+  header.version = detail::landmark_distance_index_version;
+  header.flags = index.is_symmetric ? detail::landmark_distance_index_symmetric_flag : uint32_t{0};
+  if (index.distances_to_landmarks) {
+    header.flags |= detail::landmark_distance_index_distances_to_flag;
+  }
+  header.vertex_size   = sizeof(vertex_t);
+  header.weight_size   = sizeof(weight_t);
+  header.num_vertices  = static_cast<uint64_t>(index.number_of_vertices);
+  header.num_landmarks = index.landmarks.size();
+
+  std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+  CUGRAPH_EXPECTS(file.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+
+  size_t offset{0};
+  detail::write_landmark_distance_index_bytes(file, offset, &header, sizeof(header));
+  detail::write_landmark_distance_index_section(handle, file, offset, index.landmarks);
+  detail::write_landmark_distance_index_section(
+    handle, file, offset, index.distances_from_landmarks);
+  if (index.distances_to_landmarks) {
+    detail::write_landmark_distance_index_section(
+      handle, file, offset, *index.distances_to_landmarks);
+  }
+
+  file.close();
+  CUGRAPH_EXPECTS(!file.fail(), "Failed to close a landmark distance index file.");
+}
+
+template <typename vertex_t, typename weight_t>
+landmark_distance_index_t<vertex_t, weight_t> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  CUGRAPH_EXPECTS(file.is_open(), "Invalid input argument: failed to open %s.", file_path.c_str());
+
+  detail::landmark_distance_index_header_t header{};
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  CUGRAPH_EXPECTS(file.good() && (std::memcmp(header.magic,
+                                              detail::landmark_distance_index_magic,
+                                              sizeof(header.magic)) == 0),
+                  "Invalid input argument: %s is not a landmark distance index file.",
+                  file_path.c_str());
+  CUGRAPH_EXPECTS(header.version == detail::landmark_distance_index_version,
+                  "Invalid input argument: unsupported landmark distance index file version.");
+  CUGRAPH_EXPECTS(
+    (header.vertex_size == sizeof(vertex_t)) && (header.weight_size == sizeof(weight_t)),
+    "Invalid input argument: vertex_t or weight_t size does not match with the file.");
+
+  size_t offset{sizeof(header)};
+  auto num_elements = header.num_vertices * header.num_landmarks;
+  auto landmarks    = detail::read_landmark_distance_index_section<vertex_t>(
+    handle, file, offset, header.num_landmarks);
+  auto distances_from_landmarks =
+    detail::read_landmark_distance_index_section<weight_t>(handle, file, offset, num_elements);
+  std::optional<rmm::device_uvector<weight_t>> distances_to_landmarks{std::nullopt};
+  if (header.flags & detail::landmark_distance_index_distances_to_flag) {
+    distances_to_landmarks =
+      detail::read_landmark_distance_index_section<weight_t>(handle, file, offset, num_elements);
+  }
+
+  return landmark_distance_index_t<vertex_t, weight_t>{
+    static_cast<vertex_t>(header.num_vertices),
+    (header.flags & detail::landmark_distance_index_symmetric_flag) != 0,
+    std::move(landmarks),
+    std::move(distances_from_landmarks),
+    std::move(distances_to_landmarks)};
+}
+
+}  // namespace cugraph
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/landmark_distance_oracle_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template landmark_distance_index_t<int32_t, float> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template landmark_distance_index_t<int32_t, double> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template landmark_distance_index_t<int32_t, float> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template landmark_distance_index_t<int32_t, double> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template landmark_distance_index_t<int64_t, float> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template landmark_distance_index_t<int64_t, double> build_landmark_distance_index(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  size_t num_landmarks,
+  landmark_selection_t selection,
+  raft::random::RngState& rng_state,
+  bool bidirectional,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<float>, rmm::device_uvector<float>>
+landmark_distance_bounds(raft::handle_t const& handle,
+                         landmark_distance_index_t<int32_t, float> const& index,
+                         raft::device_span<int32_t const> srcs,
+                         raft::device_span<int32_t const> dsts,
+                         bool do_expensive_check);
+
+template void save_landmark_distance_index(raft::handle_t const& handle,
+                                           landmark_distance_index_t<int32_t, float> const& index,
+                                           std::string const& file_path);
+
+template landmark_distance_index_t<int32_t, float> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path);
+
+template std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>>
+landmark_distance_bounds(raft::handle_t const& handle,
+                         landmark_distance_index_t<int32_t, double> const& index,
+                         raft::device_span<int32_t const> srcs,
+                         raft::device_span<int32_t const> dsts,
+                         bool do_expensive_check);
+
+template void save_landmark_distance_index(raft::handle_t const& handle,
+                                           landmark_distance_index_t<int32_t, double> const& index,
+                                           std::string const& file_path);
+
+template landmark_distance_index_t<int32_t, double> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path);
+
+template std::tuple<rmm::device_uvector<float>, rmm::device_uvector<float>>
+landmark_distance_bounds(raft::handle_t const& handle,
+                         landmark_distance_index_t<int64_t, float> const& index,
+                         raft::device_span<int64_t const> srcs,
+                         raft::device_span<int64_t const> dsts,
+                         bool do_expensive_check);
+
+template void save_landmark_distance_index(raft::handle_t const& handle,
+                                           landmark_distance_index_t<int64_t, float> const& index,
+                                           std::string const& file_path);
+
+template landmark_distance_index_t<int64_t, float> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path);
+
+template std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>>
+landmark_distance_bounds(raft::handle_t const& handle,
+                         landmark_distance_index_t<int64_t, double> const& index,
+                         raft::device_span<int64_t const> srcs,
+                         raft::device_span<int64_t const> dsts,
+                         bool do_expensive_check);
+
+template void save_landmark_distance_index(raft::handle_t const& handle,
+                                           landmark_distance_index_t<int64_t, double> const& index,
+                                           std::string const& file_path);
+
+template landmark_distance_index_t<int64_t, double> load_landmark_distance_index(
+  raft::handle_t const& handle, std::string const& file_path);
+
+}  // namespace cugraph
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_edge_src_dst_property.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/core/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace {
+
+using ms_bfs_mask_t = uint64_t;  // bit i is set for the i'th source of the current batch
+
+static_assert(sizeof(ms_bfs_mask_t) == sizeof(unsigned long long int));
+
+// push the frontier bits of the source vertex to the destination vertex
+template <typename vertex_t, bool multi_gpu>
+struct ms_bfs_e_op_t {
+  ms_bfs_mask_t const* frontier_masks{nullptr};  // relevant only if multi_gpu is false
+  ms_bfs_mask_t const* visited_masks{
+    nullptr};  // relevant only if multi_gpu is false (filtering the already visited bits here
+               // reduces the number of values to reduce, this requires destination property values
+               // in multi-GPU)
+
+  template <typename SrcValue>
+  __device__ thrust::optional<ms_bfs_mask_t> operator()(vertex_t src,
+                                                        vertex_t dst,
+                                                        SrcValue src_frontier_mask,
+                                                        thrust::nullopt_t,
+                                                        thrust::nullopt_t) const
+  {
+    ms_bfs_mask_t mask{};
+    if constexpr (multi_gpu) {
+      mask = src_frontier_mask;
+    } else {
+      mask = *(frontier_masks + src) & ~(*(visited_masks + dst));
+    }
+    return mask != ms_bfs_mask_t{0} ? thrust::optional<ms_bfs_mask_t>{mask} : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t, bool multi_gpu>
+struct ms_bfs_is_local_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return vertex_partition.in_local_vertex_partition_range_nocheck(v);
+  }
+};
+
+// set the source bits (the i'th source of the batch sets the i'th bit)
+template <typename vertex_t, bool multi_gpu>
+struct ms_bfs_init_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+  vertex_t const* batch_sources{nullptr};
+  ms_bfs_mask_t* visited_masks{nullptr};
+  ms_bfs_mask_t* frontier_masks{nullptr};
+  vertex_t* batch_distances{nullptr};
+  size_t num_columns{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v = *(batch_sources + i);
+    if (vertex_partition.in_local_vertex_partition_range_nocheck(v)) {
+      auto v_offset = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+      auto mask     = static_cast<unsigned long long int>(ms_bfs_mask_t{1} << i);
+      // atomics as duplicate sources in a batch set different bits of the same vertex
+      atomicOr(reinterpret_cast<unsigned long long int*>(visited_masks + v_offset), mask);
+      atomicOr(reinterpret_cast<unsigned long long int*>(frontier_masks + v_offset), mask);
+      *(batch_distances + i * num_columns + v_offset) = vertex_t{0};
+    }
+  }
+};
+
+// keep only the bits not visited yet, and set the distances for the newly visited bits (the
+// reduced destination vertices are unique, so no atomics are necessary)
+template <typename vertex_t>
+struct ms_bfs_update_t {
+  vertex_t local_vertex_partition_range_first{};
+  ms_bfs_mask_t* visited_masks{nullptr};
+  ms_bfs_mask_t* frontier_masks{nullptr};
+  vertex_t* batch_distances{nullptr};
+  size_t num_columns{0};
+  vertex_t depth{};
+
+  __device__ void operator()(thrust::tuple<vertex_t, ms_bfs_mask_t> pair) const
+  {
+    auto v_offset = thrust::get<0>(pair) - local_vertex_partition_range_first;
+    auto new_mask = thrust::get<1>(pair) & ~(*(visited_masks + v_offset));
+    *(visited_masks + v_offset) |= new_mask;
+    *(frontier_masks + v_offset) = new_mask;
+    while (new_mask != ms_bfs_mask_t{0}) {
+      auto i = static_cast<size_t>(__ffsll(static_cast<long long int>(new_mask)) - 1);
+      *(batch_distances + i * num_columns + v_offset) = depth;
+      new_mask &= new_mask - 1;
+    }
+  }
+};
+
+template <typename vertex_t>
+struct ms_bfs_is_not_in_frontier_t {
+  vertex_t local_vertex_partition_range_first{};
+  ms_bfs_mask_t const* frontier_masks{nullptr};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return *(frontier_masks + (v - local_vertex_partition_range_first)) == ms_bfs_mask_t{0};
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+void multi_source_bfs(raft::handle_t const& handle,
+                      GraphViewType const& push_graph_view,
+                      raft::device_span<typename GraphViewType::vertex_type const> sources,
+                      typename GraphViewType::vertex_type* distances,
+                      typename GraphViewType::vertex_type depth_limit,
+                      bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  constexpr size_t batch_size = sizeof(ms_bfs_mask_t) * 8;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((sources.size() == 0) || (distances != nullptr),
+                  "Invalid input argument: distances cannot be null.");
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       sources.begin(),
+                       sources.end(),
+                       [num_vertices = push_graph_view.number_of_vertices()] __device__(auto val) {
+                         return !is_valid_vertex(num_vertices, val);
+                       });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& comm = handle.get_comms();
+      CUGRAPH_EXPECTS(
+        host_scalar_allreduce(comm, sources.size(), raft::comms::op_t::MIN, handle.get_stream()) ==
+          host_scalar_allreduce(comm, sources.size(), raft::comms::op_t::MAX, handle.get_stream()),
+        "Invalid input argument: every GPU should pass the same sources.");
+    }
+  }
+
+  auto const num_columns = static_cast<size_t>(push_graph_view.local_vertex_partition_range_size());
+  if (sources.size() == 0) { return; }
+
+  // 2. initialize distances
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  thrust::fill(handle.get_thrust_policy(),
+               distances,
+               distances + sources.size() * num_columns,
+               invalid_distance);
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.local_vertex_partition_view());
+
+  rmm::device_uvector<ms_bfs_mask_t> visited_masks(num_columns, handle.get_stream());
+  rmm::device_uvector<ms_bfs_mask_t> frontier_masks(num_columns, handle.get_stream());
+  auto src_frontier_masks =
+    GraphViewType::is_multi_gpu
+      ? edge_src_property_t<GraphViewType, ms_bfs_mask_t>(handle, push_graph_view)
+      : edge_src_property_t<GraphViewType, ms_bfs_mask_t>(
+          handle);  // relevant only if GraphViewType::is_multi_gpu is true
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  // 3. process the sources in batches, every adjacency list scan is shared by all the sources in
+  // the batch reaching the vertex at the same depth
+
+  for (size_t batch_first = 0; batch_first < sources.size(); batch_first += batch_size) {
+    auto this_batch_size = std::min(batch_size, sources.size() - batch_first);
+    auto batch_sources   = sources.data() + batch_first;
+    auto batch_distances = distances + batch_first * num_columns;
+
+    // 3-1. initialize the frontier
+
+    thrust::fill(
+      handle.get_thrust_policy(), visited_masks.begin(), visited_masks.end(), ms_bfs_mask_t{0});
+    thrust::fill(
+      handle.get_thrust_policy(), frontier_masks.begin(), frontier_masks.end(), ms_bfs_mask_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(this_batch_size),
+                     ms_bfs_init_t<vertex_t, GraphViewType::is_multi_gpu>{vertex_partition,
+                                                                          batch_sources,
+                                                                          visited_masks.data(),
+                                                                          frontier_masks.data(),
+                                                                          batch_distances,
+                                                                          num_columns});
+
+    vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(
+      handle, num_buckets);
+    {
+      rmm::device_uvector<vertex_t> local_batch_sources(this_batch_size, handle.get_stream());
+      auto last = thrust::copy_if(
+        handle.get_thrust_policy(),
+        batch_sources,
+        batch_sources + this_batch_size,
+        local_batch_sources.begin(),
+        ms_bfs_is_local_t<vertex_t, GraphViewType::is_multi_gpu>{vertex_partition});
+      local_batch_sources.resize(thrust::distance(local_batch_sources.begin(), last),
+                                 handle.get_stream());
+      vertex_frontier.bucket(bucket_idx_cur)
+        .insert(local_batch_sources.begin(), local_batch_sources.end());
+    }
+
+    // 3-2. BFS iteration
+
+    vertex_t depth{0};
+    while ((depth < depth_limit) && (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0)) {
+      if constexpr (GraphViewType::is_multi_gpu) {
+        update_edge_src_property(handle,
+                                 push_graph_view,
+                                 vertex_frontier.bucket(bucket_idx_cur).begin(),
+                                 vertex_frontier.bucket(bucket_idx_cur).end(),
+                                 frontier_masks.begin(),
+                                 src_frontier_masks);
+      }
+
+      rmm::device_uvector<vertex_t> new_frontier_vertex_buffer(0, handle.get_stream());
+      rmm::device_uvector<ms_bfs_mask_t> new_frontier_mask_buffer(0, handle.get_stream());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        std::tie(new_frontier_vertex_buffer, new_frontier_mask_buffer) =
+          transform_reduce_v_frontier_outgoing_e_by_dst(
+            handle,
+            push_graph_view,
+            vertex_frontier.bucket(bucket_idx_cur),
+            src_frontier_masks.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_dummy_property_t{}.view(),
+            ms_bfs_e_op_t<vertex_t, GraphViewType::is_multi_gpu>{},
+            reduce_op::bitwise_or<ms_bfs_mask_t>());
+      } else {
+        std::tie(new_frontier_vertex_buffer, new_frontier_mask_buffer) =
+          transform_reduce_v_frontier_outgoing_e_by_dst(
+            handle,
+            push_graph_view,
+            vertex_frontier.bucket(bucket_idx_cur),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_dummy_property_t{}.view(),
+            ms_bfs_e_op_t<vertex_t, GraphViewType::is_multi_gpu>{frontier_masks.data(),
+                                                                 visited_masks.data()},
+            reduce_op::bitwise_or<ms_bfs_mask_t>());
+      }
+
+      ++depth;
+
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(new_frontier_vertex_buffer.begin(), new_frontier_mask_buffer.begin()));
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        pair_first,
+        pair_first + new_frontier_vertex_buffer.size(),
+        ms_bfs_update_t<vertex_t>{push_graph_view.local_vertex_partition_range_first(),
+                                  visited_masks.data(),
+                                  frontier_masks.data(),
+                                  batch_distances,
+                                  num_columns,
+                                  depth});
+      new_frontier_vertex_buffer.resize(
+        thrust::distance(
+          new_frontier_vertex_buffer.begin(),
+          thrust::remove_if(handle.get_thrust_policy(),
+                            new_frontier_vertex_buffer.begin(),
+                            new_frontier_vertex_buffer.end(),
+                            ms_bfs_is_not_in_frontier_t<vertex_t>{
+                              push_graph_view.local_vertex_partition_range_first(),
+                              frontier_masks.data()})),
+        handle.get_stream());
+
+      vertex_frontier.bucket(bucket_idx_cur).clear();
+      vertex_frontier.bucket(bucket_idx_cur)
+        .insert(new_frontier_vertex_buffer.begin(), new_frontier_vertex_buffer.end());
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void multi_source_bfs(raft::handle_t const& handle,
+                      graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                      raft::device_span<vertex_t const> sources,
+                      vertex_t* distances,
+                      vertex_t depth_limit,
+                      bool do_expensive_check)
+{
+  detail::multi_source_bfs(handle, graph_view, sources, distances, depth_limit, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <traversal/sssp_impl.cuh>
+
+#include <prims/count_if_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_e.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <raft/util/device_atomics.cuh>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/partition.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+using ms_sssp_mask_t = uint64_t;  // bit i is set for the i'th source of the current tile
+
+static_assert(sizeof(ms_sssp_mask_t) == sizeof(unsigned long long int));
+
+__device__ inline size_t ms_sssp_lowest_bit(ms_sssp_mask_t mask)
+{
+  return static_cast<size_t>(__ffsll(static_cast<long long int>(mask)) - 1);
+}
+
+// relax an edge for every source (of the tile) whose distance to the edge source has changed
+template <typename vertex_t, typename weight_t>
+struct ms_sssp_e_op_t {
+  ms_sssp_mask_t const* active_masks{nullptr};
+  ms_sssp_mask_t* pending_masks{nullptr};
+  weight_t* distances{nullptr};
+  size_t num_sources{0};
+  size_t tile_first{0};
+  weight_t cutoff{};
+
+  __device__ thrust::optional<vertex_t> operator()(
+    vertex_t src, vertex_t dst, thrust::nullopt_t, thrust::nullopt_t, weight_t w) const
+  {
+    auto src_distances = distances + static_cast<size_t>(src) * num_sources + tile_first;
+    auto dst_distances = distances + static_cast<size_t>(dst) * num_sources + tile_first;
+    auto mask          = *(active_masks + src);
+    ms_sssp_mask_t updated{0};
+    while (mask != ms_sssp_mask_t{0}) {
+      auto i        = ms_sssp_lowest_bit(mask);
+      auto new_dist = *(src_distances + i) + w;
+      if ((new_dist < cutoff) && (new_dist < *(dst_distances + i))) {
+        if (atomicMin(dst_distances + i, new_dist) > new_dist) {
+          updated |= ms_sssp_mask_t{1} << i;
+        }
+      }
+      mask &= mask - 1;
+    }
+    if (updated != ms_sssp_mask_t{0}) {
+      atomicOr(reinterpret_cast<unsigned long long int*>(pending_masks + dst),
+               static_cast<unsigned long long int>(updated));
+      return dst;
+    } else {
+      return thrust::nullopt;
+    }
+  }
+};
+
+// set the source bits (the i'th source of the tile sets the i'th bit)
+template <typename vertex_t, typename weight_t>
+struct ms_sssp_init_t {
+  vertex_t const* tile_sources{nullptr};
+  ms_sssp_mask_t* pending_masks{nullptr};
+  weight_t* distances{nullptr};
+  size_t num_sources{0};
+  size_t tile_first{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v = *(tile_sources + i);
+    atomicOr(reinterpret_cast<unsigned long long int*>(pending_masks + v),
+             static_cast<unsigned long long int>(ms_sssp_mask_t{1} << i));
+    *(distances + static_cast<size_t>(v) * num_sources + tile_first + i) = weight_t{0.0};
+  }
+};
+
+// move the pending bits of a frontier vertex to its active bits (new bits may be set while the
+// active bits are being relaxed)
+struct ms_sssp_activate_t {
+  ms_sssp_mask_t* active_masks{nullptr};
+  ms_sssp_mask_t* pending_masks{nullptr};
+
+  template <typename vertex_t>
+  __device__ void operator()(vertex_t v) const
+  {
+    *(active_masks + v)  = *(pending_masks + v);
+    *(pending_masks + v) = ms_sssp_mask_t{0};
+  }
+};
+
+// a vertex is near if the distance for any pending bit is below the threshold
+template <typename vertex_t, typename weight_t>
+struct ms_sssp_is_near_t {
+  ms_sssp_mask_t const* pending_masks{nullptr};
+  weight_t const* distances{nullptr};
+  size_t num_sources{0};
+  size_t tile_first{0};
+  weight_t near_far_threshold{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    auto v_distances = distances + static_cast<size_t>(v) * num_sources + tile_first;
+    auto mask        = *(pending_masks + v);
+    while (mask != ms_sssp_mask_t{0}) {
+      if (*(v_distances + ms_sssp_lowest_bit(mask)) < near_far_threshold) { return true; }
+      mask &= mask - 1;
+    }
+    return false;
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct ms_sssp_split_far_t {
+  ms_sssp_is_near_t<vertex_t, weight_t> is_near{};
+  size_t bucket_idx_near{};
+  size_t bucket_idx_far{};
+
+  __device__ thrust::optional<size_t> operator()(vertex_t v) const
+  {
+    if (*(is_near.pending_masks + v) == ms_sssp_mask_t{0}) {  // already relaxed as a near vertex
+      return thrust::nullopt;
+    }
+    return thrust::optional<size_t>{is_near(v) ? bucket_idx_near : bucket_idx_far};
+  }
+};
+
+template <typename vertex_t>
+__device__ vertex_t ms_sssp_atomic_cas(vertex_t* address, vertex_t compare, vertex_t val)
+{
+  if constexpr (sizeof(vertex_t) == sizeof(unsigned int)) {
+    return static_cast<vertex_t>(atomicCAS(reinterpret_cast<unsigned int*>(address),
+                                           static_cast<unsigned int>(compare),
+                                           static_cast<unsigned int>(val)));
+  } else {
+    static_assert(sizeof(vertex_t) == sizeof(unsigned long long int));
+    return static_cast<vertex_t>(atomicCAS(reinterpret_cast<unsigned long long int*>(address),
+                                           static_cast<unsigned long long int>(compare),
+                                           static_cast<unsigned long long int>(val)));
+  }
+}
+
+// build the predecessor tree by a breadth-first traversal (from the sources of the tile) of the
+// tight edges (dist(u) + w(u, v) == dist(v), evaluated exactly as in the relaxation). A vertex is
+// claimed (with atomicCAS) once, at the first level reaching it, so the predecessors form a tree
+// even with zero-weight cycles or when dist(u) + w rounds to dist(v) for both u->v and v->u.
+template <typename vertex_t, typename weight_t>
+struct ms_sssp_tree_e_op_t {
+  ms_sssp_mask_t const* active_masks{nullptr};
+  ms_sssp_mask_t* pending_masks{nullptr};
+  vertex_t const* tile_sources{nullptr};
+  weight_t const* distances{nullptr};
+  vertex_t* predecessors{nullptr};
+  size_t num_sources{0};
+  size_t tile_first{0};
+
+  __device__ thrust::optional<vertex_t> operator()(
+    vertex_t src, vertex_t dst, thrust::nullopt_t, thrust::nullopt_t, weight_t w) const
+  {
+    auto src_offset = static_cast<size_t>(src) * num_sources + tile_first;
+    auto dst_offset = static_cast<size_t>(dst) * num_sources + tile_first;
+    auto mask       = *(active_masks + src);
+    ms_sssp_mask_t claimed{0};
+    while (mask != ms_sssp_mask_t{0}) {
+      auto i = ms_sssp_lowest_bit(mask);
+      if ((dst != *(tile_sources + i)) &&
+          (*(distances + src_offset + i) + w == *(distances + dst_offset + i)) &&
+          (ms_sssp_atomic_cas(predecessors + dst_offset + i,
+                              invalid_vertex_id<vertex_t>::value,
+                              src) == invalid_vertex_id<vertex_t>::value)) {
+        claimed |= ms_sssp_mask_t{1} << i;
+      }
+      mask &= mask - 1;
+    }
+    if (claimed != ms_sssp_mask_t{0}) {
+      atomicOr(reinterpret_cast<unsigned long long int*>(pending_masks + dst),
+               static_cast<unsigned long long int>(claimed));
+      return dst;
+    } else {
+      return thrust::nullopt;
+    }
+  }
+};
+
+struct ms_sssp_column_index_t {
+  size_t num_sources{0};
+  size_t column{0};
+
+  __device__ size_t operator()(size_t i) const { return i * num_sources + column; }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename weight_t>
+void multi_source_sssp(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
+  raft::device_span<typename GraphViewType::vertex_type const> sources,
+  weight_t* distances,
+  typename GraphViewType::vertex_type* predecessors,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  constexpr size_t tile_size = sizeof(ms_sssp_mask_t) * 8;
+
+  auto const num_vertices = push_graph_view.number_of_vertices();
+  auto const num_edges    = push_graph_view.number_of_edges();
+  auto const num_sources  = sources.size();
+  auto const num_rows =
+    static_cast<size_t>(push_graph_view.local_vertex_partition_range_size());
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_sources == 0) || (distances != nullptr),
+                  "Invalid input argument: distances cannot be null.");
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices = thrust::count_if(
+      handle.get_thrust_policy(),
+      sources.begin(),
+      sources.end(),
+      [num_vertices] __device__(auto val) { return !is_valid_vertex(num_vertices, val); });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 push_graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input edge weights should have non-negative values.");
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& comm = handle.get_comms();
+      CUGRAPH_EXPECTS(
+        host_scalar_allreduce(comm, num_sources, raft::comms::op_t::MIN, handle.get_stream()) ==
+          host_scalar_allreduce(comm, num_sources, raft::comms::op_t::MAX, handle.get_stream()),
+        "Invalid input argument: every GPU should pass the same sources.");
+    }
+  }
+
+  if ((num_vertices == 0) || (num_sources == 0)) { return; }
+
+  // 2. multi-GPU: one source at a time
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<weight_t> tmp_distances(num_rows, handle.get_stream());
+    rmm::device_uvector<vertex_t> tmp_predecessors(predecessors != nullptr ? num_rows : size_t{0},
+                                                   handle.get_stream());
+    std::vector<vertex_t> h_sources(num_sources);
+    raft::update_host(h_sources.data(), sources.data(), num_sources, handle.get_stream());
+    handle.sync_stream();
+    for (size_t i = 0; i < num_sources; ++i) {
+      auto column_index_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}), ms_sssp_column_index_t{num_sources, i});
+      if (predecessors != nullptr) {
+        detail::sssp(handle,
+                     push_graph_view,
+                     edge_weight_view,
+                     tmp_distances.data(),
+                     tmp_predecessors.data(),
+                     h_sources[i],
+                     cutoff,
+                     false,
+                     sssp_method_t::NEAR_FAR,
+                     std::optional<weight_t>{std::nullopt});
+        thrust::scatter(handle.get_thrust_policy(),
+                        tmp_predecessors.begin(),
+                        tmp_predecessors.end(),
+                        column_index_first,
+                        predecessors);
+      } else {
+        detail::sssp(handle,
+                     push_graph_view,
+                     edge_weight_view,
+                     tmp_distances.data(),
+                     thrust::make_discard_iterator(),
+                     h_sources[i],
+                     cutoff,
+                     false,
+                     sssp_method_t::NEAR_FAR,
+                     std::optional<weight_t>{std::nullopt});
+      }
+      thrust::scatter(handle.get_thrust_policy(),
+                      tmp_distances.begin(),
+                      tmp_distances.end(),
+                      column_index_first,
+                      distances);
+    }
+    return;
+  }
+
+  // 3. initialize distances and predecessors
+
+  thrust::fill(handle.get_thrust_policy(),
+               distances,
+               distances + num_rows * num_sources,
+               std::numeric_limits<weight_t>::max());
+  if (predecessors != nullptr) {
+    thrust::fill(handle.get_thrust_policy(),
+                 predecessors,
+                 predecessors + num_rows * num_sources,
+                 invalid_vertex_id<vertex_t>::value);
+  }
+
+  if (num_edges == 0) {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_sources),
+                     [sources = sources.data(), distances, num_sources] __device__(size_t i) {
+                       *(distances + static_cast<size_t>(sources[i]) * num_sources + i) =
+                         weight_t{0.0};
+                     });
+    return;
+  }
+
+  // 4. compute the near-far threshold increment (identical to the Near-Far method in sssp)
+
+  weight_t average_vertex_degree{0.0};
+  weight_t average_edge_weight{0.0};
+  thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
+    handle,
+    push_graph_view,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_dummy_property_t{}.view(),
+    edge_weight_view,
+    [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) {
+      return thrust::make_tuple(weight_t{1.0}, w);
+    },
+    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
+  average_vertex_degree /= static_cast<weight_t>(num_vertices);
+  average_edge_weight /= static_cast<weight_t>(num_edges);
+  auto delta =
+    (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+
+  // 5. process the sources in tiles sharing a single frontier
+
+  constexpr size_t bucket_idx_cur_near  = 0;
+  constexpr size_t bucket_idx_next_near = 1;
+  constexpr size_t bucket_idx_far       = 2;
+  constexpr size_t num_buckets          = 3;
+
+  rmm::device_uvector<ms_sssp_mask_t> active_masks(num_rows, handle.get_stream());
+  rmm::device_uvector<ms_sssp_mask_t> pending_masks(num_rows, handle.get_stream());
+  rmm::device_uvector<vertex_t> unique_tile_sources(tile_size, handle.get_stream());
+
+  for (size_t tile_first = 0; tile_first < num_sources; tile_first += tile_size) {
+    auto this_tile_size = std::min(tile_size, num_sources - tile_first);
+    auto tile_sources   = sources.data() + tile_first;
+
+    thrust::fill(
+      handle.get_thrust_policy(), pending_masks.begin(), pending_masks.end(), ms_sssp_mask_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(this_tile_size),
+                     ms_sssp_init_t<vertex_t, weight_t>{
+                       tile_sources, pending_masks.data(), distances, num_sources, tile_first});
+
+    // sources may repeat within a tile, the frontier buckets store sorted unique vertices
+    thrust::copy(handle.get_thrust_policy(),
+                 tile_sources,
+                 tile_sources + this_tile_size,
+                 unique_tile_sources.begin());
+    thrust::sort(handle.get_thrust_policy(),
+                 unique_tile_sources.begin(),
+                 unique_tile_sources.begin() + this_tile_size);
+    auto unique_last = thrust::unique(handle.get_thrust_policy(),
+                                      unique_tile_sources.begin(),
+                                      unique_tile_sources.begin() + this_tile_size);
+
+    vertex_frontier_t<vertex_t, void, false, true> vertex_frontier(handle, num_buckets);
+    vertex_frontier.bucket(bucket_idx_cur_near).insert(unique_tile_sources.begin(), unique_last);
+
+    auto near_far_threshold = delta;
+    while (true) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       vertex_frontier.bucket(bucket_idx_cur_near).begin(),
+                       vertex_frontier.bucket(bucket_idx_cur_near).end(),
+                       ms_sssp_activate_t{active_masks.data(), pending_masks.data()});
+
+      auto new_frontier_vertex_buffer = transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        push_graph_view,
+        vertex_frontier.bucket(bucket_idx_cur_near),
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_dummy_property_t{}.view(),
+        edge_weight_view,
+        ms_sssp_e_op_t<vertex_t, weight_t>{active_masks.data(),
+                                           pending_masks.data(),
+                                           distances,
+                                           num_sources,
+                                           tile_first,
+                                           cutoff},
+        reduce_op::null{});
+
+      auto is_near = ms_sssp_is_near_t<vertex_t, weight_t>{
+        pending_masks.data(), distances, num_sources, tile_first, near_far_threshold};
+      auto far_first = thrust::stable_partition(handle.get_thrust_policy(),
+                                                new_frontier_vertex_buffer.begin(),
+                                                new_frontier_vertex_buffer.end(),
+                                                is_near);
+      vertex_frontier.bucket(bucket_idx_cur_near).clear();
+      vertex_frontier.bucket(bucket_idx_next_near)
+        .insert(new_frontier_vertex_buffer.begin(), far_first);
+      vertex_frontier.bucket(bucket_idx_far).insert(far_first, new_frontier_vertex_buffer.end());
+
+      if (vertex_frontier.bucket(bucket_idx_next_near).aggregate_size() > 0) {
+        vertex_frontier.swap_buckets(bucket_idx_cur_near, bucket_idx_next_near);
+      } else if (vertex_frontier.bucket(bucket_idx_far).aggregate_size() >
+                 0) {  // near queue is empty, split the far queue
+        size_t near_size{0};
+        size_t far_size{0};
+        while (true) {
+          near_far_threshold += delta;
+          is_near.near_far_threshold = near_far_threshold;
+          vertex_frontier.split_bucket(
+            bucket_idx_far,
+            std::vector<size_t>{bucket_idx_cur_near},
+            ms_sssp_split_far_t<vertex_t, weight_t>{is_near, bucket_idx_cur_near, bucket_idx_far});
+          near_size = vertex_frontier.bucket(bucket_idx_cur_near).aggregate_size();
+          far_size  = vertex_frontier.bucket(bucket_idx_far).aggregate_size();
+          if ((near_size > 0) || (far_size == 0)) { break; }
+        }
+        if ((near_size == 0) && (far_size == 0)) { break; }
+      } else {
+        break;
+      }
+    }
+
+    if (predecessors != nullptr) {
+      thrust::fill(
+        handle.get_thrust_policy(), pending_masks.begin(), pending_masks.end(), ms_sssp_mask_t{0});
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(this_tile_size),
+                       ms_sssp_init_t<vertex_t, weight_t>{
+                         tile_sources, pending_masks.data(), distances, num_sources, tile_first});
+
+      vertex_frontier.bucket(bucket_idx_cur_near).clear();
+      vertex_frontier.bucket(bucket_idx_cur_near).insert(unique_tile_sources.begin(), unique_last);
+
+      while (vertex_frontier.bucket(bucket_idx_cur_near).aggregate_size() > 0) {
+        thrust::for_each(handle.get_thrust_policy(),
+                         vertex_frontier.bucket(bucket_idx_cur_near).begin(),
+                         vertex_frontier.bucket(bucket_idx_cur_near).end(),
+                         ms_sssp_activate_t{active_masks.data(), pending_masks.data()});
+
+        auto new_frontier_vertex_buffer = transform_reduce_v_frontier_outgoing_e_by_dst(
+          handle,
+          push_graph_view,
+          vertex_frontier.bucket(bucket_idx_cur_near),
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
+          edge_weight_view,
+          ms_sssp_tree_e_op_t<vertex_t, weight_t>{active_masks.data(),
+                                                  pending_masks.data(),
+                                                  tile_sources,
+                                                  distances,
+                                                  predecessors,
+                                                  num_sources,
+                                                  tile_first},
+          reduce_op::null{});
+
+        vertex_frontier.bucket(bucket_idx_cur_near).clear();
+        vertex_frontier.bucket(bucket_idx_cur_near)
+          .insert(new_frontier_vertex_buffer.begin(), new_frontier_vertex_buffer.end());
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void multi_source_sssp(raft::handle_t const& handle,
+                       graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                       edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                       raft::device_span<vertex_t const> sources,
+                       weight_t* distances,
+                       vertex_t* predecessors,
+                       weight_t cutoff,
+                       bool do_expensive_check)
+{
+  detail::multi_source_sssp(handle,
+                            graph_view,
+                            edge_weight_view,
+                            sources,
+                            distances,
+                            predecessors,
+                            cutoff,
+                            do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <traversal/multi_source_sssp_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                                edge_property_view_t<int32_t, float const*> edge_weight_view,
+                                raft::device_span<int32_t const> sources,
+                                float* distances,
+                                int32_t* predecessors,
+                                float cutoff,
+                                bool do_expensive_check);
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                                edge_property_view_t<int32_t, double const*> edge_weight_view,
+                                raft::device_span<int32_t const> sources,
+                                double* distances,
+                                int32_t* predecessors,
+                                double cutoff,
+                                bool do_expensive_check);
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+                                edge_property_view_t<int64_t, float const*> edge_weight_view,
+                                raft::device_span<int32_t const> sources,
+                                float* distances,
+                                int32_t* predecessors,
+                                float cutoff,
+                                bool do_expensive_check);
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int32_t, int64_t, false, false> const& graph_view,
+                                edge_property_view_t<int64_t, double const*> edge_weight_view,
+                                raft::device_span<int32_t const> sources,
+                                double* distances,
+                                int32_t* predecessors,
+                                double cutoff,
+                                bool do_expensive_check);
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                                edge_property_view_t<int64_t, float const*> edge_weight_view,
+                                raft::device_span<int64_t const> sources,
+                                float* distances,
+                                int64_t* predecessors,
+                                float cutoff,
+                                bool do_expensive_check);
+
+template void multi_source_sssp(raft::handle_t const& handle,
+                                graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                                edge_property_view_t<int64_t, double const*> edge_weight_view,
+                                raft::device_span<int64_t const> sources,
+                                double* distances,
+                                int64_t* predecessors,
+                                double cutoff,
+                                bool do_expensive_check);
+
+}  // namespace cugraph
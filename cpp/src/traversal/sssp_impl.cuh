@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,19 +28,24 @@
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/util/cudart_utils.hpp>
 
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/reduce.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <limits>
+#include <optional>
 
 namespace cugraph {
 
@@ -71,19 +76,204 @@ struct e_op_t {
   }
 };
 
+// relax only the light (w <= delta) or only the heavy (w > delta) edges
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+struct delta_stepping_e_op_t {
+  e_op_t<vertex_t, weight_t, multi_gpu> e_op{};
+  weight_t delta{};
+  bool light{};
+
+  __device__ thrust::optional<thrust::tuple<weight_t, vertex_t>> operator()(
+    vertex_t src, vertex_t dst, weight_t src_val, thrust::nullopt_t, weight_t w) const
+  {
+    if ((w <= delta) != light) { return thrust::nullopt; }
+    return e_op(src, dst, src_val, thrust::nullopt, w);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct delta_stepping_v_op_t {
+  weight_t bucket_threshold{};
+  size_t bucket_idx_next{};
+  size_t bucket_idx_far{};
+
+  __device__ thrust::tuple<thrust::optional<size_t>,
+                           thrust::optional<thrust::tuple<weight_t, vertex_t>>>
+  operator()(vertex_t v, weight_t v_val, thrust::tuple<weight_t, vertex_t> pushed_val) const
+  {
+    auto new_dist = thrust::get<0>(pushed_val);
+    auto update   = (new_dist < v_val);
+    return thrust::make_tuple(
+      update ? thrust::optional<size_t>{new_dist < bucket_threshold ? bucket_idx_next
+                                                                    : bucket_idx_far}
+             : thrust::nullopt,
+      update ? thrust::optional<thrust::tuple<weight_t, vertex_t>>{pushed_val} : thrust::nullopt);
+  }
+};
+
 }  // namespace
 
 namespace detail {
 
+// implements the delta-stepping method in
+// U. Meyer and P. Sanders, "Delta-stepping: a parallelizable shortest path algorithm," 2003.
+// returns the number of (local) relaxations that improved a tentative distance
 template <typename GraphViewType, typename weight_t, typename PredecessorIterator>
-void sssp(raft::handle_t const& handle,
-          GraphViewType const& push_graph_view,
-          edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
-          weight_t* distances,
-          PredecessorIterator predecessor_first,
-          typename GraphViewType::vertex_type source_vertex,
-          weight_t cutoff,
-          bool do_expensive_check)
+size_t delta_stepping(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
+  weight_t* distances,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type source_vertex,
+  weight_t cutoff,
+  weight_t delta)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  // 1. initialize delta-stepping frontier
+
+  constexpr size_t bucket_idx_cur     = 0;  // the current delta bucket
+  constexpr size_t bucket_idx_next    = 1;  // re-inserted to the current bucket (light edges)
+  constexpr size_t bucket_idx_settled = 2;  // removed from the current bucket in this phase
+  constexpr size_t bucket_idx_far     = 3;  // the following delta buckets
+  constexpr size_t num_buckets        = 4;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
+                                                                                       num_buckets);
+
+  auto edge_src_distances =
+    GraphViewType::is_multi_gpu
+      ? edge_src_property_t<GraphViewType, weight_t>(handle, push_graph_view)
+      : edge_src_property_t<GraphViewType, weight_t>(handle);
+  if (GraphViewType::is_multi_gpu) {
+    fill_edge_src_property(
+      handle, push_graph_view, std::numeric_limits<weight_t>::max(), edge_src_distances);
+  }
+
+  if (push_graph_view.in_local_vertex_partition_range_nocheck(source_vertex)) {
+    vertex_frontier.bucket(bucket_idx_cur).insert(source_vertex);
+  }
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.local_vertex_partition_view());
+
+  // 2. delta-stepping iteration
+
+  size_t num_relaxations{0};
+  auto relax = [&](size_t bucket_idx, bool light, weight_t bucket_threshold) {
+    auto [new_frontier_vertex_buffer, distance_predecessor_buffer] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        push_graph_view,
+        vertex_frontier.bucket(bucket_idx),
+        GraphViewType::is_multi_gpu
+          ? edge_src_distances.view()
+          : detail::edge_major_property_view_t<vertex_t, weight_t const*>(distances),
+        edge_dst_dummy_property_t{}.view(),
+        edge_weight_view,
+        delta_stepping_e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
+          e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
+            vertex_partition, distances, cutoff},
+          delta,
+          light},
+        reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+    num_relaxations += new_frontier_vertex_buffer.size();
+
+    update_v_frontier(
+      handle,
+      push_graph_view,
+      std::move(new_frontier_vertex_buffer),
+      std::move(distance_predecessor_buffer),
+      vertex_frontier,
+      std::vector<size_t>{bucket_idx_next, bucket_idx_far},
+      distances,
+      thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
+      delta_stepping_v_op_t<vertex_t, weight_t>{
+        bucket_threshold, bucket_idx_next, bucket_idx_far});
+  };
+
+  auto bucket_threshold = delta;  // the current bucket covers [bucket_threshold - delta,
+                                  // bucket_threshold)
+  while (true) {
+    // relax the light edges until the current bucket stops changing, a vertex can re-enter the
+    // current bucket multiple times but is relaxed through its heavy edges only once per bucket
+
+    while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+      vertex_frontier.bucket(bucket_idx_settled)
+        .insert(vertex_frontier.bucket(bucket_idx_cur).begin(),
+                vertex_frontier.bucket(bucket_idx_cur).end());
+      if (GraphViewType::is_multi_gpu) {
+        update_edge_src_property(handle,
+                                 push_graph_view,
+                                 vertex_frontier.bucket(bucket_idx_cur).begin(),
+                                 vertex_frontier.bucket(bucket_idx_cur).end(),
+                                 distances,
+                                 edge_src_distances);
+      }
+
+      relax(bucket_idx_cur, true, bucket_threshold);
+
+      vertex_frontier.bucket(bucket_idx_cur).clear();
+      vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+      vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+    }
+
+    // the distances of the settled vertices are final, relax the heavy edges (w > delta, so the
+    // new distances fall in the following buckets)
+
+    if (vertex_frontier.bucket(bucket_idx_settled).aggregate_size() > 0) {
+      relax(bucket_idx_settled, false, bucket_threshold);
+      vertex_frontier.bucket(bucket_idx_settled).clear();
+      vertex_frontier.bucket(bucket_idx_settled).shrink_to_fit();
+    }
+    if (vertex_frontier.bucket(bucket_idx_next).aggregate_size() > 0) {
+      vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+      continue;
+    }
+
+    // move to the next non-empty bucket
+
+    if (vertex_frontier.bucket(bucket_idx_far).aggregate_size() == 0) { break; }
+    size_t cur_size{0};
+    while (true) {
+      auto old_bucket_threshold = bucket_threshold;
+      bucket_threshold += delta;
+      vertex_frontier.split_bucket(
+        bucket_idx_far,
+        std::vector<size_t>{bucket_idx_cur},
+        [vertex_partition, distances, old_bucket_threshold, bucket_threshold] __device__(auto v) {
+          auto dist =
+            *(distances + vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v));
+          return dist >= old_bucket_threshold
+                   ? thrust::optional<size_t>{dist < bucket_threshold ? bucket_idx_cur
+                                                                      : bucket_idx_far}
+                   : thrust::nullopt;
+        });
+      cur_size = vertex_frontier.bucket(bucket_idx_cur).aggregate_size();
+      if ((cur_size > 0) || (vertex_frontier.bucket(bucket_idx_far).aggregate_size() == 0)) {
+        break;
+      }
+    }
+    if (cur_size == 0) { break; }
+  }
+
+  return num_relaxations;
+}
+
+// returns the number of (local) relaxations that improved a tentative distance
+template <typename GraphViewType, typename weight_t, typename PredecessorIterator>
+size_t sssp(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
+  weight_t* distances,
+  PredecessorIterator predecessor_first,
+  typename GraphViewType::vertex_type source_vertex,
+  weight_t cutoff,
+  bool do_expensive_check,
+  sssp_method_t method,
+  std::optional<weight_t> input_delta)
 {
   using vertex_t = typename GraphViewType::vertex_type;
 
@@ -94,7 +284,7 @@ void sssp(raft::handle_t const& handle,
 
   auto const num_vertices = push_graph_view.number_of_vertices();
   auto const num_edges    = push_graph_view.number_of_edges();
-  if (num_vertices == 0) { return; }
+  if (num_vertices == 0) { return size_t{0}; }
 
   // implements the Near-Far Pile method in
   // A. Davidson, S. Baxter, M. Garland, and J. D. Owens, "Work-efficient parallel GPU methods for
@@ -104,6 +294,8 @@ void sssp(raft::handle_t const& handle,
 
   CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(source_vertex),
                   "Invalid input argument: source vertex out-of-range.");
+  CUGRAPH_EXPECTS(!input_delta || (*input_delta > weight_t{0.0}),
+                  "Invalid input argument: delta should be positive.");
 
   if (do_expensive_check) {
     auto num_negative_edge_weights =
@@ -134,7 +326,7 @@ void sssp(raft::handle_t const& handle,
       return thrust::make_tuple(distance, invalid_vertex);
     });
 
-  if (num_edges == 0) { return; }
+  if (num_edges == 0) { return size_t{0}; }
 
   // 3. update delta
 
@@ -152,8 +344,45 @@ void sssp(raft::handle_t const& handle,
     thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
   average_vertex_degree /= static_cast<weight_t>(num_vertices);
   average_edge_weight /= static_cast<weight_t>(num_edges);
-  auto delta =
-    (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+  weight_t delta{};
+  if (input_delta) {
+    delta = *input_delta;
+  } else if (method == sssp_method_t::NEAR_FAR) {
+    delta =
+      (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+  } else {
+    // Meyer & Sanders suggest delta = Theta(max edge weight / max degree), we use the average
+    // degree and cap delta by the average edge weight (so the long tail of a wide weight spread
+    // does not collapse every vertex into a few buckets)
+    auto max_edge_weight    = weight_t{0.0};
+    auto edge_weight_counts = edge_weight_view.edge_counts();
+    for (size_t i = 0; i < edge_weight_counts.size(); ++i) {
+      max_edge_weight = std::max(max_edge_weight,
+                                 thrust::reduce(handle.get_thrust_policy(),
+                                                edge_weight_view.value_firsts()[i],
+                                                edge_weight_view.value_firsts()[i] +
+                                                  edge_weight_counts[i],
+                                                weight_t{0.0},
+                                                thrust::maximum<weight_t>{}));
+    }
+    if constexpr (GraphViewType::is_multi_gpu) {
+      max_edge_weight = host_scalar_allreduce(
+        handle.get_comms(), max_edge_weight, raft::comms::op_t::MAX, handle.get_stream());
+    }
+    delta = std::min(max_edge_weight / average_vertex_degree, average_edge_weight);
+    if (delta <= weight_t{0.0}) { delta = weight_t{1.0}; }  // every edge weight is 0
+  }
+
+  if (method == sssp_method_t::DELTA_STEPPING) {
+    return delta_stepping(handle,
+                          push_graph_view,
+                          edge_weight_view,
+                          distances,
+                          predecessor_first,
+                          source_vertex,
+                          cutoff,
+                          delta);
+  }
 
   // 4. initialize SSSP frontier
 
@@ -180,6 +409,7 @@ void sssp(raft::handle_t const& handle,
     vertex_frontier.bucket(bucket_idx_cur_near).insert(source_vertex);
   }
 
+  size_t num_relaxations{0};
   auto near_far_threshold = delta;
   while (true) {
     if (GraphViewType::is_multi_gpu) {
@@ -207,6 +437,7 @@ void sssp(raft::handle_t const& handle,
         e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
           vertex_partition, distances, cutoff},
         reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+    num_relaxations += new_frontier_vertex_buffer.size();
 
     update_v_frontier(
       handle,
@@ -265,6 +496,8 @@ void sssp(raft::handle_t const& handle,
       break;
     }
   }
+
+  return num_relaxations;
 }
 
 }  // namespace detail
@@ -277,26 +510,42 @@ void sssp(raft::handle_t const& handle,
           vertex_t* predecessors,
           vertex_t source_vertex,
           weight_t cutoff,
-          bool do_expensive_check)
+          bool do_expensive_check,
+          sssp_method_t method,
+          std::optional<weight_t> delta,
+          size_t* num_relaxations)
 {
+  size_t num_local_relaxations{0};
   if (predecessors != nullptr) {
-    detail::sssp(handle,
-                 graph_view,
-                 edge_weight_view,
-                 distances,
-                 predecessors,
-                 source_vertex,
-                 cutoff,
-                 do_expensive_check);
+    num_local_relaxations = detail::sssp(handle,
+                                         graph_view,
+                                         edge_weight_view,
+                                         distances,
+                                         predecessors,
+                                         source_vertex,
+                                         cutoff,
+                                         do_expensive_check,
+                                         method,
+                                         delta);
   } else {
-    detail::sssp(handle,
-                 graph_view,
-                 edge_weight_view,
-                 distances,
-                 thrust::make_discard_iterator(),
-                 source_vertex,
-                 cutoff,
-                 do_expensive_check);
+    num_local_relaxations = detail::sssp(handle,
+                                         graph_view,
+                                         edge_weight_view,
+                                         distances,
+                                         thrust::make_discard_iterator(),
+                                         source_vertex,
+                                         cutoff,
+                                         do_expensive_check,
+                                         method,
+                                         delta);
+  }
+
+  if (num_relaxations != nullptr) {
+    if constexpr (multi_gpu) {
+      num_local_relaxations = host_scalar_allreduce(
+        handle.get_comms(), num_local_relaxations, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    *num_relaxations = num_local_relaxations;
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,7 +26,10 @@ template void sssp(raft::handle_t const& handle,
                    int32_t* predecessors,
                    int32_t source_vertex,
                    float cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<float> delta,
+                   size_t* num_relaxations);
 
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int32_t, false, false> const& graph_view,
@@ -35,7 +38,10 @@ template void sssp(raft::handle_t const& handle,
                    int32_t* predecessors,
                    int32_t source_vertex,
                    double cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<double> delta,
+                   size_t* num_relaxations);
 
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int64_t, false, false> const& graph_view,
@@ -44,7 +50,10 @@ template void sssp(raft::handle_t const& handle,
                    int32_t* predecessors,
                    int32_t source_vertex,
                    float cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<float> delta,
+                   size_t* num_relaxations);
 
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int32_t, int64_t, false, false> const& graph_view,
@@ -53,7 +62,10 @@ template void sssp(raft::handle_t const& handle,
                    int32_t* predecessors,
                    int32_t source_vertex,
                    double cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<double> delta,
+                   size_t* num_relaxations);
 
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
@@ -62,7 +74,10 @@ template void sssp(raft::handle_t const& handle,
                    int64_t* predecessors,
                    int64_t source_vertex,
                    float cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<float> delta,
+                   size_t* num_relaxations);
 
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
@@ -71,6 +86,9 @@ template void sssp(raft::handle_t const& handle,
                    int64_t* predecessors,
                    int64_t source_vertex,
                    double cutoff,
-                   bool do_expensive_check);
+                   bool do_expensive_check,
+                   sssp_method_t method,
+                   std::optional<double> delta,
+                   size_t* num_relaxations);
 
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,7 +36,9 @@ int generic_sssp_test(vertex_t* h_src,
                       size_t num_vertices,
                       size_t num_edges,
                       float cutoff,
-                      bool_t store_transposed)
+                      bool_t store_transposed,
+                      cugraph_sssp_method_t method,
+                      double delta)
 {
   int test_ret_value = 0;
 
@@ -53,7 +55,12 @@ int generic_sssp_test(vertex_t* h_src,
   ret_code = create_test_graph(
     p_handle, h_src, h_dst, h_wgt, num_edges, store_transposed, FALSE, FALSE, &p_graph, &ret_error);
 
-  ret_code = cugraph_sssp(p_handle, p_graph, source, cutoff, TRUE, FALSE, &p_result, &ret_error);
+  if (method == SSSP_METHOD_NEAR_FAR) {
+    ret_code = cugraph_sssp(p_handle, p_graph, source, cutoff, TRUE, FALSE, &p_result, &ret_error);
+  } else {
+    ret_code = cugraph_sssp_with_method(
+      p_handle, p_graph, source, cutoff, method, delta, TRUE, FALSE, &p_result, &ret_error);
+  }
   TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_sssp failed.");
 
   cugraph_type_erased_device_array_view_t* vertices;
@@ -175,6 +182,100 @@ int generic_sssp_test_double(vertex_t* h_src,
   return test_ret_value;
 }
 
+int generic_multi_source_sssp_test(vertex_t* h_src,
+                                   vertex_t* h_dst,
+                                   float* h_wgt,
+                                   vertex_t* h_sources,
+                                   float const* expected_distances,
+                                   vertex_t const* expected_predecessors,
+                                   size_t num_vertices,
+                                   size_t num_edges,
+                                   size_t num_sources,
+                                   float cutoff)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                    = NULL;
+  cugraph_graph_t* p_graph                               = NULL;
+  cugraph_paths_result_t* p_result                       = NULL;
+  cugraph_type_erased_device_array_t* p_sources          = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, h_src, h_dst, h_wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_sources, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)h_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_multi_source_sssp(
+    p_handle, p_graph, p_source_view, cutoff, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_multi_source_sssp failed.");
+
+  cugraph_type_erased_device_array_view_t* vertices;
+  cugraph_type_erased_device_array_view_t* distances;
+  cugraph_type_erased_device_array_view_t* predecessors;
+
+  vertices     = cugraph_paths_result_get_vertices(p_result);
+  distances    = cugraph_paths_result_get_distances(p_result);
+  predecessors = cugraph_paths_result_get_predecessors(p_result);
+
+  vertex_t h_vertices[num_vertices];
+  float h_distances[num_vertices * num_sources];
+  vertex_t h_predecessors[num_vertices * num_sources];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, predecessors, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  // expected values are stored per source, results are stored per vertex
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    for (int j = 0; (j < num_sources) && (test_ret_value == 0); ++j) {
+      TEST_ASSERT(test_ret_value,
+                  nearlyEqual(expected_distances[j * num_vertices + h_vertices[i]],
+                              h_distances[i * num_sources + j],
+                              EPSILON),
+                  "multi-source sssp distances don't match");
+
+      TEST_ASSERT(test_ret_value,
+                  expected_predecessors[j * num_vertices + h_vertices[i]] ==
+                    h_predecessors[i * num_sources + j],
+                  "multi-source sssp predecessors don't match");
+    }
+  }
+
+  cugraph_type_erased_device_array_view_free(vertices);
+  cugraph_type_erased_device_array_view_free(distances);
+  cugraph_type_erased_device_array_view_free(predecessors);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_paths_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
 int test_sssp()
 {
   size_t num_edges    = 8;
@@ -196,7 +297,60 @@ int test_sssp()
                            num_vertices,
                            num_edges,
                            10,
-                           FALSE);
+                           FALSE,
+                           SSSP_METHOD_NEAR_FAR,
+                           0.0);
+}
+
+int test_sssp_delta_stepping()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  float wgt[]                      = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  float expected_distances[]       = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4};
+
+  // delta = 2.0 splits the edges into light and heavy edges
+  return generic_sssp_test(src,
+                           dst,
+                           wgt,
+                           0,
+                           expected_distances,
+                           expected_predecessors,
+                           num_vertices,
+                           num_edges,
+                           10,
+                           FALSE,
+                           SSSP_METHOD_DELTA_STEPPING,
+                           2.0);
+}
+
+int test_sssp_delta_stepping_auto_delta()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  float wgt[]                      = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  float expected_distances[]       = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4};
+
+  return generic_sssp_test(src,
+                           dst,
+                           wgt,
+                           0,
+                           expected_distances,
+                           expected_predecessors,
+                           num_vertices,
+                           num_edges,
+                           10,
+                           FALSE,
+                           SSSP_METHOD_DELTA_STEPPING,
+                           0.0);
 }
 
 int test_sssp_with_transpose()
@@ -212,8 +366,18 @@ int test_sssp_with_transpose()
 
   // Bfs wants store_transposed = FALSE
   //    This call will force cugraph_sssp to transpose the graph
-  return generic_sssp_test(
-    src, dst, wgt, 0, expected_distances, expected_predecessors, num_vertices, num_edges, 10, TRUE);
+  return generic_sssp_test(src,
+                           dst,
+                           wgt,
+                           0,
+                           expected_distances,
+                           expected_predecessors,
+                           num_vertices,
+                           num_edges,
+                           10,
+                           TRUE,
+                           SSSP_METHOD_NEAR_FAR,
+                           0.0);
 }
 
 int test_sssp_with_transpose_double()
@@ -235,11 +399,43 @@ int test_sssp_with_transpose_double()
 
 /******************************************************************************/
 
+int test_multi_source_sssp()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+  size_t num_sources  = 3;
+
+  vertex_t src[]     = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]     = {1, 3, 4, 0, 1, 3, 5, 5};
+  float wgt[]        = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t sources[] = {0, 2, 0};
+
+  // num_sources x num_vertices (a repeated source yields the same results)
+  float expected_distances[] = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f,
+                                5.1f, 3.1f, 0.0f,    4.1f, 4.2f, 7.4f,
+                                0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4, 2, 2, -1, 2, 1, 4, -1, 0, -1, 1, 1, 4};
+
+  return generic_multi_source_sssp_test(src,
+                                        dst,
+                                        wgt,
+                                        sources,
+                                        expected_distances,
+                                        expected_predecessors,
+                                        num_vertices,
+                                        num_edges,
+                                        num_sources,
+                                        10);
+}
+
 int main(int argc, char** argv)
 {
   int result = 0;
   result |= RUN_TEST(test_sssp);
+  result |= RUN_TEST(test_sssp_delta_stepping);
+  result |= RUN_TEST(test_sssp_delta_stepping_auto_delta);
   result |= RUN_TEST(test_sssp_with_transpose);
   result |= RUN_TEST(test_sssp_with_transpose_double);
+  result |= RUN_TEST(test_multi_source_sssp);
   return result;
 }
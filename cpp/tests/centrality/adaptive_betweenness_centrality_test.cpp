@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governin_from_mtxg permissions and
+ * limitations under the License.
+ */
+
+#include <centrality/betweenness_centrality_reference.hpp>
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+struct AdaptiveBetweennessCentrality_Usecase {
+  double epsilon{0.05};
+  double delta{0.1};
+  size_t max_num_samples{std::numeric_limits<size_t>::max()};
+  bool include_endpoints{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_AdaptiveBetweennessCentrality
+  : public ::testing::TestWithParam<
+      std::tuple<AdaptiveBetweennessCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_AdaptiveBetweennessCentrality() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(
+    std::tuple<AdaptiveBetweennessCentrality_Usecase, input_usecase_t> const& param)
+  {
+    constexpr bool renumber           = true;
+    constexpr bool do_expensive_check = false;
+
+    auto [betweenness_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Adaptive betweenness centrality");
+    }
+
+    auto [d_centralities, num_samples, achieved_delta] =
+      cugraph::adaptive_betweenness_centrality(handle,
+                                               graph_view,
+                                               edge_weight_view,
+                                               rng_state,
+                                               static_cast<weight_t>(betweenness_usecase.epsilon),
+                                               static_cast<weight_t>(betweenness_usecase.delta),
+                                               betweenness_usecase.max_num_samples,
+                                               true,
+                                               betweenness_usecase.include_endpoints,
+                                               do_expensive_check);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "# samples: " << num_samples << ", achieved delta: " << achieved_delta
+                << std::endl;
+    }
+
+    ASSERT_TRUE(num_samples <= betweenness_usecase.max_num_samples)
+      << "The number of samples exceeds max_num_samples.";
+    ASSERT_TRUE((achieved_delta <= static_cast<weight_t>(betweenness_usecase.delta)) ||
+                (num_samples == betweenness_usecase.max_num_samples))
+      << "The bound is not met before reaching max_num_samples.";
+
+    if (betweenness_usecase.check_correctness) {
+      auto [h_offsets, h_indices, h_wgt] =
+        cugraph::test::graph_to_host_csr(handle, graph_view, edge_weight_view);
+
+      // exact centralities (every vertex as a source)
+      std::vector<vertex_t> h_seeds(graph_view.number_of_vertices());
+      std::iota(h_seeds.begin(), h_seeds.end(), vertex_t{0});
+
+      auto h_reference_centralities =
+        betweenness_centrality_reference(h_offsets,
+                                         h_indices,
+                                         h_wgt,
+                                         h_seeds,
+                                         betweenness_usecase.include_endpoints,
+                                         !graph_view.is_symmetric(),
+                                         true);
+
+      auto h_centralities = cugraph::test::to_host(handle, d_centralities);
+
+      // the bound may fail with probability achieved_delta, the seed is fixed so this is
+      // deterministic
+      auto threshold_magnitude = 1e-5;
+      for (size_t i = 0; i < h_centralities.size(); ++i) {
+        ASSERT_TRUE(std::abs(h_centralities[i] - h_reference_centralities[i]) <=
+                    betweenness_usecase.epsilon + threshold_magnitude)
+          << "vertex " << i << ": estimate " << h_centralities[i]
+          << " is not within epsilon of the exact centrality " << h_reference_centralities[i]
+          << ".";
+      }
+    }
+  }
+};
+
+using Tests_AdaptiveBetweennessCentrality_File =
+  Tests_AdaptiveBetweennessCentrality<cugraph::test::File_Usecase>;
+using Tests_AdaptiveBetweennessCentrality_Rmat =
+  Tests_AdaptiveBetweennessCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_File, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_Rmat, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_Rmat, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_AdaptiveBetweennessCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.05, 0.1},
+                      AdaptiveBetweennessCentrality_Usecase{0.02, 0.1},
+                      AdaptiveBetweennessCentrality_Usecase{0.05, 0.1, 1000, true},
+                      AdaptiveBetweennessCentrality_Usecase{0.001, 0.1, 100, false, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_AdaptiveBetweennessCentrality_Rmat,
+  // enable correctness checks
+  ::testing::Combine(
+    ::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.05, 0.1},
+                      AdaptiveBetweennessCentrality_Usecase{0.02, 0.01}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_AdaptiveBetweennessCentrality_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.01, 0.1, 10000, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -167,8 +167,15 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(BetweennessCentrality_Usecase{20, false, false, false, true},
                       BetweennessCentrality_Usecase{20, false, false, true, true},
                       BetweennessCentrality_Usecase{20, false, true, false, true},
-                      BetweennessCentrality_Usecase{20, false, true, true, true}),
-    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+                      BetweennessCentrality_Usecase{20, false, true, true, true},
+                      // sources are processed in blocks, cover a single source, a full block and
+                      // a partial trailing block
+                      BetweennessCentrality_Usecase{1, false, false, false, true},
+                      BetweennessCentrality_Usecase{8, false, true, false, true},
+                      BetweennessCentrality_Usecase{9, true, false, false, true},
+                      BetweennessCentrality_Usecase{9, true, true, false, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
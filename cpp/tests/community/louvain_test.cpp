@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
  *
  * NVIDIA CORPORATION and its licensors retain all intellectual property
  * and proprietary rights in and to this software, related documentation
@@ -23,10 +23,14 @@
 
 #include <gtest/gtest.h>
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <vector>
 
 struct Louvain_Usecase {
@@ -152,6 +156,91 @@ class Tests_Louvain
       hr_timer.stop();
       hr_timer.display_and_clear(std::cout);
     }
+
+    if (device_prop.major >= 7) {
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("Louvain (dendrogram spilled to a file)");
+      }
+
+      louvain_with_spilled_dendrogram(graph_view, edge_weight_view, louvain_usecase.max_level_);
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+      }
+    }
+  }
+
+  // every level of a spilled dendrogram should be identical to the level read back from the file
+  // (by a live dendrogram and by a dendrogram re-opened from the file) and to the level computed by
+  // the in-memory louvain() at every flattening depth
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void louvain_with_spilled_dendrogram(
+    cugraph::graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+    std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    size_t max_level)
+  {
+    raft::handle_t handle{};
+
+    auto file_path = (std::filesystem::temp_directory_path() /
+                      ("cugraph_louvain_dendrogram_test_" + std::to_string(::getpid()) + ".bin"))
+                       .string();
+    cugraph::test::temporary_file_guard_t file_guard(file_path);
+
+    auto [dendrogram, modularity] = cugraph::louvain(
+      handle, graph_view, edge_weight_view, file_path, max_level, weight_t{1});
+    auto [in_memory_dendrogram, in_memory_modularity] =
+      cugraph::louvain(handle, graph_view, edge_weight_view, max_level, weight_t{1});
+
+    ASSERT_TRUE(dendrogram->num_levels() > 0);
+    for (size_t level = 0; level + 1 < dendrogram->num_levels(); ++level) {
+      ASSERT_FALSE(dendrogram->is_level_resident(level)) << "completed levels should be spilled.";
+    }
+    ASSERT_TRUE(dendrogram->is_level_resident(dendrogram->current_level()));
+
+    auto reopened_dendrogram = cugraph::Dendrogram<vertex_t>::open_file(file_path);
+    ASSERT_EQ(reopened_dendrogram->num_levels(), dendrogram->num_levels());
+    ASSERT_EQ(in_memory_dendrogram->num_levels(), dendrogram->num_levels());
+    ASSERT_FLOAT_EQ(static_cast<float>(in_memory_modularity), static_cast<float>(modularity));
+
+    rmm::device_uvector<vertex_t> clustering_v(graph_view.local_vertex_partition_range_size(),
+                                               handle.get_stream());
+    rmm::device_uvector<vertex_t> reopened_clustering_v(clustering_v.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> in_memory_clustering_v(clustering_v.size(), handle.get_stream());
+    for (size_t level = 0; level <= dendrogram->num_levels(); ++level) {
+      if (level < dendrogram->num_levels()) {
+        ASSERT_EQ(reopened_dendrogram->get_level_size_nocheck(level),
+                  dendrogram->get_level_size_nocheck(level));
+        ASSERT_EQ(reopened_dendrogram->get_level_first_index_nocheck(level),
+                  dendrogram->get_level_first_index_nocheck(level));
+        ASSERT_EQ(in_memory_dendrogram->get_level_size_nocheck(level),
+                  dendrogram->get_level_size_nocheck(level))
+          << "level " << level << " size does not match with the in-memory dendrogram.";
+        auto h_level =
+          cugraph::test::to_host(handle, dendrogram->read_level(level, handle.get_stream()));
+        auto h_reopened_level = cugraph::test::to_host(
+          handle, reopened_dendrogram->read_level(level, handle.get_stream()));
+        auto h_in_memory_level = cugraph::test::to_host(
+          handle, in_memory_dendrogram->read_level(level, handle.get_stream()));
+        ASSERT_EQ(h_level, h_reopened_level) << "level " << level << " does not match.";
+        ASSERT_EQ(h_level, h_in_memory_level)
+          << "level " << level << " does not match with the in-memory dendrogram.";
+      }
+
+      cugraph::flatten_dendrogram(handle, graph_view, *dendrogram, clustering_v.data(), level);
+      cugraph::flatten_dendrogram(
+        handle, graph_view, *reopened_dendrogram, reopened_clustering_v.data(), level);
+      cugraph::flatten_dendrogram(
+        handle, graph_view, *in_memory_dendrogram, in_memory_clustering_v.data(), level);
+      auto h_clustering = cugraph::test::to_host(handle, clustering_v);
+      ASSERT_EQ(h_clustering, cugraph::test::to_host(handle, reopened_clustering_v))
+        << "flattened clustering at depth " << level << " does not match.";
+      ASSERT_EQ(h_clustering, cugraph::test::to_host(handle, in_memory_clustering_v))
+        << "flattened clustering at depth " << level
+        << " does not match with the in-memory dendrogram.";
+    }
   }
 
   template <typename vertex_t, typename edge_t, typename weight_t>
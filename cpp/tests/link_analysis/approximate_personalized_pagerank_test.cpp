@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+struct ApproximatePersonalizedPageRank_Usecase {
+  double epsilon{1e-4};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ApproximatePersonalizedPageRank
+  : public ::testing::TestWithParam<
+      std::tuple<ApproximatePersonalizedPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_ApproximatePersonalizedPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(
+    std::tuple<ApproximatePersonalizedPageRank_Usecase const&, input_usecase_t const&> const&
+      param)
+  {
+    // the push graph and the pull graph (for the reference PageRank) should share vertex IDs
+    constexpr bool renumber                = false;
+    auto [pagerank_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, renumber);
+    auto [transposed_graph, transposed_edge_weights, d_transposed_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    auto transposed_graph_view = transposed_graph.view();
+    auto transposed_edge_weight_view =
+      transposed_edge_weights ? std::make_optional((*transposed_edge_weights).view())
+                              : std::nullopt;
+
+    // out-going edge weight sums are shared by the queries (and by both algorithms)
+
+    rmm::device_uvector<weight_t> d_out_weight_sums(0, handle.get_stream());
+    if (edge_weight_view) {
+      d_out_weight_sums = cugraph::compute_out_weight_sums(handle, graph_view, *edge_weight_view);
+    } else {
+      auto h_out_degrees = cugraph::test::to_host(handle, graph_view.compute_out_degrees(handle));
+      std::vector<weight_t> h_tmp_out_weight_sums(h_out_degrees.begin(), h_out_degrees.end());
+      d_out_weight_sums.resize(h_tmp_out_weight_sums.size(), handle.get_stream());
+      raft::update_device(d_out_weight_sums.data(),
+                          h_tmp_out_weight_sums.data(),
+                          h_tmp_out_weight_sums.size(),
+                          handle.get_stream());
+    }
+    auto h_out_weight_sums = cugraph::test::to_host(handle, d_out_weight_sums);
+
+    result_t constexpr alpha{0.85};
+    result_t const epsilon = static_cast<result_t>(pagerank_usecase.epsilon);
+
+    auto num_vertices = graph_view.number_of_vertices();
+    std::vector<vertex_t> seeds{
+      vertex_t{0}, num_vertices / vertex_t{2}, std::max(num_vertices - vertex_t{1}, vertex_t{0})};
+
+    for (auto seed : seeds) {
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("Approximate personalized PageRank (push)");
+      }
+
+      auto [d_vertices, d_scores] =
+        cugraph::approximate_personalized_pagerank<vertex_t, edge_t, weight_t, result_t, false>(
+          handle,
+          graph_view,
+          edge_weight_view,
+          std::make_optional<weight_t const*>(d_out_weight_sums.data()),
+          seed,
+          alpha,
+          epsilon);
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+      }
+
+      if (cugraph::test::g_perf || pagerank_usecase.check_correctness) {
+        rmm::device_uvector<vertex_t> d_personalization_vertices(1, handle.get_stream());
+        rmm::device_uvector<result_t> d_personalization_values(1, handle.get_stream());
+        d_personalization_vertices.set_element(0, seed, handle.get_stream());
+        d_personalization_values.set_element(0, result_t{1.0}, handle.get_stream());
+
+        rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+
+        if (cugraph::test::g_perf) {
+          RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          hr_timer.start("Personalized PageRank (power iteration)");
+        }
+
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(
+          handle,
+          transposed_graph_view,
+          transposed_edge_weight_view,
+          std::make_optional<weight_t const*>(d_out_weight_sums.data()),
+          std::make_optional<vertex_t const*>(d_personalization_vertices.data()),
+          std::make_optional<result_t const*>(d_personalization_values.data()),
+          std::make_optional<vertex_t>(vertex_t{1}),
+          d_reference_pageranks.data(),
+          alpha,
+          result_t{1e-6},
+          std::numeric_limits<size_t>::max(),
+          false,
+          false);
+
+        if (cugraph::test::g_perf) {
+          RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          hr_timer.stop();
+          hr_timer.display_and_clear(std::cout);
+        }
+
+        if (pagerank_usecase.check_correctness) {
+          auto h_vertices            = cugraph::test::to_host(handle, d_vertices);
+          auto h_scores              = cugraph::test::to_host(handle, d_scores);
+          auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+
+          ASSERT_TRUE(std::is_sorted(h_vertices.begin(), h_vertices.end()))
+            << "Returned vertices should be sorted.";
+          ASSERT_TRUE(std::adjacent_find(h_vertices.begin(), h_vertices.end()) == h_vertices.end())
+            << "Returned vertices should be unique.";
+
+          std::vector<result_t> h_estimates(num_vertices, result_t{0.0});
+          for (size_t i = 0; i < h_vertices.size(); ++i) {
+            ASSERT_TRUE((h_vertices[i] >= 0) && (h_vertices[i] < num_vertices))
+              << "Returned vertex out-of-range.";
+            h_estimates[h_vertices[i]] = h_scores[i];
+          }
+
+          // the estimates never exceed the exact scores and (for symmetric graphs) the gap is
+          // bounded by epsilon * d(v), the slack accounts for the reference PageRank tolerance
+          auto threshold_magnitude = 1e-5;
+          for (vertex_t v = 0; v < num_vertices; ++v) {
+            auto d     = h_out_weight_sums[v] > weight_t{0.0}
+                           ? static_cast<result_t>(h_out_weight_sums[v])
+                           : result_t{1.0};
+            auto error = h_reference_pageranks[v] - h_estimates[v];
+            ASSERT_TRUE((error > -threshold_magnitude) &&
+                        (error < epsilon * d + threshold_magnitude))
+              << "seed " << seed << ", vertex " << v << ": estimate " << h_estimates[v]
+              << " is not within the error bound of the reference value "
+              << h_reference_pageranks[v] << ".";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_ApproximatePersonalizedPageRank_File =
+  Tests_ApproximatePersonalizedPageRank<cugraph::test::File_Usecase>;
+using Tests_ApproximatePersonalizedPageRank_Rmat =
+  Tests_ApproximatePersonalizedPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ApproximatePersonalizedPageRank_File, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_ApproximatePersonalizedPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_ApproximatePersonalizedPageRank_Rmat, CheckInt64Int64FloatFloat)
+{
+  run_current_test<int64_t, int64_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ApproximatePersonalizedPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ApproximatePersonalizedPageRank_Usecase{1e-3, false},
+                      ApproximatePersonalizedPageRank_Usecase{1e-4, false},
+                      ApproximatePersonalizedPageRank_Usecase{1e-4, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ApproximatePersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks (the error bound holds for symmetric graphs)
+    ::testing::Values(ApproximatePersonalizedPageRank_Usecase{1e-4, false},
+                      ApproximatePersonalizedPageRank_Usecase{1e-4, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ApproximatePersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ApproximatePersonalizedPageRank_Usecase{1e-6, false, false},
+                      ApproximatePersonalizedPageRank_Usecase{1e-6, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
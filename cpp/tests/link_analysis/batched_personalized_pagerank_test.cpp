@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct BatchedPersonalizedPageRank_Usecase {
+  size_t num_sets{0};
+  size_t set_size{0};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BatchedPersonalizedPageRank
+  : public ::testing::TestWithParam<
+      std::tuple<BatchedPersonalizedPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_BatchedPersonalizedPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(
+    std::tuple<BatchedPersonalizedPageRank_Usecase const&, input_usecase_t const&> const& param)
+  {
+    constexpr bool renumber                = true;
+    auto [pagerank_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, pagerank_usecase.test_weighted, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    auto const num_vertices = graph_view.number_of_vertices();
+    auto const set_size = std::min(pagerank_usecase.set_size, static_cast<size_t>(num_vertices));
+
+    // personalization sets of distinct random vertices with random (positive) values
+
+    std::vector<size_t> h_personalization_offsets(pagerank_usecase.num_sets + 1);
+    std::vector<vertex_t> h_personalization_vertices{};
+    std::vector<result_t> h_personalization_values{};
+    {
+      std::mt19937 gen(0);
+      std::uniform_real_distribution<result_t> value_dist(result_t{0.1}, result_t{1.0});
+      std::vector<vertex_t> candidates(num_vertices);
+      std::iota(candidates.begin(), candidates.end(), vertex_t{0});
+      h_personalization_offsets[0] = 0;
+      for (size_t i = 0; i < pagerank_usecase.num_sets; ++i) {
+        std::shuffle(candidates.begin(), candidates.end(), gen);
+        h_personalization_vertices.insert(
+          h_personalization_vertices.end(), candidates.begin(), candidates.begin() + set_size);
+        for (size_t j = 0; j < set_size; ++j) {
+          h_personalization_values.push_back(value_dist(gen));
+        }
+        h_personalization_offsets[i + 1] = h_personalization_vertices.size();
+      }
+    }
+
+    rmm::device_uvector<size_t> d_personalization_offsets(h_personalization_offsets.size(),
+                                                          handle.get_stream());
+    rmm::device_uvector<vertex_t> d_personalization_vertices(h_personalization_vertices.size(),
+                                                             handle.get_stream());
+    rmm::device_uvector<result_t> d_personalization_values(h_personalization_values.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_personalization_offsets.data(),
+                        h_personalization_offsets.data(),
+                        h_personalization_offsets.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_vertices.data(),
+                        h_personalization_vertices.data(),
+                        h_personalization_vertices.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_values.data(),
+                        h_personalization_values.data(),
+                        h_personalization_values.size(),
+                        handle.get_stream());
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_pageranks(pagerank_usecase.num_sets * num_vertices,
+                                              handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Batched personalized PageRank");
+    }
+
+    cugraph::batched_personalized_pagerank<vertex_t, edge_t, weight_t, result_t, false>(
+      handle,
+      graph_view,
+      edge_weight_view,
+      std::nullopt,
+      raft::device_span<size_t const>(d_personalization_offsets.data(),
+                                      d_personalization_offsets.size()),
+      raft::device_span<vertex_t const>(d_personalization_vertices.data(),
+                                        d_personalization_vertices.size()),
+      std::make_optional<raft::device_span<result_t const>>(d_personalization_values.data(),
+                                                            d_personalization_values.size()),
+      d_pageranks.data(),
+      alpha,
+      epsilon,
+      std::numeric_limits<size_t>::max(),
+      false);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (cugraph::test::g_perf || pagerank_usecase.check_correctness) {
+      // one personalized PageRank call per set (the baseline the batched version is compared
+      // against, in both accuracy and performance)
+
+      rmm::device_uvector<result_t> d_reference_pageranks(d_pageranks.size(),
+                                                          handle.get_stream());
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("PageRank (one personalization set at a time)");
+      }
+
+      for (size_t i = 0; i < pagerank_usecase.num_sets; ++i) {
+        auto first = h_personalization_offsets[i];
+        auto size  = h_personalization_offsets[i + 1] - first;
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(
+          handle,
+          graph_view,
+          edge_weight_view,
+          std::nullopt,
+          std::optional<vertex_t const*>{d_personalization_vertices.data() + first},
+          std::optional<result_t const*>{d_personalization_values.data() + first},
+          std::optional<vertex_t>{static_cast<vertex_t>(size)},
+          d_reference_pageranks.data() + i * num_vertices,
+          alpha,
+          epsilon,
+          std::numeric_limits<size_t>::max(),
+          false,
+          false);
+      }
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+      }
+
+      if (pagerank_usecase.check_correctness) {
+        auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+        auto h_cugraph_pageranks   = cugraph::test::to_host(handle, d_pageranks);
+
+        auto threshold_ratio = 1e-3;
+        auto threshold_magnitude =
+          1e-5;  // the two runs start from different initial values, so the converged values may
+                 // differ by up to alpha / (1 - alpha) * epsilon
+        auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+          return std::abs(lhs - rhs) <
+                 std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+        };
+
+        for (size_t i = 0; i < pagerank_usecase.num_sets; ++i) {
+          ASSERT_TRUE(std::equal(h_reference_pageranks.begin() + i * num_vertices,
+                                 h_reference_pageranks.begin() + (i + 1) * num_vertices,
+                                 h_cugraph_pageranks.begin() + i * num_vertices,
+                                 nearly_equal))
+            << "Batched personalized PageRank values for personalization set " << i
+            << " do not match with the reference values.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_BatchedPersonalizedPageRank_File =
+  Tests_BatchedPersonalizedPageRank<cugraph::test::File_Usecase>;
+using Tests_BatchedPersonalizedPageRank_Rmat =
+  Tests_BatchedPersonalizedPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BatchedPersonalizedPageRank_File, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_BatchedPersonalizedPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_BatchedPersonalizedPageRank_Rmat, CheckInt64Int64FloatFloat)
+{
+  run_current_test<int64_t, int64_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BatchedPersonalizedPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedPersonalizedPageRank_Usecase{1, 1, false},
+                      BatchedPersonalizedPageRank_Usecase{5, 3, false},
+                      BatchedPersonalizedPageRank_Usecase{20, 4, false},
+                      BatchedPersonalizedPageRank_Usecase{20, 4, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BatchedPersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedPersonalizedPageRank_Usecase{17, 8, false},
+                      BatchedPersonalizedPageRank_Usecase{17, 8, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BatchedPersonalizedPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BatchedPersonalizedPageRank_Usecase{64, 16, false, false},
+                      BatchedPersonalizedPageRank_Usecase{64, 16, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct IncrementalPageRank_Usecase {
+  size_t num_batches{1};
+  double batch_fraction{0.01};  // the fraction of the edges inserted (and deleted) in each batch
+  bool test_weighted{false};
+  bool check_correctness{true};
+  bool flip_dangling{false};  // if true, the even batches delete all the out-going edges of the
+                              // vertex with the largest out-degree and the odd batches re-insert
+                              // them (so the vertex flips to and from dangling)
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<cugraph::graph_t<vertex_t, edge_t, store_transposed, false>,
+           std::optional<cugraph::edge_property_t<
+             cugraph::graph_view_t<vertex_t, edge_t, store_transposed, false>,
+             weight_t>>>
+construct_graph_from_host_edgelist(raft::handle_t const& handle,
+                                   vertex_t num_vertices,
+                                   std::vector<vertex_t> const& h_srcs,
+                                   std::vector<vertex_t> const& h_dsts,
+                                   std::optional<std::vector<weight_t>> const& h_weights)
+{
+  std::vector<vertex_t> h_vertices(num_vertices);
+  std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+
+  cugraph::graph_t<vertex_t, edge_t, store_transposed, false> graph(handle);
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, false>,
+    weight_t>>
+    edge_weights{std::nullopt};
+  std::tie(graph, edge_weights, std::ignore, std::ignore, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t,
+                                        edge_t,
+                                        weight_t,
+                                        edge_t,
+                                        int32_t,
+                                        store_transposed,
+                                        false>(
+      handle,
+      std::make_optional(cugraph::test::to_device(handle, h_vertices)),
+      cugraph::test::to_device(handle, h_srcs),
+      cugraph::test::to_device(handle, h_dsts),
+      cugraph::test::to_device(handle, h_weights),
+      std::nullopt,
+      std::nullopt,
+      cugraph::graph_properties_t{false, true},
+      false);
+
+  return std::make_tuple(std::move(graph), std::move(edge_weights));
+}
+
+template <typename input_usecase_t>
+class Tests_IncrementalPageRank
+  : public ::testing::TestWithParam<std::tuple<IncrementalPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_IncrementalPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(
+    std::tuple<IncrementalPageRank_Usecase const&, input_usecase_t const&> const& param)
+  {
+    auto [pagerank_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    // the graphs before and after each batch should share vertex IDs, so the edge list is kept on
+    // the host and the graphs are constructed without renumbering
+
+    auto [d_srcs, d_dsts, d_weights, d_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        handle, pagerank_usecase.test_weighted, false, false);
+
+    auto h_srcs    = cugraph::test::to_host(handle, d_srcs);
+    auto h_dsts    = cugraph::test::to_host(handle, d_dsts);
+    auto h_weights = cugraph::test::to_host(handle, d_weights);
+
+    vertex_t num_vertices{0};
+    if (d_vertices) {
+      auto h_vertices = cugraph::test::to_host(handle, *d_vertices);
+      num_vertices    = h_vertices.size() > 0
+                          ? *std::max_element(h_vertices.begin(), h_vertices.end()) + vertex_t{1}
+                          : vertex_t{0};
+    }
+    if (h_srcs.size() > 0) {
+      num_vertices = std::max(
+        num_vertices,
+        std::max(*std::max_element(h_srcs.begin(), h_srcs.end()),
+                 *std::max_element(h_dsts.begin(), h_dsts.end())) +
+          vertex_t{1});
+    }
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    // the initial PageRank values (on the graph before the first batch)
+
+    rmm::device_uvector<result_t> d_pageranks(num_vertices, handle.get_stream());
+    {
+      auto [transposed_graph, transposed_edge_weights] =
+        construct_graph_from_host_edgelist<vertex_t, edge_t, weight_t, true>(
+          handle, num_vertices, h_srcs, h_dsts, h_weights);
+      auto transposed_edge_weight_view =
+        transposed_edge_weights ? std::make_optional((*transposed_edge_weights).view())
+                                : std::nullopt;
+      cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                    transposed_graph.view(),
+                                                    transposed_edge_weight_view,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    std::nullopt,
+                                                    d_pageranks.data(),
+                                                    alpha,
+                                                    epsilon,
+                                                    std::numeric_limits<size_t>::max(),
+                                                    false,
+                                                    false);
+    }
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<weight_t> weight_dist(weight_t{0.1}, weight_t{1.0});
+
+    std::vector<vertex_t> h_flipped_srcs{};
+    std::vector<vertex_t> h_flipped_dsts{};
+    std::optional<std::vector<weight_t>> h_flipped_weights{std::nullopt};
+
+    for (size_t i = 0; i < pagerank_usecase.num_batches; ++i) {
+      std::vector<vertex_t> h_deleted_srcs{};
+      std::vector<vertex_t> h_deleted_dsts{};
+      std::optional<std::vector<weight_t>> h_deleted_weights{std::nullopt};
+      std::vector<vertex_t> h_inserted_srcs{};
+      std::vector<vertex_t> h_inserted_dsts{};
+      std::optional<std::vector<weight_t>> h_inserted_weights{std::nullopt};
+      if (h_weights) {
+        h_deleted_weights  = std::vector<weight_t>{};
+        h_inserted_weights = std::vector<weight_t>{};
+      }
+
+      if (pagerank_usecase.flip_dangling) {
+        if (i % 2 == 0) {
+          std::vector<edge_t> out_degrees(num_vertices, edge_t{0});
+          for (auto src : h_srcs) {
+            ++out_degrees[src];
+          }
+          auto flipped_vertex = static_cast<vertex_t>(std::distance(
+            out_degrees.begin(), std::max_element(out_degrees.begin(), out_degrees.end())));
+          size_t num_kept{0};
+          for (size_t j = 0; j < h_srcs.size(); ++j) {
+            if (h_srcs[j] == flipped_vertex) {
+              h_deleted_srcs.push_back(h_srcs[j]);
+              h_deleted_dsts.push_back(h_dsts[j]);
+              if (h_weights) { (*h_deleted_weights).push_back((*h_weights)[j]); }
+            } else {
+              h_srcs[num_kept] = h_srcs[j];
+              h_dsts[num_kept] = h_dsts[j];
+              if (h_weights) { (*h_weights)[num_kept] = (*h_weights)[j]; }
+              ++num_kept;
+            }
+          }
+          h_srcs.resize(num_kept);
+          h_dsts.resize(num_kept);
+          if (h_weights) { (*h_weights).resize(num_kept); }
+          h_flipped_srcs    = h_deleted_srcs;
+          h_flipped_dsts    = h_deleted_dsts;
+          h_flipped_weights = h_deleted_weights;
+        } else {
+          h_inserted_srcs    = std::move(h_flipped_srcs);
+          h_inserted_dsts    = std::move(h_flipped_dsts);
+          h_inserted_weights = std::move(h_flipped_weights);
+          h_srcs.insert(h_srcs.end(), h_inserted_srcs.begin(), h_inserted_srcs.end());
+          h_dsts.insert(h_dsts.end(), h_inserted_dsts.begin(), h_inserted_dsts.end());
+          if (h_weights) {
+            (*h_weights).insert((*h_weights).end(),
+                                (*h_inserted_weights).begin(),
+                                (*h_inserted_weights).end());
+          }
+        }
+      } else {
+        // delete randomly selected edges and insert random edges (a multi-graph is allowed)
+
+        auto batch_size = std::min(
+          std::max(static_cast<size_t>(h_srcs.size() * pagerank_usecase.batch_fraction), size_t{1}),
+          h_srcs.size());
+        h_deleted_srcs.resize(batch_size);
+        h_deleted_dsts.resize(batch_size);
+        {
+          std::vector<size_t> edge_indices(h_srcs.size());
+          std::iota(edge_indices.begin(), edge_indices.end(), size_t{0});
+          std::shuffle(edge_indices.begin(), edge_indices.end(), gen);
+          std::sort(edge_indices.begin(), edge_indices.begin() + batch_size);
+          if (h_weights) { (*h_deleted_weights).resize(batch_size); }
+          for (size_t j = 0; j < batch_size; ++j) {
+            h_deleted_srcs[j] = h_srcs[edge_indices[j]];
+            h_deleted_dsts[j] = h_dsts[edge_indices[j]];
+            if (h_weights) { (*h_deleted_weights)[j] = (*h_weights)[edge_indices[j]]; }
+          }
+          for (size_t j = batch_size; j > 0; --j) {  // in the decreasing index order
+            auto idx = edge_indices[j - 1];
+            std::swap(h_srcs[idx], h_srcs.back());
+            h_srcs.pop_back();
+            std::swap(h_dsts[idx], h_dsts.back());
+            h_dsts.pop_back();
+            if (h_weights) {
+              std::swap((*h_weights)[idx], (*h_weights).back());
+              (*h_weights).pop_back();
+            }
+          }
+        }
+
+        h_inserted_srcs.resize(batch_size);
+        h_inserted_dsts.resize(batch_size);
+        {
+          std::uniform_int_distribution<vertex_t> vertex_dist(vertex_t{0}, num_vertices - 1);
+          if (h_weights) { (*h_inserted_weights).resize(batch_size); }
+          for (size_t j = 0; j < batch_size; ++j) {
+            h_inserted_srcs[j] = vertex_dist(gen);
+            h_inserted_dsts[j] = vertex_dist(gen);
+            if (h_weights) { (*h_inserted_weights)[j] = weight_dist(gen); }
+          }
+          h_srcs.insert(h_srcs.end(), h_inserted_srcs.begin(), h_inserted_srcs.end());
+          h_dsts.insert(h_dsts.end(), h_inserted_dsts.begin(), h_inserted_dsts.end());
+          if (h_weights) {
+            (*h_weights).insert((*h_weights).end(),
+                                (*h_inserted_weights).begin(),
+                                (*h_inserted_weights).end());
+          }
+        }
+      }
+
+      auto d_inserted_srcs    = cugraph::test::to_device(handle, h_inserted_srcs);
+      auto d_inserted_dsts    = cugraph::test::to_device(handle, h_inserted_dsts);
+      auto d_inserted_weights = cugraph::test::to_device(handle, h_inserted_weights);
+      auto d_deleted_srcs     = cugraph::test::to_device(handle, h_deleted_srcs);
+      auto d_deleted_dsts     = cugraph::test::to_device(handle, h_deleted_dsts);
+      auto d_deleted_weights  = cugraph::test::to_device(handle, h_deleted_weights);
+
+      auto [graph, edge_weights] =
+        construct_graph_from_host_edgelist<vertex_t, edge_t, weight_t, false>(
+          handle, num_vertices, h_srcs, h_dsts, h_weights);
+      auto edge_weight_view =
+        edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("Incremental PageRank");
+      }
+
+      cugraph::incremental_pagerank<vertex_t, edge_t, weight_t, result_t>(
+        handle,
+        graph.view(),
+        edge_weight_view,
+        std::nullopt,
+        raft::device_span<vertex_t const>(d_inserted_srcs.data(), d_inserted_srcs.size()),
+        raft::device_span<vertex_t const>(d_inserted_dsts.data(), d_inserted_dsts.size()),
+        d_inserted_weights ? std::make_optional<raft::device_span<weight_t const>>(
+                               (*d_inserted_weights).data(), (*d_inserted_weights).size())
+                           : std::nullopt,
+        raft::device_span<vertex_t const>(d_deleted_srcs.data(), d_deleted_srcs.size()),
+        raft::device_span<vertex_t const>(d_deleted_dsts.data(), d_deleted_dsts.size()),
+        d_deleted_weights ? std::make_optional<raft::device_span<weight_t const>>(
+                              (*d_deleted_weights).data(), (*d_deleted_weights).size())
+                          : std::nullopt,
+        d_pageranks.data(),
+        alpha,
+        epsilon);
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+      }
+
+      if (cugraph::test::g_perf || pagerank_usecase.check_correctness) {
+        // recompute from scratch on the updated graph (the baseline the incremental update is
+        // compared against, in both accuracy and performance)
+
+        auto [transposed_graph, transposed_edge_weights] =
+          construct_graph_from_host_edgelist<vertex_t, edge_t, weight_t, true>(
+            handle, num_vertices, h_srcs, h_dsts, h_weights);
+        auto transposed_edge_weight_view =
+          transposed_edge_weights ? std::make_optional((*transposed_edge_weights).view())
+                                  : std::nullopt;
+
+        rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+
+        if (cugraph::test::g_perf) {
+          RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          hr_timer.start("PageRank (full recomputation)");
+        }
+
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                      transposed_graph.view(),
+                                                      transposed_edge_weight_view,
+                                                      std::nullopt,
+                                                      std::nullopt,
+                                                      std::nullopt,
+                                                      std::nullopt,
+                                                      d_reference_pageranks.data(),
+                                                      alpha,
+                                                      epsilon,
+                                                      std::numeric_limits<size_t>::max(),
+                                                      false,
+                                                      false);
+
+        if (cugraph::test::g_perf) {
+          RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+          hr_timer.stop();
+          hr_timer.display_and_clear(std::cout);
+        }
+
+        if (pagerank_usecase.check_correctness) {
+          auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+          auto h_cugraph_pageranks   = cugraph::test::to_host(handle, d_pageranks);
+
+          auto threshold_ratio = 1e-3;
+          auto threshold_magnitude =
+            1e-5;  // both results are within epsilon (in L1 norm) of the exact values, and the
+                   // incremental errors accumulate over the batches
+          auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+            return std::abs(lhs - rhs) <
+                   std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+          };
+
+          ASSERT_TRUE(std::equal(h_reference_pageranks.begin(),
+                                 h_reference_pageranks.end(),
+                                 h_cugraph_pageranks.begin(),
+                                 nearly_equal))
+            << "Incremental PageRank values after batch " << i
+            << " do not match with the reference values.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_IncrementalPageRank_File = Tests_IncrementalPageRank<cugraph::test::File_Usecase>;
+using Tests_IncrementalPageRank_Rmat = Tests_IncrementalPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_IncrementalPageRank_File, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt64Int64FloatFloat)
+{
+  run_current_test<int64_t, int64_t, float, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_IncrementalPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{1, 0.01, false},
+                      IncrementalPageRank_Usecase{4, 0.05, false},
+                      IncrementalPageRank_Usecase{4, 0.05, true},
+                      IncrementalPageRank_Usecase{4, 0.0, false, true, true},
+                      IncrementalPageRank_Usecase{4, 0.0, true, true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{4, 0.001, false},
+                      IncrementalPageRank_Usecase{4, 0.01, false},
+                      IncrementalPageRank_Usecase{4, 0.01, true},
+                      IncrementalPageRank_Usecase{4, 0.0, false, true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(IncrementalPageRank_Usecase{1, 0.001, false, false},
+                      IncrementalPageRank_Usecase{1, 0.01, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/sampling_io.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+struct SamplingIO_Usecase {
+  bool test_weighted{false};
+  size_t num_seeds{100};
+  size_t batch_size{32};
+  size_t max_length{10};
+  std::vector<int32_t> fan_out{{5, 5}};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SamplingIO
+  : public ::testing::TestWithParam<std::tuple<SamplingIO_Usecase, input_usecase_t>> {
+ public:
+  Tests_SamplingIO() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SamplingIO_Usecase const& sampling_io_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, sampling_io_usecase.test_weighted, renumber);
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    auto num_seeds = std::min(sampling_io_usecase.num_seeds,
+                              static_cast<size_t>(graph_view.number_of_vertices()));
+    rmm::device_uvector<vertex_t> d_seeds(num_seeds, handle.get_stream());
+    cugraph::detail::sequence_fill(
+      handle.get_stream(), d_seeds.data(), d_seeds.size(), vertex_t{0});
+
+    auto file_path = cugraph::test::temporary_file_path("cugraph_sampling_io_test", ".bin");
+    cugraph::test::temporary_file_guard_t file_guard(file_path);
+
+    // random walks
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Uniform random walks to file");
+    }
+
+    auto num_path_vertices = cugraph::uniform_random_walks_to_file(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+      sampling_io_usecase.max_length,
+      file_path,
+      sampling_io_usecase.batch_size,
+      uint64_t{0});
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "Wrote " << num_path_vertices << " path vertices ("
+                << std::filesystem::file_size(file_path) << " bytes)." << std::endl;
+    }
+
+    if (sampling_io_usecase.check_correctness) {
+      check_sampling_result_file<vertex_t, edge_t, weight_t>(handle,
+                                                             graph_view,
+                                                             edge_weight_view,
+                                                             d_seeds,
+                                                             file_path,
+                                                             num_path_vertices,
+                                                             true,
+                                                             sampling_io_usecase.max_length);
+    }
+
+    if (sampling_io_usecase.check_correctness) {
+      // with the default seed, every batch's seed is fixed (and none of them is 0, which means the
+      // system time), so writing the same random walks twice should produce identical files
+      auto rerun_file_path =
+        cugraph::test::temporary_file_path("cugraph_sampling_io_test_rerun", ".bin");
+      cugraph::test::temporary_file_guard_t rerun_file_guard(rerun_file_path);
+      for (auto const& path : {file_path, rerun_file_path}) {
+        cugraph::uniform_random_walks_to_file(
+          handle,
+          graph_view,
+          edge_weight_view,
+          raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+          sampling_io_usecase.max_length,
+          path,
+          sampling_io_usecase.batch_size);
+      }
+      auto read_file = [](std::string const& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+      };
+      ASSERT_EQ(read_file(file_path), read_file(rerun_file_path))
+        << "random walks with the default seed should be reproducible.";
+    }
+
+    // neighbor samples
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Uniform neighbor sample to file");
+    }
+
+    auto num_sampled_edges = cugraph::uniform_neighbor_sample_to_file(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+      raft::host_span<int32_t const>(sampling_io_usecase.fan_out.data(),
+                                     sampling_io_usecase.fan_out.size()),
+      rng_state,
+      file_path,
+      sampling_io_usecase.batch_size,
+      true);
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "Wrote " << num_sampled_edges << " sampled edges ("
+                << std::filesystem::file_size(file_path) << " bytes)." << std::endl;
+    }
+
+    if (sampling_io_usecase.check_correctness) {
+      check_sampling_result_file<vertex_t, edge_t, weight_t>(handle,
+                                                             graph_view,
+                                                             edge_weight_view,
+                                                             d_seeds,
+                                                             file_path,
+                                                             num_sampled_edges,
+                                                             false,
+                                                             sampling_io_usecase.max_length);
+    }
+  }
+
+ private:
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void check_sampling_result_file(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+    std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    rmm::device_uvector<vertex_t> const& d_seeds,
+    std::string const& file_path,
+    size_t num_values,
+    bool random_walks,
+    size_t max_length)
+  {
+    auto h_offsets =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+    auto h_indices =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+    auto h_weights =
+      edge_weight_view
+        ? std::make_optional(cugraph::test::to_host(
+            handle,
+            raft::device_span<weight_t const>((*edge_weight_view).value_firsts()[0],
+                                              (*edge_weight_view).edge_counts()[0])))
+        : std::nullopt;
+    auto h_seeds = cugraph::test::to_host(handle, d_seeds);
+
+    // returns true if (src, dst) is an edge (with weight w, if edge weights are stored)
+    auto is_valid_edge = [&](vertex_t src, vertex_t dst, std::optional<weight_t> w) {
+      auto first = h_indices.begin() + h_offsets[src];
+      auto last  = h_indices.begin() + h_offsets[src + 1];
+      auto range = std::equal_range(first, last, dst);
+      if (range.first == range.second) { return false; }
+      if (!w) { return true; }
+      for (auto it = range.first; it != range.second; ++it) {  // multi-edges
+        if ((*h_weights)[std::distance(h_indices.begin(), it)] == *w) { return true; }
+      }
+      return false;
+    };
+
+    cugraph::sampling_result_reader_t<vertex_t, weight_t> reader(file_path);
+    ASSERT_EQ(reader.result_type(),
+              random_walks ? cugraph::sampling_result_type_t::RANDOM_WALKS
+                           : cugraph::sampling_result_type_t::NEIGHBOR_SAMPLES);
+    ASSERT_EQ(reader.has_weights(), edge_weight_view.has_value());
+    ASSERT_EQ(reader.number_of_seeds(), h_seeds.size());
+    ASSERT_EQ(reader.number_of_values(), num_values);
+
+    size_t seed_first{0};
+    size_t value_count{0};
+    size_t batch_count{0};
+    while (auto batch = reader.read_next_batch()) {
+      auto batch_num_seeds = (*batch).offsets.size() - 1;
+      ASSERT_TRUE(batch_num_seeds <= reader.number_of_seeds() - seed_first);
+      for (size_t i = 0; i < batch_num_seeds; ++i) {
+        auto seed  = h_seeds[seed_first + i];
+        auto first = (*batch).offsets[i];
+        auto last  = (*batch).offsets[i + 1];
+        if (random_walks) {
+          ASSERT_TRUE((last > first) && (last - first <= max_length + 1));
+          ASSERT_EQ((*batch).vertices[first], seed) << "a path should start from its seed.";
+          for (auto j = first + 1; j < last; ++j) {
+            ASSERT_TRUE(is_valid_edge(
+              (*batch).vertices[j - 1],
+              (*batch).vertices[j],
+              (*batch).weights ? std::make_optional((*((*batch).weights))[j - 1 - i])
+                               : std::nullopt))
+              << "path (" << (*batch).vertices[j - 1] << ", " << (*batch).vertices[j]
+              << ") is not an edge.";
+          }
+        } else {
+          for (auto j = first; j < last; ++j) {
+            auto src = (*((*batch).srcs))[j];
+            auto dst = (*batch).vertices[j];
+            ASSERT_TRUE(is_valid_edge(
+              src,
+              dst,
+              (*batch).weights ? std::make_optional((*((*batch).weights))[j]) : std::nullopt))
+              << "sampled edge (" << src << ", " << dst << ") is not an edge.";
+            if ((*((*batch).hops))[j] == 0) {
+              ASSERT_EQ(src, seed) << "a hop 0 edge should start from its seed.";
+            }
+          }
+        }
+      }
+      seed_first += batch_num_seeds;
+      value_count += (*batch).vertices.size();
+      ++batch_count;
+    }
+    ASSERT_EQ(batch_count, reader.number_of_batches());
+    ASSERT_EQ(seed_first, h_seeds.size());
+    ASSERT_EQ(value_count, num_values);
+  }
+};
+
+using Tests_SamplingIO_File = Tests_SamplingIO<cugraph::test::File_Usecase>;
+using Tests_SamplingIO_Rmat = Tests_SamplingIO<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SamplingIO_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SamplingIO_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_SamplingIO_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SamplingIO_File,
+  ::testing::Combine(
+    // enable correctness checks, batches smaller than the seed set
+    ::testing::Values(SamplingIO_Usecase{false}, SamplingIO_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_SamplingIO_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SamplingIO_Usecase{false}, SamplingIO_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SamplingIO_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs, every vertex is a seed
+    ::testing::Values(
+      SamplingIO_Usecase{true, size_t{1} << 20, size_t{1} << 16, 16, {10, 10}, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/compressed_edge_partition.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+struct CompressedEdgePartition_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_CompressedEdgePartition
+  : public ::testing::TestWithParam<std::tuple<CompressedEdgePartition_Usecase, input_usecase_t>> {
+ public:
+  Tests_CompressedEdgePartition() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(CompressedEdgePartition_Usecase const& compressed_edge_partition_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view     = graph.view();
+    auto edge_partition = graph_view.local_edge_partition_view();
+
+    auto h_offsets = cugraph::test::to_host(handle, edge_partition.offsets());
+    auto h_indices = cugraph::test::to_host(handle, edge_partition.indices());
+
+    if (cugraph::test::g_perf) { hr_timer.start("Compress edge partition"); }
+
+    auto compressed_edge_partition = cugraph::compress_edge_partition(handle, edge_partition);
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // walk the adjacency lists (raw and compressed)
+
+    if (cugraph::test::g_perf) { hr_timer.start("Walk raw adjacency lists"); }
+
+    uint64_t raw_checksum{0};
+    for (size_t i = 0; i < h_offsets.size() - 1; ++i) {
+      for (auto j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+        raw_checksum += static_cast<uint64_t>(h_indices[j]);
+      }
+    }
+
+    double raw_elapsed{0.0};
+    if (cugraph::test::g_perf) {
+      raw_elapsed = hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Walk compressed adjacency lists");
+    }
+
+    uint64_t compressed_checksum{0};
+    for (size_t i = 0; i < compressed_edge_partition.number_of_majors(); ++i) {
+      for (auto nbr : compressed_edge_partition.neighbors(i)) {
+        compressed_checksum += static_cast<uint64_t>(nbr);
+      }
+    }
+
+    if (cugraph::test::g_perf) {
+      auto compressed_elapsed = hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      auto raw_size        = h_indices.size() * sizeof(vertex_t);
+      auto compressed_size = compressed_edge_partition.compressed_indices_size_in_bytes();
+      std::cout << "Indices: " << raw_size << " bytes (raw) vs " << compressed_size
+                << " bytes (compressed), "
+                << static_cast<double>(compressed_size) / static_cast<double>(raw_size)
+                << " of the raw size." << std::endl;
+      std::cout << "Decode throughput: "
+                << static_cast<double>(h_indices.size()) / compressed_elapsed / 1e6
+                << " M edges/s (raw walk: "
+                << static_cast<double>(h_indices.size()) / raw_elapsed / 1e6 << " M edges/s)."
+                << std::endl;
+    }
+
+    ASSERT_EQ(raw_checksum, compressed_checksum);
+
+    if (compressed_edge_partition_usecase.check_correctness) {
+      ASSERT_EQ(compressed_edge_partition.number_of_majors(), h_offsets.size() - 1);
+      ASSERT_EQ(compressed_edge_partition.number_of_edges(),
+                static_cast<edge_t>(h_indices.size()));
+      for (size_t i = 0; i < compressed_edge_partition.number_of_majors(); ++i) {
+        ASSERT_EQ(compressed_edge_partition.local_offset(i), h_offsets[i]);
+        ASSERT_EQ(compressed_edge_partition.local_degree(i), h_offsets[i + 1] - h_offsets[i]);
+        auto j = h_offsets[i];
+        for (auto nbr : compressed_edge_partition.neighbors(i)) {
+          ASSERT_EQ(nbr, h_indices[j]) << "decoded neighbor does not match with the raw index.";
+          ++j;
+        }
+        ASSERT_EQ(j, h_offsets[i + 1]);
+      }
+    }
+  }
+};
+
+using Tests_CompressedEdgePartition_File =
+  Tests_CompressedEdgePartition<cugraph::test::File_Usecase>;
+using Tests_CompressedEdgePartition_Rmat =
+  Tests_CompressedEdgePartition<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_CompressedEdgePartition_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_CompressedEdgePartition_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_CompressedEdgePartition_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_CompressedEdgePartition_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_CompressedEdgePartition_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(CompressedEdgePartition_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_CompressedEdgePartition_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(CompressedEdgePartition_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_CompressedEdgePartition_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(CompressedEdgePartition_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
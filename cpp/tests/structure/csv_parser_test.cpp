@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// sequential reference reader
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::vector<weight_t>>
+read_csv_file_reference(std::string const& graph_file_full_path)
+{
+  std::ifstream file(graph_file_full_path);
+  std::string line{};
+
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> weights{};
+  while (std::getline(file, line)) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream iss(line);
+    int64_t src{}, dst{};
+    double w{};
+    if (!(iss >> src >> dst)) { continue; }
+    srcs.push_back(static_cast<vertex_t>(src));
+    dsts.push_back(static_cast<vertex_t>(dst));
+    if (iss >> w) { weights.push_back(static_cast<weight_t>(w)); }
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights));
+}
+
+// write num_edges random weighted edges (vertex IDs in [0, 2^30)) to a CSV file
+void generate_synthetic_csv_file(std::string const& file_path, size_t num_edges, uint64_t seed)
+{
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int64_t> vertex_dist(0, (int64_t{1} << 30) - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 1.0);
+
+  std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+  std::vector<char> buffer(size_t{1} << 20);
+  size_t size{0};
+  for (size_t i = 0; i < num_edges; ++i) {
+    if (buffer.size() - size < 64) {
+      file.write(buffer.data(), size);
+      size = 0;
+    }
+    size += std::snprintf(buffer.data() + size,
+                          buffer.size() - size,
+                          "%lld,%lld,%.6f\n",
+                          static_cast<long long>(vertex_dist(gen)),
+                          static_cast<long long>(vertex_dist(gen)),
+                          weight_dist(gen));
+  }
+  file.write(buffer.data(), size);
+}
+
+constexpr size_t max_num_synthetic_edges_wo_perf = size_t{1} << 20;
+
+struct CsvParser_Usecase {
+  size_t num_threads{0};  // 0: use all the available cores
+  size_t batch_size{size_t{1} << 20};
+  bool check_correctness{true};
+};
+
+struct CsvInput_Usecase {
+  std::string file_name{};        // dataset file (relative to the dataset root directory)
+  size_t num_synthetic_edges{0};  // if file_name is empty, generate a synthetic CSV file
+};
+
+class Tests_CsvParser
+  : public ::testing::TestWithParam<std::tuple<CsvParser_Usecase, CsvInput_Usecase>> {
+ public:
+  Tests_CsvParser() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename weight_t>
+  void run_current_test(CsvParser_Usecase const& parser_usecase,
+                        CsvInput_Usecase const& input_usecase)
+  {
+    std::string file_path{};
+    std::optional<cugraph::test::temporary_file_guard_t> file_guard{std::nullopt};
+    bool synthetic = input_usecase.file_name.empty();
+    // the multi-GB synthetic inputs are generated only in benchmarking (with --perf)
+    auto num_synthetic_edges = cugraph::test::g_perf ? input_usecase.num_synthetic_edges
+                                                     : std::min(input_usecase.num_synthetic_edges,
+                                                                max_num_synthetic_edges_wo_perf);
+    if (synthetic) {
+      file_path = (std::filesystem::temp_directory_path() /
+                   ("cugraph_csv_parser_test_" + std::to_string(::getpid()) + ".csv"))
+                    .string();
+      file_guard.emplace(file_path);
+      generate_synthetic_csv_file(file_path, num_synthetic_edges, 0);
+    } else {
+      file_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + input_usecase.file_name;
+    }
+    auto file_bytes = std::filesystem::file_size(file_path);
+
+    auto [h_reference_srcs, h_reference_dsts, h_reference_weights] =
+      parser_usecase.check_correctness ? read_csv_file_reference<vertex_t, weight_t>(file_path)
+                                       : std::make_tuple(std::vector<vertex_t>{},
+                                                         std::vector<vertex_t>{},
+                                                         std::vector<weight_t>{});
+    bool test_weighted = parser_usecase.check_correctness ? (h_reference_weights.size() > 0) : true;
+
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) { hr_timer.start("Parse CSV file"); }
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    size_t num_edges{0};
+    bool valid_batches{true};
+    cugraph::test::read_edgelist_from_csv_file_in_batches<vertex_t, weight_t>(
+      file_path,
+      test_weighted,
+      parser_usecase.batch_size,
+      [&](std::vector<vertex_t>&& srcs,
+          std::vector<vertex_t>&& dsts,
+          std::optional<std::vector<weight_t>>&& weights) {
+        valid_batches = valid_batches && (srcs.size() > 0) &&
+                        (srcs.size() <= parser_usecase.batch_size) &&
+                        (dsts.size() == srcs.size()) && (weights.has_value() == test_weighted) &&
+                        (!weights || ((*weights).size() == srcs.size()));
+        num_edges += srcs.size();
+        if (parser_usecase.check_correctness) {
+          h_srcs.insert(h_srcs.end(), srcs.begin(), srcs.end());
+          h_dsts.insert(h_dsts.end(), dsts.begin(), dsts.end());
+          if (weights) { h_weights.insert(h_weights.end(), (*weights).begin(), (*weights).end()); }
+        }
+      },
+      parser_usecase.num_threads);
+
+    if (cugraph::test::g_perf) {
+      auto elapsed = hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "CSV parser throughput: "
+                << (static_cast<double>(file_bytes) / (1024.0 * 1024.0)) / elapsed << " MB/s ("
+                << num_edges << " edges)." << std::endl;
+    }
+
+    file_guard.reset();
+
+    ASSERT_TRUE(valid_batches) << "invalid batch size or batch contents.";
+    if (synthetic) { ASSERT_EQ(num_edges, num_synthetic_edges); }
+
+    if (parser_usecase.check_correctness) {
+      ASSERT_TRUE(std::equal(
+        h_reference_srcs.begin(), h_reference_srcs.end(), h_srcs.begin(), h_srcs.end()))
+        << "sources do not match with the reference values.";
+      ASSERT_TRUE(std::equal(
+        h_reference_dsts.begin(), h_reference_dsts.end(), h_dsts.begin(), h_dsts.end()))
+        << "destinations do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_weights.begin(),
+                             h_reference_weights.end(),
+                             h_weights.begin(),
+                             h_weights.end()))
+        << "weights do not match with the reference values.";
+    }
+  }
+};
+
+TEST_P(Tests_CsvParser, CheckInt32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_CsvParser, CheckInt64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, double>(std::get<0>(param), std::get<1>(param));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_CsvParser,
+  ::testing::Combine(
+    // enable correctness checks, test both the single-threaded and the multi-threaded paths with
+    // batches smaller than the input graphs
+    ::testing::Values(CsvParser_Usecase{1, 100}, CsvParser_Usecase{7, 100}),
+    ::testing::Values(CsvInput_Usecase{"karate.csv"},
+                      CsvInput_Usecase{"karate-data.csv"},
+                      CsvInput_Usecase{"dolphins.csv"},
+                      CsvInput_Usecase{"netscience.csv"},
+                      CsvInput_Usecase{"", size_t{1} << 20})));
+
+INSTANTIATE_TEST_SUITE_P(
+  synthetic_benchmark_test, /* multi-GB synthetic inputs (capped to 2^20 edges without --perf) */
+  Tests_CsvParser,
+  ::testing::Combine(
+    // disable correctness checks for large inputs
+    ::testing::Values(CsvParser_Usecase{0, size_t{1} << 24, false}),
+    ::testing::Values(CsvInput_Usecase{"", size_t{1} << 27} /* ~3.5 GB */,
+                      CsvInput_Usecase{"", size_t{1} << 28} /* ~7 GB */)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_io.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+struct EdgePropertyFile_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_EdgePropertyFile
+  : public ::testing::TestWithParam<std::tuple<EdgePropertyFile_Usecase, input_usecase_t>> {
+ public:
+  Tests_EdgePropertyFile() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(EdgePropertyFile_Usecase const& edge_property_file_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    // edge weights are used as the edge property to save
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, true, renumber);
+    auto graph_view = graph.view();
+
+    auto graph_file_path =
+      cugraph::test::temporary_file_path("cugraph_edge_property_file_test_graph", ".bin");
+    auto edge_property_file_path =
+      cugraph::test::temporary_file_path("cugraph_edge_property_file_test_weights", ".bin");
+    cugraph::test::temporary_file_guard_t graph_file_guard(graph_file_path);
+    cugraph::test::temporary_file_guard_t edge_property_file_guard(edge_property_file_path);
+
+    // the graph topology is saved without the edge weights, the edge weights are saved to a
+    // separate column file
+
+    cugraph::save_graph(handle,
+                        graph_file_path,
+                        graph_view,
+                        std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{
+                          std::nullopt},
+                        d_renumber_map_labels
+                          ? std::make_optional<raft::device_span<vertex_t const>>(
+                              (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                          : std::nullopt);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Save edge property");
+    }
+
+    cugraph::save_edge_property(
+      handle, edge_property_file_path, graph_view, (*edge_weights).view());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Open edge property file");
+    }
+
+    cugraph::edge_property_file_t<edge_t, weight_t> edge_property_file(edge_property_file_path);
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto [loaded_graph, loaded_edge_weights, d_loaded_renumber_map_labels] =
+      cugraph::load_graph<vertex_t, edge_t, weight_t, store_transposed, false>(handle,
+                                                                               graph_file_path);
+    auto loaded_graph_view = loaded_graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Load edge property");
+    }
+
+    auto loaded_edge_property =
+      cugraph::load_edge_property(handle, loaded_graph_view, edge_property_file);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (edge_property_file_usecase.check_correctness) {
+      ASSERT_FALSE(loaded_edge_weights.has_value());
+
+      // check the meta-data (available without touching the values)
+
+      ASSERT_FALSE(edge_property_file.is_multi_gpu());
+      ASSERT_EQ(edge_property_file.number_of_local_edge_partitions(), size_t{1});
+      ASSERT_EQ(edge_property_file.edge_partition_edge_count(0),
+                graph_view.local_edge_partition_view().number_of_edges());
+
+      // check the host span of the memory-mapped file
+
+      auto h_weights = cugraph::test::to_host(
+        handle,
+        raft::device_span<weight_t const>((*edge_weights).view().value_firsts()[0],
+                                          (*edge_weights).view().edge_counts()[0]));
+      ASSERT_TRUE(std::equal(h_weights.begin(),
+                             h_weights.end(),
+                             edge_property_file.edge_partition_values(0).begin(),
+                             edge_property_file.edge_partition_values(0).end()))
+        << "memory-mapped edge property values do not match with the saved ones.";
+
+      // check the edge lists (the edge order is preserved in saving & loading)
+
+      auto [d_org_srcs, d_org_dsts, d_org_weights] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::make_optional((*edge_weights).view()),
+        d_renumber_map_labels ? std::make_optional<raft::device_span<vertex_t const>>(
+                                  (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                              : std::nullopt);
+
+      auto [d_loaded_srcs, d_loaded_dsts, d_loaded_weights] = cugraph::decompress_to_edgelist(
+        handle,
+        loaded_graph_view,
+        std::make_optional(loaded_edge_property.view()),
+        d_loaded_renumber_map_labels
+          ? std::make_optional<raft::device_span<vertex_t const>>(
+              (*d_loaded_renumber_map_labels).data(), (*d_loaded_renumber_map_labels).size())
+          : std::nullopt);
+
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_srcs),
+                cugraph::test::to_host(handle, d_loaded_srcs))
+        << "edge sources do not match with the saved graph.";
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_dsts),
+                cugraph::test::to_host(handle, d_loaded_dsts))
+        << "edge destinations do not match with the saved graph.";
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_weights),
+                cugraph::test::to_host(handle, d_loaded_weights))
+        << "edge property values do not match with the saved ones.";
+
+      // a column file saved with a different value type should be rejected
+
+      ASSERT_THROW(cugraph::edge_property_file_t<edge_t, int32_t>(edge_property_file_path),
+                   cugraph::logic_error);
+    }
+  }
+};
+
+using Tests_EdgePropertyFile_File = Tests_EdgePropertyFile<cugraph::test::File_Usecase>;
+using Tests_EdgePropertyFile_Rmat = Tests_EdgePropertyFile<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_EdgePropertyFile_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_EdgePropertyFile_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_EdgePropertyFile_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgePropertyFile_Rmat, CheckInt32Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgePropertyFile_Rmat, CheckInt64Int64DoubleTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_EdgePropertyFile_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(EdgePropertyFile_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_EdgePropertyFile_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(EdgePropertyFile_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_EdgePropertyFile_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(EdgePropertyFile_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph_io.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct GraphFileProbe_Usecase {
+  size_t num_sample_lines{0};
+  bool check_correctness{true};
+};
+
+class Tests_GraphFileProbe
+  : public ::testing::TestWithParam<
+      std::tuple<GraphFileProbe_Usecase, cugraph::test::File_Usecase>> {
+ public:
+  Tests_GraphFileProbe() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void run_current_test(GraphFileProbe_Usecase const& probe_usecase,
+                        cugraph::test::File_Usecase const& input_usecase)
+  {
+    using vertex_t = int64_t;
+    using weight_t = float;
+
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) { hr_timer.start("Probe graph file"); }
+
+    auto properties = input_usecase.probe(probe_usecase.num_sample_lines);
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Parse graph file");
+    }
+
+    // full parse (the reference)
+
+    auto const& file_path = input_usecase.get_file_full_path();
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    bool is_weighted{false};
+    std::optional<size_t> mtx_number_of_vertices{std::nullopt};
+    std::optional<bool> mtx_is_symmetric{std::nullopt};
+    if (properties.format == cugraph::graph_file_format_t::MATRIX_MARKET) {
+      auto [rows, cols, weights, number_of_vertices, is_symmetric] =
+        cugraph::test::read_edgelist_from_matrix_market_file_to_host<vertex_t, weight_t>(file_path,
+                                                                                         false);
+      h_srcs                 = std::move(rows);
+      h_dsts                 = std::move(cols);
+      mtx_number_of_vertices = static_cast<size_t>(number_of_vertices);
+      mtx_is_symmetric       = is_symmetric;
+    } else {
+      cugraph::test::read_edgelist_from_csv_file_in_batches<vertex_t, weight_t>(
+        file_path,
+        false,
+        size_t{1} << 20,
+        [&h_srcs, &h_dsts](std::vector<vertex_t>&& srcs,
+                           std::vector<vertex_t>&& dsts,
+                           std::optional<std::vector<weight_t>>&&) {
+          h_srcs.insert(h_srcs.end(), srcs.begin(), srcs.end());
+          h_dsts.insert(h_dsts.end(), dsts.begin(), dsts.end());
+        });
+      std::ifstream file(file_path);
+      std::string line{};
+      while (std::getline(file, line)) {
+        if (line.find_first_not_of(" ,\t\r") != std::string::npos) { break; }
+      }
+      std::replace(line.begin(), line.end(), ',', ' ');
+      std::istringstream iss(line);
+      std::string token{};
+      size_t num_tokens{0};
+      while (iss >> token) {
+        ++num_tokens;
+      }
+      is_weighted = (num_tokens >= 3);
+    }
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (probe_usecase.check_correctness) {
+      if (properties.format == cugraph::graph_file_format_t::MATRIX_MARKET) {
+        ASSERT_TRUE(properties.is_exact);
+        ASSERT_EQ(properties.number_of_vertices, *mtx_number_of_vertices);
+        ASSERT_TRUE(properties.is_symmetric.has_value());
+        ASSERT_EQ(*(properties.is_symmetric), *mtx_is_symmetric);
+        ASSERT_TRUE(properties.number_of_entries <= h_srcs.size());
+        ASSERT_TRUE(h_srcs.size() <= properties.max_number_of_edges);
+      } else {
+        ASSERT_FALSE(properties.is_symmetric.has_value());
+        ASSERT_EQ(properties.is_weighted, is_weighted);
+        if (properties.is_exact) {
+          ASSERT_EQ(properties.number_of_entries, h_srcs.size());
+        } else {
+          // estimated from the average sampled line length
+          auto relative_error = std::abs(static_cast<double>(properties.number_of_entries) -
+                                         static_cast<double>(h_srcs.size())) /
+                                static_cast<double>(h_srcs.size());
+          ASSERT_TRUE(relative_error < 0.25)
+            << "estimated # entries " << properties.number_of_entries << " vs actual "
+            << h_srcs.size() << ".";
+        }
+      }
+
+      if (properties.number_of_sampled_entries > 0) {
+        auto [min_src, max_src] = std::minmax_element(h_srcs.begin(), h_srcs.end());
+        auto [min_dst, max_dst] = std::minmax_element(h_dsts.begin(), h_dsts.end());
+        auto min_id             = std::min(*min_src, *min_dst);
+        auto max_id             = std::max(*max_src, *max_dst);
+        ASSERT_TRUE(properties.min_vertex_id.has_value() && properties.max_vertex_id.has_value());
+        ASSERT_TRUE((*(properties.min_vertex_id) >= min_id) &&
+                    (*(properties.max_vertex_id) <= max_id))
+          << "sampled vertex IDs are out of the actual vertex ID range.";
+        ASSERT_TRUE(properties.duplicate_entry_rate.has_value());
+
+        if ((properties.format == cugraph::graph_file_format_t::CSV) && properties.is_exact) {
+          ASSERT_EQ(*(properties.min_vertex_id), min_id);
+          ASSERT_EQ(*(properties.max_vertex_id), max_id);
+          std::vector<std::pair<vertex_t, vertex_t>> entries(h_srcs.size());
+          for (size_t i = 0; i < h_srcs.size(); ++i) {
+            entries[i] = std::make_pair(h_srcs[i], h_dsts[i]);
+          }
+          std::sort(entries.begin(), entries.end());
+          auto num_unique_entries = static_cast<size_t>(
+            std::distance(entries.begin(), std::unique(entries.begin(), entries.end())));
+          ASSERT_NEAR(*(properties.duplicate_entry_rate),
+                      static_cast<double>(h_srcs.size() - num_unique_entries) /
+                        static_cast<double>(h_srcs.size()),
+                      1e-12);
+        }
+      }
+
+      ASSERT_TRUE(properties.vertex_t_fits<int32_t>());  // all the test inputs fit in int32_t
+      ASSERT_TRUE(properties.edge_t_fits<int32_t>());
+    }
+  }
+};
+
+TEST_P(Tests_GraphFileProbe, CheckProperties)
+{
+  auto param = GetParam();
+  run_current_test(std::get<0>(param), std::get<1>(param));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphFileProbe,
+  ::testing::Combine(
+    // enable correctness checks, header only, sampled, and (for the small inputs) full sampling
+    ::testing::Values(GraphFileProbe_Usecase{0},
+                      GraphFileProbe_Usecase{4096},
+                      GraphFileProbe_Usecase{size_t{1} << 24}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                      cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("karate-data.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"),
+                      cugraph::test::File_Usecase("netscience.csv"))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
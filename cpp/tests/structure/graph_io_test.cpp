@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_io.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+struct GraphIO_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphIO
+  : public ::testing::TestWithParam<std::tuple<GraphIO_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphIO() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphIO_Usecase const& graph_io_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, graph_io_usecase.test_weighted, renumber);
+    auto graph_view = graph.view();
+
+    auto file_path = cugraph::test::temporary_file_path("cugraph_graph_io_test", ".bin");
+    cugraph::test::temporary_file_guard_t file_guard(file_path);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Save graph");
+    }
+
+    cugraph::save_graph(handle,
+                        file_path,
+                        graph_view,
+                        edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt,
+                        d_renumber_map_labels
+                          ? std::make_optional<raft::device_span<vertex_t const>>(
+                              (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                          : std::nullopt);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Load graph");
+    }
+
+    auto [loaded_graph, loaded_edge_weights, d_loaded_renumber_map_labels] =
+      cugraph::load_graph<vertex_t, edge_t, weight_t, store_transposed, false>(handle, file_path);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (graph_io_usecase.check_correctness) {
+      auto loaded_graph_view = loaded_graph.view();
+
+      // check the meta-data
+
+      ASSERT_EQ(graph_view.number_of_vertices(), loaded_graph_view.number_of_vertices());
+      ASSERT_EQ(graph_view.number_of_edges(), loaded_graph_view.number_of_edges());
+      ASSERT_EQ(graph_view.is_symmetric(), loaded_graph_view.is_symmetric());
+      ASSERT_EQ(graph_view.is_multigraph(), loaded_graph_view.is_multigraph());
+      ASSERT_EQ(graph_view.local_edge_partition_segment_offsets(),
+                loaded_graph_view.local_edge_partition_segment_offsets());
+      ASSERT_EQ(edge_weights.has_value(), loaded_edge_weights.has_value());
+      ASSERT_EQ(d_renumber_map_labels.has_value(), d_loaded_renumber_map_labels.has_value());
+      if (d_renumber_map_labels) {
+        ASSERT_EQ(cugraph::test::to_host(handle, *d_renumber_map_labels),
+                  cugraph::test::to_host(handle, *d_loaded_renumber_map_labels))
+          << "renumber map does not match with the saved one.";
+      }
+
+      // check the host spans of the memory-mapped snapshot
+
+      {
+        cugraph::graph_snapshot_t<vertex_t, edge_t, weight_t> snapshot(file_path);
+        auto h_offsets =
+          cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+        auto h_indices =
+          cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+        ASSERT_EQ(snapshot.number_of_local_edge_partitions(), size_t{1});
+        ASSERT_TRUE(std::equal(h_offsets.begin(),
+                               h_offsets.end(),
+                               snapshot.edge_partition_offsets(0).begin(),
+                               snapshot.edge_partition_offsets(0).end()))
+          << "snapshot offsets do not match with the saved graph.";
+        ASSERT_TRUE(std::equal(h_indices.begin(),
+                               h_indices.end(),
+                               snapshot.edge_partition_indices(0).begin(),
+                               snapshot.edge_partition_indices(0).end()))
+          << "snapshot indices do not match with the saved graph.";
+      }
+
+      // check the edge lists
+
+      auto [d_org_srcs, d_org_dsts, d_org_weights] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt,
+        d_renumber_map_labels ? std::make_optional<raft::device_span<vertex_t const>>(
+                                  (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                              : std::nullopt);
+
+      auto [d_loaded_srcs, d_loaded_dsts, d_loaded_weights] = cugraph::decompress_to_edgelist(
+        handle,
+        loaded_graph_view,
+        loaded_edge_weights ? std::make_optional((*loaded_edge_weights).view()) : std::nullopt,
+        d_loaded_renumber_map_labels
+          ? std::make_optional<raft::device_span<vertex_t const>>(
+              (*d_loaded_renumber_map_labels).data(), (*d_loaded_renumber_map_labels).size())
+          : std::nullopt);
+
+      // the compressed sparse arrays are copied as-is, so the edge order should be preserved
+
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_srcs),
+                cugraph::test::to_host(handle, d_loaded_srcs))
+        << "edge sources do not match with the saved graph.";
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_dsts),
+                cugraph::test::to_host(handle, d_loaded_dsts))
+        << "edge destinations do not match with the saved graph.";
+      ASSERT_EQ(cugraph::test::to_host(handle, d_org_weights),
+                cugraph::test::to_host(handle, d_loaded_weights))
+        << "edge weights do not match with the saved graph.";
+    }
+  }
+};
+
+using Tests_GraphIO_File = Tests_GraphIO<cugraph::test::File_Usecase>;
+using Tests_GraphIO_Rmat = Tests_GraphIO<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphIO_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphIO_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphIO_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphIO_Rmat, CheckInt32Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphIO_Rmat, CheckInt64Int64DoubleTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphIO_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphIO_Usecase{false}, GraphIO_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphIO_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphIO_Usecase{false}, GraphIO_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_GraphIO_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(GraphIO_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// sequential reference reader (same semantics as the original fscanf based mm_to_coo)
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::vector<weight_t>>
+read_matrix_market_file_reference(std::string const& graph_file_full_path)
+{
+  std::ifstream file(graph_file_full_path);
+  std::string line{};
+  std::getline(file, line);
+  std::string banner{}, object{}, format{}, field{}, symmetry{};
+  std::istringstream(line) >> banner >> object >> format >> field >> symmetry;
+  bool is_pattern = (field == "pattern");
+  bool is_general = (symmetry == "general");
+
+  while (std::getline(file, line)) {
+    if ((line.size() > 0) && (line[0] != '%')) { break; }
+  }
+  size_t m{}, n{}, nnz{};
+  std::istringstream(line) >> m >> n >> nnz;
+
+  std::vector<vertex_t> rows{};
+  std::vector<vertex_t> cols{};
+  std::vector<weight_t> weights{};
+  for (size_t i = 0; i < nnz; ++i) {
+    int64_t row{}, col{};
+    double w{1.0};
+    file >> row >> col;
+    if (!is_pattern) { file >> w; }
+    rows.push_back(static_cast<vertex_t>(row - 1));
+    cols.push_back(static_cast<vertex_t>(col - 1));
+    weights.push_back(static_cast<weight_t>(w));
+    if (!is_general && (row != col)) {
+      rows.push_back(static_cast<vertex_t>(col - 1));
+      cols.push_back(static_cast<vertex_t>(row - 1));
+      weights.push_back(static_cast<weight_t>(w));
+    }
+  }
+
+  return std::make_tuple(std::move(rows), std::move(cols), std::move(weights));
+}
+
+struct MatrixMarketParser_Usecase {
+  size_t num_threads{0};  // 0: use all the available cores
+  bool check_correctness{true};
+};
+
+class Tests_MatrixMarketParser
+  : public ::testing::TestWithParam<
+      std::tuple<MatrixMarketParser_Usecase, cugraph::test::File_Usecase>> {
+ public:
+  Tests_MatrixMarketParser() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename weight_t>
+  void run_current_test(MatrixMarketParser_Usecase const& parser_usecase,
+                        cugraph::test::File_Usecase const& input_usecase)
+  {
+    auto const& file_path = input_usecase.get_file_full_path();
+
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) { hr_timer.start("Parse Matrix Market file"); }
+
+    auto [h_rows, h_cols, h_weights, number_of_vertices, is_symmetric] =
+      cugraph::test::read_edgelist_from_matrix_market_file_to_host<vertex_t, weight_t>(
+        file_path, true, parser_usecase.num_threads);
+
+    if (cugraph::test::g_perf) {
+      auto elapsed    = hr_timer.stop();
+      auto file_bytes = std::ifstream(file_path, std::ios::binary | std::ios::ate).tellg();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "Matrix Market parser throughput: "
+                << (static_cast<double>(file_bytes) / (1024.0 * 1024.0)) / elapsed << " MB/s ("
+                << h_rows.size() << " edges)." << std::endl;
+    }
+
+    ASSERT_EQ(h_rows.size(), h_cols.size());
+    ASSERT_TRUE(h_weights.has_value());
+    ASSERT_EQ(h_rows.size(), (*h_weights).size());
+
+    if (parser_usecase.check_correctness) {
+      auto [h_reference_rows, h_reference_cols, h_reference_weights] =
+        read_matrix_market_file_reference<vertex_t, weight_t>(file_path);
+
+      ASSERT_TRUE(std::equal(
+        h_reference_rows.begin(), h_reference_rows.end(), h_rows.begin(), h_rows.end()))
+        << "row indices do not match with the reference values.";
+      ASSERT_TRUE(std::equal(
+        h_reference_cols.begin(), h_reference_cols.end(), h_cols.begin(), h_cols.end()))
+        << "column indices do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_weights.begin(),
+                             h_reference_weights.end(),
+                             (*h_weights).begin(),
+                             (*h_weights).end()))
+        << "weights do not match with the reference values.";
+
+      ASSERT_TRUE(std::all_of(h_rows.begin(),
+                              h_rows.end(),
+                              [number_of_vertices = number_of_vertices](auto v) {
+                                return (v >= 0) && (v < number_of_vertices);
+                              }))
+        << "invalid vertex ID.";
+    }
+  }
+};
+
+TEST_P(Tests_MatrixMarketParser, CheckInt32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MatrixMarketParser, CheckInt64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, double>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MatrixMarketParser,
+  ::testing::Combine(
+    // enable correctness checks, test both the single-threaded and the multi-threaded paths
+    ::testing::Values(MatrixMarketParser_Usecase{1}, MatrixMarketParser_Usecase{7}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  file_benchmark_test, /* note that the input file can be overridden in benchmarking (with
+                          --gtest_filter to select only the file_benchmark_test with a specific
+                          type combination) by the --test_file_name command line argument */
+  Tests_MatrixMarketParser,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MatrixMarketParser_Usecase{0, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/ljournal-2008.mtx"))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_io.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+struct RenumberMapIndex_Usecase {
+  size_t num_queries{size_t{1} << 20};
+  size_t num_repetitions{1};  // translate the same number of queries this many times
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_RenumberMapIndex
+  : public ::testing::TestWithParam<std::tuple<RenumberMapIndex_Usecase, input_usecase_t>> {
+ public:
+  Tests_RenumberMapIndex() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(RenumberMapIndex_Usecase const& renumber_map_index_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+    ASSERT_TRUE(d_renumber_map_labels.has_value());
+
+    auto file_path = (std::filesystem::temp_directory_path() /
+                      ("cugraph_renumber_map_index_test_" + std::to_string(::getpid()) + ".bin"))
+                       .string();
+    cugraph::test::temporary_file_guard_t file_guard(file_path);
+
+    if (cugraph::test::g_perf) { hr_timer.start("Save renumber map (with index)"); }
+
+    cugraph::save_renumber_map(handle,
+                               file_path,
+                               raft::device_span<vertex_t const>((*d_renumber_map_labels).data(),
+                                                                 (*d_renumber_map_labels).size()));
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Map renumber map");
+    }
+
+    cugraph::renumber_map_t<vertex_t> renumber_map(file_path);
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // queries: random external vertex IDs (and an invalid vertex ID)
+
+    auto h_renumber_map_labels = cugraph::test::to_host(handle, *d_renumber_map_labels);
+    std::vector<vertex_t> h_expected(renumber_map_index_usecase.num_queries);
+    std::vector<vertex_t> h_queries(h_expected.size());
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, graph_view.number_of_vertices() - 1);
+    for (size_t i = 0; i < h_queries.size(); ++i) {
+      h_expected[i] = dist(gen);
+      h_queries[i]  = h_renumber_map_labels[h_expected[i]];
+    }
+    if (h_queries.size() > 0) {
+      h_expected.back() = cugraph::invalid_vertex_id<vertex_t>::value;
+      h_queries.back()  = cugraph::invalid_vertex_id<vertex_t>::value;
+    }
+    rmm::device_uvector<vertex_t> d_queries(h_queries.size(), handle.get_stream());
+    raft::update_device(d_queries.data(), h_queries.data(), h_queries.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_results(d_queries.size(), handle.get_stream());
+
+    // existing path (a hash table is built on every call)
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("renumber_ext_vertices (hash table built per call)");
+    }
+
+    for (size_t i = 0; i < renumber_map_index_usecase.num_repetitions; ++i) {
+      raft::copy(d_results.data(), d_queries.data(), d_queries.size(), handle.get_stream());
+      cugraph::renumber_ext_vertices<vertex_t, false>(handle,
+                                                      d_results.data(),
+                                                      d_results.size(),
+                                                      (*d_renumber_map_labels).data(),
+                                                      vertex_t{0},
+                                                      graph_view.number_of_vertices());
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto h_hash_table_results = cugraph::test::to_host(handle, d_results);
+
+    // prebuilt index (copied to the device once)
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("renumber_ext_vertices (prebuilt index)");
+    }
+
+    rmm::device_uvector<vertex_t> d_index_slots(renumber_map.index_slots().size(),
+                                                handle.get_stream());
+    raft::update_device(d_index_slots.data(),
+                        renumber_map.index_slots().data(),
+                        renumber_map.index_slots().size(),
+                        handle.get_stream());
+    for (size_t i = 0; i < renumber_map_index_usecase.num_repetitions; ++i) {
+      raft::copy(d_results.data(), d_queries.data(), d_queries.size(), handle.get_stream());
+      cugraph::renumber_ext_vertices(
+        handle,
+        d_results.data(),
+        d_results.size(),
+        raft::device_span<vertex_t const>((*d_renumber_map_labels).data(),
+                                          (*d_renumber_map_labels).size()),
+        raft::device_span<vertex_t const>(d_index_slots.data(), d_index_slots.size()));
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto h_index_results = cugraph::test::to_host(handle, d_results);
+
+    // host look-ups on the memory-mapped file
+
+    if (cugraph::test::g_perf) { hr_timer.start("renumber_map_t::find (host)"); }
+
+    std::vector<vertex_t> h_host_results(h_queries.size());
+    for (size_t i = 0; i < renumber_map_index_usecase.num_repetitions; ++i) {
+      renumber_map.find(raft::host_span<vertex_t const>(h_queries.data(), h_queries.size()),
+                        raft::host_span<vertex_t>(h_host_results.data(), h_host_results.size()));
+    }
+
+    if (cugraph::test::g_perf) {
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (renumber_map_index_usecase.check_correctness) {
+      ASSERT_EQ(renumber_map.local_int_vertex_first(), vertex_t{0});
+      ASSERT_EQ(renumber_map.local_int_vertex_last(), graph_view.number_of_vertices());
+      ASSERT_TRUE(std::equal(h_renumber_map_labels.begin(),
+                             h_renumber_map_labels.end(),
+                             renumber_map.renumber_map_labels().begin(),
+                             renumber_map.renumber_map_labels().end()))
+        << "saved renumber map does not match with the input.";
+      ASSERT_EQ(h_hash_table_results, h_expected);
+      ASSERT_EQ(h_index_results, h_expected)
+        << "prebuilt index look-up results do not match with the expected values.";
+      ASSERT_EQ(h_host_results, h_expected)
+        << "host look-up results do not match with the expected values.";
+
+      // an index slot pointing past the labels is treated as empty when probed and detected on
+      // load with do_expensive_check (the index section is the last section of the file)
+      auto slots = renumber_map.index_slots();
+      auto it    = std::find_if(slots.begin(), slots.end(), [](auto pos) {
+        return pos != cugraph::invalid_vertex_id<vertex_t>::value;
+      });
+      ASSERT_TRUE(it != slots.end());
+      auto corrupted_label = h_renumber_map_labels[*it];
+      auto slot_offset =
+        std::filesystem::file_size(file_path) -
+        static_cast<size_t>(std::distance(it, slots.end())) * sizeof(vertex_t);
+      auto corrupted_pos = graph_view.number_of_vertices();
+      {
+        std::fstream file(file_path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(slot_offset);
+        file.write(reinterpret_cast<char const*>(&corrupted_pos), sizeof(corrupted_pos));
+      }
+      {
+        cugraph::renumber_map_t<vertex_t> corrupted_renumber_map(file_path);
+        ASSERT_EQ(corrupted_renumber_map.find(corrupted_label),
+                  cugraph::invalid_vertex_id<vertex_t>::value);
+      }
+      ASSERT_THROW((cugraph::renumber_map_t<vertex_t>{file_path, true}), cugraph::logic_error);
+    }
+  }
+};
+
+using Tests_RenumberMapIndex_File = Tests_RenumberMapIndex<cugraph::test::File_Usecase>;
+using Tests_RenumberMapIndex_Rmat = Tests_RenumberMapIndex<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_RenumberMapIndex_File, CheckInt32Int32)
+{
+  auto param = override_File_Usecase_with_cmd_line_arguments(GetParam());
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_RenumberMapIndex_Rmat, CheckInt32Int32)
+{
+  auto param = override_Rmat_Usecase_with_cmd_line_arguments(GetParam());
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_RenumberMapIndex_Rmat, CheckInt64Int64)
+{
+  auto param = override_Rmat_Usecase_with_cmd_line_arguments(GetParam());
+  run_current_test<int64_t, int64_t>(std::get<0>(param), std::get<1>(param));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_RenumberMapIndex_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(RenumberMapIndex_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/webbase-1M.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_RenumberMapIndex_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(RenumberMapIndex_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_RenumberMapIndex_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs, repeated query batches
+    ::testing::Values(RenumberMapIndex_Usecase{size_t{1} << 24, 10, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// sequential reference reader
+template <typename vertex_t, typename weight_t>
+std::vector<std::tuple<vertex_t, vertex_t, weight_t>> read_snap_file_reference(
+  std::string const& graph_file_full_path, bool drop_self_loops, bool drop_multi_edges)
+{
+  std::ifstream file(graph_file_full_path);
+  std::string line{};
+
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges{};
+  while (std::getline(file, line)) {
+    auto first = line.find_first_not_of(" \t\r");
+    if ((first == std::string::npos) || (line[first] == '#') || (line[first] == '%')) { continue; }
+    std::istringstream iss(line);
+    int64_t src{}, dst{};
+    double w{0.0};
+    iss >> src >> dst;
+    iss >> w;
+    if (drop_self_loops && (src == dst)) { continue; }
+    edges.emplace_back(
+      static_cast<vertex_t>(src), static_cast<vertex_t>(dst), static_cast<weight_t>(w));
+  }
+
+  if (drop_multi_edges) {
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(),
+                            edges.end(),
+                            [](auto const& lhs, auto const& rhs) {
+                              return (std::get<0>(lhs) == std::get<0>(rhs)) &&
+                                     (std::get<1>(lhs) == std::get<1>(rhs));
+                            }),
+                edges.end());
+  }
+
+  return edges;
+}
+
+// write a SNAP style file (a '#' comment header followed by tab separated edges) with num_edges
+// random edges (vertex IDs in [0, num_vertices)), about 1% of the edges are self-loops and about
+// 10% of the edges repeat an earlier edge (with a different weight if weighted)
+void generate_synthetic_snap_file(std::string const& file_path,
+                                  size_t num_vertices,
+                                  size_t num_edges,
+                                  bool weighted,
+                                  uint64_t seed)
+{
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int64_t> vertex_dist(0, static_cast<int64_t>(num_vertices) - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 1.0);
+  std::uniform_int_distribution<int> kind_dist(0, 99);
+
+  std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+  file << "# Directed graph (each unordered pair of nodes is saved once): synthetic.txt\n";
+  file << "# Synthetic SNAP style edge list\n";
+  file << "# Nodes: " << num_vertices << " Edges: " << num_edges << "\n";
+  file << "# FromNodeId\tToNodeId\n";
+
+  std::vector<char> buffer(size_t{1} << 20);
+  size_t size{0};
+  int64_t last_src{0};
+  int64_t last_dst{1};
+  for (size_t i = 0; i < num_edges; ++i) {
+    if (buffer.size() - size < 64) {
+      file.write(buffer.data(), size);
+      size = 0;
+    }
+    auto kind = kind_dist(gen);
+    int64_t src{};
+    int64_t dst{};
+    if ((kind < 10) && (i > 0)) {  // multi-edge
+      src = last_src;
+      dst = last_dst;
+    } else {
+      src = vertex_dist(gen);
+      dst = (kind == 10) ? src /* self-loop */ : vertex_dist(gen);
+    }
+    if (weighted) {
+      size += std::snprintf(buffer.data() + size,
+                            buffer.size() - size,
+                            "%lld\t%lld\t%.6f\n",
+                            static_cast<long long>(src),
+                            static_cast<long long>(dst),
+                            weight_dist(gen));
+    } else {
+      size += std::snprintf(buffer.data() + size,
+                            buffer.size() - size,
+                            "%lld\t%lld\n",
+                            static_cast<long long>(src),
+                            static_cast<long long>(dst));
+    }
+    if (kind % 16 == 0) {  // comments in the middle of the file (e.g. concatenated files)
+      size += std::snprintf(buffer.data() + size, buffer.size() - size, "# comment\n");
+    }
+    last_src = src;
+    last_dst = dst;
+  }
+  file.write(buffer.data(), size);
+}
+
+constexpr size_t max_num_synthetic_edges_wo_perf = size_t{1} << 22;
+
+struct SnapParser_Usecase {
+  size_t num_threads{0};  // 0: use all the available cores
+  bool drop_self_loops{false};
+  bool drop_multi_edges{false};
+  bool check_correctness{true};
+};
+
+struct SnapInput_Usecase {
+  size_t num_vertices{0};
+  size_t num_edges{0};
+  bool weighted{false};
+};
+
+class Tests_SnapParser
+  : public ::testing::TestWithParam<std::tuple<SnapParser_Usecase, SnapInput_Usecase>> {
+ public:
+  Tests_SnapParser() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename weight_t>
+  void run_current_test(SnapParser_Usecase const& parser_usecase,
+                        SnapInput_Usecase const& input_usecase)
+  {
+    auto file_path = (std::filesystem::temp_directory_path() /
+                      ("cugraph_snap_parser_test_" + std::to_string(::getpid()) + ".txt"))
+                       .string();
+    cugraph::test::temporary_file_guard_t file_guard(file_path);
+    // the multi-GB synthetic inputs are generated only in benchmarking (with --perf)
+    auto num_edges = cugraph::test::g_perf
+                       ? input_usecase.num_edges
+                       : std::min(input_usecase.num_edges, max_num_synthetic_edges_wo_perf);
+    generate_synthetic_snap_file(
+      file_path, input_usecase.num_vertices, num_edges, input_usecase.weighted, 0);
+    auto file_bytes = std::filesystem::file_size(file_path);
+
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) { hr_timer.start("Parse SNAP file"); }
+
+    auto [h_srcs, h_dsts, h_weights] =
+      cugraph::test::read_edgelist_from_snap_file_to_host<vertex_t, weight_t>(
+        file_path,
+        input_usecase.weighted,
+        parser_usecase.drop_self_loops,
+        parser_usecase.drop_multi_edges,
+        parser_usecase.num_threads);
+
+    if (cugraph::test::g_perf) {
+      auto elapsed = hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "SNAP parser throughput: "
+                << (static_cast<double>(file_bytes) / (1024.0 * 1024.0)) / elapsed << " MB/s ("
+                << h_srcs.size() << " edges)." << std::endl;
+    }
+
+    if (parser_usecase.check_correctness) {
+      auto reference_edges = read_snap_file_reference<vertex_t, weight_t>(
+        file_path, parser_usecase.drop_self_loops, parser_usecase.drop_multi_edges);
+
+      ASSERT_EQ(h_weights.has_value(), input_usecase.weighted);
+      ASSERT_EQ(h_srcs.size(), reference_edges.size());
+      ASSERT_EQ(h_dsts.size(), reference_edges.size());
+      for (size_t i = 0; i < reference_edges.size(); ++i) {
+        ASSERT_EQ(h_srcs[i], std::get<0>(reference_edges[i])) << "edge " << i << ".";
+        ASSERT_EQ(h_dsts[i], std::get<1>(reference_edges[i])) << "edge " << i << ".";
+        if (h_weights) {
+          ASSERT_EQ((*h_weights)[i], std::get<2>(reference_edges[i])) << "edge " << i << ".";
+        }
+      }
+
+      // registered as a File_Usecase extension
+      raft::handle_t handle{};
+      auto [d_srcs, d_dsts, d_weights, d_vertices, is_symmetric] =
+        cugraph::test::File_Usecase(
+          file_path, 0, parser_usecase.drop_self_loops, parser_usecase.drop_multi_edges)
+          .template construct_edgelist<vertex_t, weight_t>(
+            handle, input_usecase.weighted, false, false);
+      ASSERT_EQ(d_srcs.size(), reference_edges.size());
+      ASSERT_FALSE(d_vertices.has_value());
+    }
+  }
+};
+
+TEST_P(Tests_SnapParser, CheckInt32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SnapParser, CheckInt64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, double>(std::get<0>(param), std::get<1>(param));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  synthetic_test,
+  Tests_SnapParser,
+  ::testing::Combine(
+    // enable correctness checks, test both the single-threaded and the multi-threaded (with an odd
+    // number of chunks to merge) paths
+    ::testing::Values(SnapParser_Usecase{1, false, false},
+                      SnapParser_Usecase{7, false, false},
+                      SnapParser_Usecase{1, true, true},
+                      SnapParser_Usecase{7, true, false},
+                      SnapParser_Usecase{7, false, true},
+                      SnapParser_Usecase{7, true, true}),
+    ::testing::Values(SnapInput_Usecase{1024, 16384, false},
+                      SnapInput_Usecase{1024, 16384, true},
+                      SnapInput_Usecase{size_t{1} << 20, size_t{1} << 22, true})));
+
+INSTANTIATE_TEST_SUITE_P(
+  synthetic_benchmark_test, /* multi-GB synthetic inputs (capped to 2^22 edges without --perf) */
+  Tests_SnapParser,
+  ::testing::Combine(
+    // disable correctness checks for large inputs
+    ::testing::Values(SnapParser_Usecase{0, false, false, false},
+                      SnapParser_Usecase{0, true, true, false}),
+    ::testing::Values(SnapInput_Usecase{size_t{1} << 26, size_t{1} << 28, false} /* ~5 GB */)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// exact number of vertices within k hops of each vertex (including the vertex itself)
+template <typename vertex_t, typename edge_t>
+std::vector<size_t> k_hop_nbr_counts_reference(edge_t const* offsets,
+                                               vertex_t const* indices,
+                                               vertex_t num_vertices,
+                                               size_t k)
+{
+  std::vector<size_t> counts(num_vertices, 0);
+  std::vector<size_t> hops(num_vertices, std::numeric_limits<size_t>::max());
+  std::vector<vertex_t> touched{};
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    std::vector<vertex_t> frontier{s};
+    hops[s] = 0;
+    touched.push_back(s);
+    for (size_t iter = 0; iter < k; ++iter) {
+      std::vector<vertex_t> new_frontier{};
+      for (auto v : frontier) {
+        for (edge_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+          auto nbr = indices[j];
+          if (hops[nbr] == std::numeric_limits<size_t>::max()) {
+            hops[nbr] = iter + 1;
+            touched.push_back(nbr);
+            new_frontier.push_back(nbr);
+          }
+        }
+      }
+      if (new_frontier.size() == 0) { break; }
+      std::swap(frontier, new_frontier);
+    }
+    counts[s] = touched.size();
+    for (auto v : touched) {
+      hops[v] = std::numeric_limits<size_t>::max();
+    }
+    touched.clear();
+  }
+
+  return counts;
+}
+
+struct ApproximateKHopNbrCounts_Usecase {
+  size_t k{0};
+  size_t log2_num_registers{12};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ApproximateKHopNbrCounts
+  : public ::testing::TestWithParam<std::tuple<ApproximateKHopNbrCounts_Usecase, input_usecase_t>> {
+ public:
+  Tests_ApproximateKHopNbrCounts() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(ApproximateKHopNbrCounts_Usecase const& approximate_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::tie(graph, std::ignore, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Approximate k-hop neighbor counts");
+    }
+
+    auto [d_estimates, neighborhood_function, effective_diameter] =
+      cugraph::approximate_k_hop_nbr_counts(
+        handle, graph_view, approximate_usecase.k, approximate_usecase.log2_num_registers);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(neighborhood_function.size(), approximate_usecase.k + 1)
+      << "the neighborhood function should have k + 1 entries.";
+    ASSERT_TRUE(std::is_sorted(neighborhood_function.begin(), neighborhood_function.end()))
+      << "the neighborhood function should be non-decreasing.";
+    ASSERT_TRUE((effective_diameter >= 0.0) &&
+                (effective_diameter <= static_cast<double>(approximate_usecase.k)))
+      << "the effective diameter should be in [0, k].";
+
+    if (approximate_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      auto h_estimates = cugraph::test::to_host(handle, d_estimates);
+
+      // the standard error of a HyperLogLog estimate is about 1.04 / sqrt(# registers)
+      auto relative_tolerance =
+        8.0 * 1.04 / std::sqrt(static_cast<double>(size_t{1}
+                                                   << approximate_usecase.log2_num_registers));
+
+      double reference_total{0.0};
+      for (size_t hop = 0; hop <= approximate_usecase.k; ++hop) {
+        auto h_reference_counts = k_hop_nbr_counts_reference(
+          h_offsets.data(), h_indices.data(), graph_view.number_of_vertices(), hop);
+        reference_total = 0.0;
+        for (auto count : h_reference_counts) {
+          reference_total += static_cast<double>(count);
+        }
+        ASSERT_TRUE(std::abs(neighborhood_function[hop] - reference_total) <=
+                    relative_tolerance * reference_total)
+          << "the neighborhood function at hop " << hop << " (" << neighborhood_function[hop]
+          << ") is too far from the exact value (" << reference_total << ").";
+
+        if (hop == approximate_usecase.k) {
+          for (size_t i = 0; i < h_reference_counts.size(); ++i) {
+            auto reference = static_cast<double>(h_reference_counts[i]);
+            ASSERT_TRUE(std::abs(h_estimates[i] - reference) <= relative_tolerance * reference)
+              << "the estimate for vertex " << i << " (" << h_estimates[i]
+              << ") is too far from the exact value (" << reference << ").";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_ApproximateKHopNbrCounts_File =
+  Tests_ApproximateKHopNbrCounts<cugraph::test::File_Usecase>;
+using Tests_ApproximateKHopNbrCounts_Rmat =
+  Tests_ApproximateKHopNbrCounts<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ApproximateKHopNbrCounts_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ApproximateKHopNbrCounts_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ApproximateKHopNbrCounts_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ApproximateKHopNbrCounts_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ApproximateKHopNbrCounts_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(ApproximateKHopNbrCounts_Usecase{5},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(ApproximateKHopNbrCounts_Usecase{4, 8},
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
+    std::make_tuple(ApproximateKHopNbrCounts_Usecase{3},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ApproximateKHopNbrCounts_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(ApproximateKHopNbrCounts_Usecase{3},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ApproximateKHopNbrCounts_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(ApproximateKHopNbrCounts_Usecase{4, 6, false},
+                    cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
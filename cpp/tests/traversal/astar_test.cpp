@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/distance_oracle.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// Dijkstra's algorithm
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<weight_t> distance_reference(edge_t const* offsets,
+                                         vertex_t const* indices,
+                                         weight_t const* weights,
+                                         vertex_t num_vertices,
+                                         vertex_t source)
+{
+  using queue_item_t = std::tuple<weight_t, vertex_t>;
+
+  std::vector<weight_t> distances(num_vertices, std::numeric_limits<weight_t>::max());
+
+  distances[source] = weight_t{0.0};
+  std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>> queue{};
+  queue.push(std::make_tuple(weight_t{0.0}, source));
+
+  while (queue.size() > 0) {
+    weight_t distance{};
+    vertex_t row{};
+    std::tie(distance, row) = queue.top();
+    queue.pop();
+    if (distance > distances[row]) { continue; }
+    for (auto nbr_offset = offsets[row]; nbr_offset != offsets[row + 1]; ++nbr_offset) {
+      auto nbr          = indices[nbr_offset];
+      auto new_distance = distance + weights[nbr_offset];
+      if (new_distance < distances[nbr]) {
+        distances[nbr] = new_distance;
+        queue.push(std::make_tuple(new_distance, nbr));
+      }
+    }
+  }
+
+  return distances;
+}
+
+enum class astar_heuristic_t {
+  ZERO = 0,    // plain Near-Far search with early termination
+  HALF_EXACT,  // half the exact distance to the destination (admissible and consistent)
+  LANDMARK     // landmark lower bounds (ALT)
+};
+
+struct AStar_Usecase {
+  size_t num_queries{0};
+  astar_heuristic_t heuristic{astar_heuristic_t::ZERO};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_AStar : public ::testing::TestWithParam<std::tuple<AStar_Usecase, input_usecase_t>> {
+ public:
+  Tests_AStar() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(AStar_Usecase const& astar_usecase, input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+
+    auto graph_view       = graph.view();
+    auto edge_weight_view = (*edge_weights).view();
+    auto num_vertices     = graph_view.number_of_vertices();
+
+    auto h_offsets =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+    auto h_indices =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+    auto h_weights = cugraph::test::to_host(
+      handle,
+      raft::device_span<weight_t const>(edge_weight_view.value_firsts()[0],
+                                        edge_weight_view.edge_counts()[0]));
+
+    // the reversed graph (on host) to compute the exact distances to a destination
+
+    std::vector<edge_t> h_reversed_offsets(num_vertices + 1, edge_t{0});
+    std::vector<vertex_t> h_reversed_indices(h_indices.size());
+    std::vector<weight_t> h_reversed_weights(h_weights.size());
+    if (astar_usecase.heuristic == astar_heuristic_t::HALF_EXACT) {
+      for (auto dst : h_indices) {
+        ++h_reversed_offsets[dst + 1];
+      }
+      std::partial_sum(
+        h_reversed_offsets.begin(), h_reversed_offsets.end(), h_reversed_offsets.begin());
+      auto insert_positions = h_reversed_offsets;
+      for (vertex_t src = 0; src < num_vertices; ++src) {
+        for (auto i = h_offsets[src]; i < h_offsets[src + 1]; ++i) {
+          auto pos                = insert_positions[h_indices[i]]++;
+          h_reversed_indices[pos] = src;
+          h_reversed_weights[pos] = h_weights[i];
+        }
+      }
+    }
+
+    std::optional<cugraph::landmark_distance_index_t<vertex_t, weight_t>> index{std::nullopt};
+    if (astar_usecase.heuristic == astar_heuristic_t::LANDMARK) {
+      raft::random::RngState rng_state(0);
+      index = cugraph::build_landmark_distance_index(
+        handle,
+        graph_view,
+        std::make_optional(edge_weight_view),
+        std::min(size_t{16}, static_cast<size_t>(num_vertices)),
+        cugraph::landmark_selection_t::HIGHEST_DEGREE,
+        rng_state);
+    }
+
+    std::vector<vertex_t> h_srcs(astar_usecase.num_queries);
+    std::vector<vertex_t> h_dsts(astar_usecase.num_queries);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, num_vertices - 1);
+    std::generate(h_srcs.begin(), h_srcs.end(), [&gen, &dist]() { return dist(gen); });
+    std::generate(h_dsts.begin(), h_dsts.end(), [&gen, &dist]() { return dist(gen); });
+
+    std::vector<weight_t> h_distances(h_srcs.size());
+    std::vector<std::vector<vertex_t>> h_paths(h_srcs.size());
+    rmm::device_uvector<weight_t> d_heuristic_values(num_vertices, handle.get_stream());
+
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      if (astar_usecase.heuristic == astar_heuristic_t::ZERO) {
+        std::vector<weight_t> h_heuristic_values(num_vertices, weight_t{0.0});
+        raft::update_device(
+          d_heuristic_values.data(), h_heuristic_values.data(), num_vertices, handle.get_stream());
+      } else if (astar_usecase.heuristic == astar_heuristic_t::HALF_EXACT) {
+        auto h_heuristic_values = distance_reference(h_reversed_offsets.data(),
+                                                     h_reversed_indices.data(),
+                                                     h_reversed_weights.data(),
+                                                     num_vertices,
+                                                     h_dsts[i]);
+        std::transform(h_heuristic_values.begin(),
+                       h_heuristic_values.end(),
+                       h_heuristic_values.begin(),
+                       [](auto d) {
+                         return d != std::numeric_limits<weight_t>::max() ? d * weight_t{0.5} : d;
+                       });
+        raft::update_device(
+          d_heuristic_values.data(), h_heuristic_values.data(), num_vertices, handle.get_stream());
+      }
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("A* (excluding the heuristic set-up)");
+      }
+
+      rmm::device_uvector<vertex_t> d_path(0, handle.get_stream());
+      if (index) {
+        std::tie(h_distances[i], d_path) =
+          cugraph::astar(handle, graph_view, edge_weight_view, *index, h_srcs[i], h_dsts[i]);
+      } else {
+        std::tie(h_distances[i], d_path) = cugraph::astar(
+          handle,
+          graph_view,
+          edge_weight_view,
+          raft::device_span<weight_t const>(d_heuristic_values.data(), d_heuristic_values.size()),
+          h_srcs[i],
+          h_dsts[i]);
+      }
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+      }
+
+      if (astar_usecase.check_correctness) { h_paths[i] = cugraph::test::to_host(handle, d_path); }
+    }
+
+    if (cugraph::test::g_perf) {
+      hr_timer.display_and_clear(std::cout);
+
+      // baseline: sssp with the cutoff set to the distance found (the best case for sssp)
+      rmm::device_uvector<weight_t> d_tmp_distances(num_vertices, handle.get_stream());
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("SSSP with cutoff per query");
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        cugraph::sssp(
+          handle,
+          graph_view,
+          edge_weight_view,
+          d_tmp_distances.data(),
+          static_cast<vertex_t*>(nullptr),
+          h_srcs[i],
+          h_distances[i] != std::numeric_limits<weight_t>::max()
+            ? std::nextafter(h_distances[i], std::numeric_limits<weight_t>::max())
+            : std::numeric_limits<weight_t>::max());
+      }
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (astar_usecase.check_correctness) {
+      auto max_weight   = *std::max_element(h_weights.begin(), h_weights.end());
+      auto nearly_equal = [epsilon = max_weight * weight_t{1e-4}](auto lhs, auto rhs) {
+        return std::fabs(lhs - rhs) <= epsilon * std::max(weight_t{1.0}, std::fabs(rhs));
+      };
+
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto h_reference_distances = distance_reference(
+          h_offsets.data(), h_indices.data(), h_weights.data(), num_vertices, h_srcs[i]);
+        auto reference_distance = h_reference_distances[h_dsts[i]];
+
+        if (reference_distance == std::numeric_limits<weight_t>::max()) {
+          ASSERT_TRUE(h_distances[i] == std::numeric_limits<weight_t>::max())
+            << "vertex " << h_dsts[i] << " should be unreachable from vertex " << h_srcs[i] << ".";
+          ASSERT_TRUE(h_paths[i].empty()) << "an unreachable pair should have an empty path.";
+          continue;
+        }
+        ASSERT_TRUE(nearly_equal(h_distances[i], reference_distance))
+          << "distance from vertex " << h_srcs[i] << " to vertex " << h_dsts[i]
+          << " does not match with the reference value.";
+
+        auto const& path = h_paths[i];
+        ASSERT_TRUE((path.size() > 0) && (path.front() == h_srcs[i]) &&
+                    (path.back() == h_dsts[i]))
+          << "path does not connect vertex " << h_srcs[i] << " to vertex " << h_dsts[i] << ".";
+        weight_t path_length{0.0};
+        for (size_t j = 0; j + 1 < path.size(); ++j) {
+          auto edge_length = std::numeric_limits<weight_t>::max();
+          for (auto k = h_offsets[path[j]]; k < h_offsets[path[j] + 1]; ++k) {
+            if (h_indices[k] == path[j + 1]) { edge_length = std::min(edge_length, h_weights[k]); }
+          }
+          ASSERT_TRUE(edge_length != std::numeric_limits<weight_t>::max())
+            << "no edge from vertex " << path[j] << " to vertex " << path[j + 1] << ".";
+          path_length += edge_length;
+        }
+        ASSERT_TRUE(nearly_equal(path_length, reference_distance))
+          << "path length from vertex " << h_srcs[i] << " to vertex " << h_dsts[i]
+          << " does not match with the reference value.";
+      }
+    }
+  }
+};
+
+using Tests_AStar_File = Tests_AStar<cugraph::test::File_Usecase>;
+using Tests_AStar_Rmat = Tests_AStar<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_AStar_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_AStar_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_AStar_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_AStar_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(AStar_Usecase{32, astar_heuristic_t::ZERO},
+                      AStar_Usecase{32, astar_heuristic_t::HALF_EXACT},
+                      AStar_Usecase{32, astar_heuristic_t::LANDMARK}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dblp.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_AStar_Rmat,
+  ::testing::Combine(
+    // enable correctness checks (directed graphs)
+    ::testing::Values(AStar_Usecase{32, astar_heuristic_t::ZERO},
+                      AStar_Usecase{32, astar_heuristic_t::HALF_EXACT},
+                      AStar_Usecase{32, astar_heuristic_t::LANDMARK}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_AStar_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(AStar_Usecase{16, astar_heuristic_t::ZERO, false},
+                      AStar_Usecase{16, astar_heuristic_t::LANDMARK, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/host_traversal.hpp>
 #include <cugraph/utilities/high_res_timer.hpp>
 
 #include <raft/core/handle.hpp>
@@ -38,49 +39,10 @@
 #include <limits>
 #include <vector>
 
-template <typename vertex_t, typename edge_t>
-void bfs_reference(edge_t const* offsets,
-                   vertex_t const* indices,
-                   vertex_t* distances,
-                   vertex_t* predecessors,
-                   vertex_t num_vertices,
-                   vertex_t source,
-                   vertex_t depth_limit = std::numeric_limits<vertex_t>::max())
-{
-  vertex_t depth{0};
-
-  std::fill(distances, distances + num_vertices, std::numeric_limits<vertex_t>::max());
-  std::fill(predecessors, predecessors + num_vertices, cugraph::invalid_vertex_id<vertex_t>::value);
-
-  *(distances + source) = depth;
-  std::vector<vertex_t> cur_frontier_rows{source};
-  std::vector<vertex_t> new_frontier_rows{};
-
-  while (cur_frontier_rows.size() > 0) {
-    for (auto const row : cur_frontier_rows) {
-      auto nbr_offset_first = *(offsets + row);
-      auto nbr_offset_last  = *(offsets + row + 1);
-      for (auto nbr_offset = nbr_offset_first; nbr_offset != nbr_offset_last; ++nbr_offset) {
-        auto nbr = *(indices + nbr_offset);
-        if (*(distances + nbr) == std::numeric_limits<vertex_t>::max()) {
-          *(distances + nbr)    = depth + 1;
-          *(predecessors + nbr) = row;
-          new_frontier_rows.push_back(nbr);
-        }
-      }
-    }
-    std::swap(cur_frontier_rows, new_frontier_rows);
-    new_frontier_rows.clear();
-    ++depth;
-    if (depth >= depth_limit) { break; }
-  }
-
-  return;
-}
-
 struct BFS_Usecase {
   size_t source{0};
   bool check_correctness{true};
+  bool direction_optimizing{false};  // valid only for symmetric input graphs
 };
 
 template <typename input_usecase_t>
@@ -143,13 +105,27 @@ class Tests_BFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, input_
                  d_predecessors.data(),
                  d_source.data(),
                  size_t{1},
-                 false,
+                 bfs_usecase.direction_optimizing,
                  std::numeric_limits<vertex_t>::max());
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
-      hr_timer.stop();
+      auto elapsed = hr_timer.stop();
       hr_timer.display_and_clear(std::cout);
+
+      // traversed edges: the edges of the reached vertices
+      auto h_distances   = cugraph::test::to_host(handle, d_distances);
+      auto h_out_degrees = cugraph::test::to_host(handle, graph_view.compute_out_degrees(handle));
+      edge_t num_traversed_edges{0};
+      for (size_t i = 0; i < h_distances.size(); ++i) {
+        if (h_distances[i] != std::numeric_limits<vertex_t>::max()) {
+          num_traversed_edges += h_out_degrees[i];
+        }
+      }
+      std::cout << "BFS (direction_optimizing=" << bfs_usecase.direction_optimizing
+                << ") traversed " << num_traversed_edges << " edges, "
+                << static_cast<double>(num_traversed_edges) / elapsed * 1e-9 << " GTEPS."
+                << std::endl;
     }
 
     if (bfs_usecase.check_correctness) {
@@ -175,13 +151,14 @@ class Tests_BFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, input_
       std::vector<vertex_t> h_reference_distances(unrenumbered_graph_view.number_of_vertices());
       std::vector<vertex_t> h_reference_predecessors(unrenumbered_graph_view.number_of_vertices());
 
-      bfs_reference(h_offsets.data(),
-                    h_indices.data(),
-                    h_reference_distances.data(),
-                    h_reference_predecessors.data(),
-                    unrenumbered_graph_view.number_of_vertices(),
-                    unrenumbered_source,
-                    std::numeric_limits<vertex_t>::max());
+      cugraph::host::bfs(h_offsets.data(),
+                         h_indices.data(),
+                         unrenumbered_graph_view.number_of_vertices(),
+                         h_reference_distances.data(),
+                         h_reference_predecessors.data(),
+                         &unrenumbered_source,
+                         size_t{1},
+                         std::numeric_limits<vertex_t>::max());
 
       std::vector<vertex_t> h_cugraph_distances{};
       std::vector<vertex_t> h_cugraph_predecessors{};
@@ -275,7 +252,14 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(BFS_Usecase{100}, cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
     std::make_tuple(BFS_Usecase{1000}, cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
     std::make_tuple(BFS_Usecase{1000},
-                    cugraph::test::File_Usecase("test/datasets/wiki-Talk.mtx"))));
+                    cugraph::test::File_Usecase("test/datasets/wiki-Talk.mtx")),
+    // direction optimizing BFS (symmetric inputs only)
+    std::make_tuple(BFS_Usecase{0, true, true},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(BFS_Usecase{0, true, true},
+                    cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
+    std::make_tuple(BFS_Usecase{100, true, true},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
@@ -283,7 +267,9 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     // enable correctness checks
     std::make_tuple(BFS_Usecase{0},
-                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(BFS_Usecase{0, true, true},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
@@ -295,6 +281,8 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     // disable correctness checks for large graphs
     std::make_pair(BFS_Usecase{0, false},
-                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_pair(BFS_Usecase{0, false, true},
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// Dijkstra's algorithm (unit edge weights if weights is nullptr)
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<weight_t> distance_reference(edge_t const* offsets,
+                                         vertex_t const* indices,
+                                         weight_t const* weights,
+                                         vertex_t num_vertices,
+                                         vertex_t source)
+{
+  using queue_item_t = std::tuple<weight_t, vertex_t>;
+
+  std::vector<weight_t> distances(num_vertices, std::numeric_limits<weight_t>::max());
+
+  distances[source] = weight_t{0.0};
+  std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>> queue{};
+  queue.push(std::make_tuple(weight_t{0.0}, source));
+
+  while (queue.size() > 0) {
+    weight_t distance{};
+    vertex_t row{};
+    std::tie(distance, row) = queue.top();
+    queue.pop();
+    if (distance > distances[row]) { continue; }
+    for (auto nbr_offset = offsets[row]; nbr_offset != offsets[row + 1]; ++nbr_offset) {
+      auto nbr          = indices[nbr_offset];
+      auto new_distance = distance + (weights != nullptr ? weights[nbr_offset] : weight_t{1.0});
+      if (new_distance < distances[nbr]) {
+        distances[nbr] = new_distance;
+        queue.push(std::make_tuple(new_distance, nbr));
+      }
+    }
+  }
+
+  return distances;
+}
+
+struct BidirectionalSearch_Usecase {
+  size_t num_queries{0};
+  bool weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BidirectionalSearch
+  : public ::testing::TestWithParam<std::tuple<BidirectionalSearch_Usecase, input_usecase_t>> {
+ public:
+  Tests_BidirectionalSearch() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(BidirectionalSearch_Usecase const& search_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, search_usecase.weighted, false);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    auto num_vertices = graph_view.number_of_vertices();
+
+    // the backward searches of a directed graph run on the reversed graph
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> reversed_graph(handle);
+    std::optional<
+      cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+      reversed_edge_weights{std::nullopt};
+    if (!graph_view.is_symmetric()) {
+      auto [d_srcs, d_dsts, d_weights] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        edge_weight_view,
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+
+      std::vector<vertex_t> h_vertices(num_vertices);
+      std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+      rmm::device_uvector<vertex_t> d_vertices(h_vertices.size(), handle.get_stream());
+      raft::update_device(
+        d_vertices.data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+
+      std::tie(reversed_graph, reversed_edge_weights, std::ignore, std::ignore, std::ignore) =
+        cugraph::
+          create_graph_from_edgelist<vertex_t, edge_t, weight_t, edge_t, int32_t, false, false>(
+            handle,
+            std::make_optional(std::move(d_vertices)),
+            std::move(d_dsts),
+            std::move(d_srcs),
+            std::move(d_weights),
+            std::nullopt,
+            std::nullopt,
+            cugraph::graph_properties_t{false, graph_view.is_multigraph()},
+            false);
+    }
+    auto reversed_graph_view =
+      graph_view.is_symmetric()
+        ? std::nullopt
+        : std::make_optional<cugraph::graph_view_t<vertex_t, edge_t, false, false>>(
+            reversed_graph.view());
+    auto reversed_edge_weight_view =
+      reversed_edge_weights
+        ? std::make_optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>(
+            (*reversed_edge_weights).view())
+        : std::nullopt;
+
+    // query pairs may repeat and may have the same source and destination
+
+    std::vector<vertex_t> h_srcs(search_usecase.num_queries);
+    std::vector<vertex_t> h_dsts(search_usecase.num_queries);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, num_vertices - 1);
+    std::generate(h_srcs.begin(), h_srcs.end(), [&gen, &dist]() { return dist(gen); });
+    std::generate(h_dsts.begin(), h_dsts.end(), [&gen, &dist]() { return dist(gen); });
+
+    std::vector<weight_t> h_distances(h_srcs.size());
+    std::vector<std::vector<vertex_t>> h_paths(h_srcs.size());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Bidirectional search");
+    }
+
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      rmm::device_uvector<vertex_t> d_path(0, handle.get_stream());
+      if (search_usecase.weighted) {
+        std::tie(h_distances[i], d_path) = cugraph::bidirectional_sssp(handle,
+                                                                       graph_view,
+                                                                       *edge_weight_view,
+                                                                       reversed_graph_view,
+                                                                       reversed_edge_weight_view,
+                                                                       h_srcs[i],
+                                                                       h_dsts[i]);
+      } else {
+        vertex_t hops{};
+        std::tie(hops, d_path) = cugraph::bidirectional_bfs(
+          handle, graph_view, reversed_graph_view, h_srcs[i], h_dsts[i]);
+        h_distances[i] = hops != std::numeric_limits<vertex_t>::max()
+                           ? static_cast<weight_t>(hops)
+                           : std::numeric_limits<weight_t>::max();
+      }
+      if (search_usecase.check_correctness) { h_paths[i] = cugraph::test::to_host(handle, d_path); }
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+
+      // baseline: one single-source search per query
+      rmm::device_uvector<weight_t> d_tmp_distances(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_tmp_hops(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_src(1, handle.get_stream());
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start(search_usecase.weighted ? "SSSP per query" : "BFS per query");
+      for (auto src : h_srcs) {
+        if (search_usecase.weighted) {
+          cugraph::sssp(handle,
+                        graph_view,
+                        *edge_weight_view,
+                        d_tmp_distances.data(),
+                        static_cast<vertex_t*>(nullptr),
+                        src);
+        } else {
+          raft::update_device(d_src.data(), &src, size_t{1}, handle.get_stream());
+          cugraph::bfs(handle,
+                       graph_view,
+                       d_tmp_hops.data(),
+                       static_cast<vertex_t*>(nullptr),
+                       d_src.data(),
+                       size_t{1});
+        }
+      }
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (search_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      std::vector<weight_t> h_weights{};
+      if (edge_weight_view) {
+        h_weights = cugraph::test::to_host(
+          handle,
+          raft::device_span<weight_t const>((*edge_weight_view).value_firsts()[0],
+                                            (*edge_weight_view).edge_counts()[0]));
+      }
+      auto h_weight_ptr = search_usecase.weighted ? h_weights.data() : nullptr;
+
+      auto max_weight = h_weight_ptr != nullptr
+                          ? *std::max_element(h_weights.begin(), h_weights.end())
+                          : weight_t{1.0};
+      auto nearly_equal = [epsilon = max_weight * weight_t{1e-4}](auto lhs, auto rhs) {
+        return std::fabs(lhs - rhs) <= epsilon * std::max(weight_t{1.0}, std::fabs(rhs));
+      };
+
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto h_reference_distances = distance_reference(
+          h_offsets.data(), h_indices.data(), h_weight_ptr, num_vertices, h_srcs[i]);
+        auto reference_distance = h_reference_distances[h_dsts[i]];
+
+        if (reference_distance == std::numeric_limits<weight_t>::max()) {
+          ASSERT_TRUE(h_distances[i] == std::numeric_limits<weight_t>::max())
+            << "vertex " << h_dsts[i] << " should be unreachable from vertex " << h_srcs[i] << ".";
+          ASSERT_TRUE(h_paths[i].empty()) << "an unreachable pair should have an empty path.";
+          continue;
+        }
+        ASSERT_TRUE(nearly_equal(h_distances[i], reference_distance))
+          << "distance from vertex " << h_srcs[i] << " to vertex " << h_dsts[i]
+          << " does not match with the reference value.";
+
+        // the path should follow the graph edges from the source to the destination and have the
+        // returned length
+        auto const& path = h_paths[i];
+        ASSERT_TRUE((path.size() > 0) && (path.front() == h_srcs[i]) &&
+                    (path.back() == h_dsts[i]))
+          << "path does not connect vertex " << h_srcs[i] << " to vertex " << h_dsts[i] << ".";
+        weight_t path_length{0.0};
+        for (size_t j = 0; j + 1 < path.size(); ++j) {
+          auto edge_length = std::numeric_limits<weight_t>::max();
+          for (auto k = h_offsets[path[j]]; k < h_offsets[path[j] + 1]; ++k) {
+            if (h_indices[k] == path[j + 1]) {
+              edge_length =
+                std::min(edge_length, h_weight_ptr != nullptr ? h_weights[k] : weight_t{1.0});
+            }
+          }
+          ASSERT_TRUE(edge_length != std::numeric_limits<weight_t>::max())
+            << "no edge from vertex " << path[j] << " to vertex " << path[j + 1] << ".";
+          path_length += edge_length;
+        }
+        ASSERT_TRUE(nearly_equal(path_length, reference_distance))
+          << "path length from vertex " << h_srcs[i] << " to vertex " << h_dsts[i]
+          << " does not match with the reference value.";
+      }
+    }
+  }
+};
+
+using Tests_BidirectionalSearch_File = Tests_BidirectionalSearch<cugraph::test::File_Usecase>;
+using Tests_BidirectionalSearch_Rmat = Tests_BidirectionalSearch<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BidirectionalSearch_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BidirectionalSearch_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BidirectionalSearch_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BidirectionalSearch_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BidirectionalSearch_Usecase{32, false},
+                      BidirectionalSearch_Usecase{32, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dblp.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BidirectionalSearch_Rmat,
+  ::testing::Combine(
+    // enable correctness checks (directed graphs)
+    ::testing::Values(BidirectionalSearch_Usecase{32, false},
+                      BidirectionalSearch_Usecase{32, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BidirectionalSearch_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BidirectionalSearch_Usecase{16, false, false},
+                      BidirectionalSearch_Usecase{16, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
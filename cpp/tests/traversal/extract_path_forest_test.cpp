@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+struct ExtractPathForest_Usecase {
+  size_t source{0};
+  size_t num_paths{0};
+  bool use_sssp_predecessors{false};  // bfs() predecessors if false
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ExtractPathForest
+  : public ::testing::TestWithParam<std::tuple<ExtractPathForest_Usecase, input_usecase_t>> {
+ public:
+  Tests_ExtractPathForest() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(ExtractPathForest_Usecase const& extract_path_forest_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    constexpr vertex_t invalid_vertex = cugraph::invalid_vertex_id<vertex_t>::value;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, extract_path_forest_usecase.use_sssp_predecessors, false);
+
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.number_of_vertices();
+    auto source       = static_cast<vertex_t>(extract_path_forest_usecase.source);
+
+    ASSERT_TRUE((source >= 0) && (source < num_vertices)) << "Invalid starting source.";
+
+    rmm::device_uvector<vertex_t> d_predecessors(num_vertices, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_hop_distances(0, handle.get_stream());
+    if (extract_path_forest_usecase.use_sssp_predecessors) {
+      rmm::device_uvector<weight_t> d_distances(num_vertices, handle.get_stream());
+      cugraph::sssp(handle,
+                    graph_view,
+                    (*edge_weights).view(),
+                    d_distances.data(),
+                    d_predecessors.data(),
+                    source);
+    } else {
+      d_hop_distances.resize(num_vertices, handle.get_stream());
+      rmm::device_scalar<vertex_t> const d_source(source, handle.get_stream());
+      cugraph::bfs(handle,
+                   graph_view,
+                   d_hop_distances.data(),
+                   d_predecessors.data(),
+                   d_source.data(),
+                   size_t{1});
+    }
+    auto h_predecessors = cugraph::test::to_host(handle, d_predecessors);
+
+    // destinations are sampled (with replacement) from the vertices reachable from the source
+
+    std::vector<vertex_t> h_reachable_vertices{source};
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      if (h_predecessors[v] != invalid_vertex) { h_reachable_vertices.push_back(v); }
+    }
+    std::vector<vertex_t> h_destinations(extract_path_forest_usecase.num_paths);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<size_t> dist(0, h_reachable_vertices.size() - 1);
+    std::generate(h_destinations.begin(), h_destinations.end(), [&]() {
+      return h_reachable_vertices[dist(gen)];
+    });
+    auto d_destinations = cugraph::test::to_device(handle, h_destinations);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Extract path forest");
+    }
+
+    auto [d_forest_vertices, d_forest_parents, d_destination_forest_indices, d_path_offsets] =
+      cugraph::extract_path_forest(handle,
+                                   graph_view,
+                                   d_predecessors.data(),
+                                   d_destinations.data(),
+                                   d_destinations.size(),
+                                   true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+
+      if (!extract_path_forest_usecase.use_sssp_predecessors) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start("Extract BFS paths (padded)");
+        auto [d_paths, max_path_length] = cugraph::extract_bfs_paths(handle,
+                                                                     graph_view,
+                                                                     d_hop_distances.data(),
+                                                                     d_predecessors.data(),
+                                                                     d_destinations.data(),
+                                                                     d_destinations.size());
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+        std::cout << "forest size: " << d_forest_vertices.size()
+                  << ", padded path matrix size: " << d_paths.size() << std::endl;
+      }
+    }
+
+    if (extract_path_forest_usecase.check_correctness) {
+      auto h_forest_vertices = cugraph::test::to_host(handle, d_forest_vertices);
+      auto h_forest_parents  = cugraph::test::to_host(handle, d_forest_parents);
+      auto h_destination_forest_indices =
+        cugraph::test::to_host(handle, d_destination_forest_indices);
+      auto h_path_offsets = cugraph::test::to_host(handle, d_path_offsets);
+
+      ASSERT_TRUE(h_destination_forest_indices.size() == h_destinations.size());
+      ASSERT_TRUE(h_path_offsets.size() == h_destinations.size() + 1);
+      ASSERT_TRUE(h_path_offsets[0] == 0);
+
+      // every vertex on a reference path should appear in the forest exactly once (and no other
+      // vertex)
+
+      std::vector<bool> h_on_path(num_vertices, false);
+      for (size_t i = 0; i < h_destinations.size(); ++i) {
+        auto v = h_destinations[i];
+        while (v != invalid_vertex) {
+          h_on_path[v] = true;
+          v            = h_predecessors[v];
+        }
+      }
+      ASSERT_TRUE(static_cast<size_t>(std::count(h_on_path.begin(), h_on_path.end(), true)) ==
+                  h_forest_vertices.size())
+        << "the number of forest vertices does not match with the number of distinct vertices on "
+           "the paths.";
+      std::vector<bool> h_in_forest(num_vertices, false);
+      for (auto v : h_forest_vertices) {
+        ASSERT_TRUE(h_on_path[v] && !h_in_forest[v])
+          << "vertex " << v << " is not on a path or appears more than once in the forest.";
+        h_in_forest[v] = true;
+      }
+
+      // the path recovered from the forest should coincide with the reference path (walking the
+      // predecessors)
+
+      for (size_t i = 0; i < h_destinations.size(); ++i) {
+        std::vector<vertex_t> h_reference_path{};
+        for (auto v = h_destinations[i]; v != invalid_vertex; v = h_predecessors[v]) {
+          h_reference_path.push_back(v);
+        }
+        std::vector<vertex_t> h_forest_path{};
+        for (auto idx = h_destination_forest_indices[i]; idx != invalid_vertex;
+             idx      = h_forest_parents[idx]) {
+          ASSERT_TRUE((idx >= 0) && (static_cast<size_t>(idx) < h_forest_vertices.size()))
+            << "invalid forest index.";
+          h_forest_path.push_back(h_forest_vertices[idx]);
+        }
+        ASSERT_TRUE(h_forest_path == h_reference_path)
+          << "the path to vertex " << h_destinations[i]
+          << " does not match with the reference path.";
+        ASSERT_TRUE(h_path_offsets[i + 1] - h_path_offsets[i] == h_reference_path.size())
+          << "the path offsets do not match with the path length to vertex " << h_destinations[i]
+          << ".";
+      }
+    }
+  }
+};
+
+using Tests_ExtractPathForest_File = Tests_ExtractPathForest<cugraph::test::File_Usecase>;
+using Tests_ExtractPathForest_Rmat = Tests_ExtractPathForest<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ExtractPathForest_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ExtractPathForest_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ExtractPathForest_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ExtractPathForest_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ExtractPathForest_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(ExtractPathForest_Usecase{0, 10, false},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(ExtractPathForest_Usecase{0, 10, true},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(ExtractPathForest_Usecase{100, 100, false},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
+    std::make_tuple(ExtractPathForest_Usecase{100, 100, true},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
+    std::make_tuple(ExtractPathForest_Usecase{1000, 2000, false},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+    std::make_tuple(ExtractPathForest_Usecase{1000, 2000, true},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ExtractPathForest_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(ExtractPathForest_Usecase{0, 200, false},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(ExtractPathForest_Usecase{0, 200, true},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ExtractPathForest_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(ExtractPathForest_Usecase{0, 1000000, false, false},
+                    cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
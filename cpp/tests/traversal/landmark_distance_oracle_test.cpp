@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/distance_oracle.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Dijkstra's algorithm (unit edge weights if weights is nullptr)
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<weight_t> distance_reference(edge_t const* offsets,
+                                         vertex_t const* indices,
+                                         weight_t const* weights,
+                                         vertex_t num_vertices,
+                                         vertex_t source)
+{
+  using queue_item_t = std::tuple<weight_t, vertex_t>;
+
+  std::vector<weight_t> distances(num_vertices, std::numeric_limits<weight_t>::max());
+
+  distances[source] = weight_t{0.0};
+  std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>> queue{};
+  queue.push(std::make_tuple(weight_t{0.0}, source));
+
+  while (queue.size() > 0) {
+    weight_t distance{};
+    vertex_t row{};
+    std::tie(distance, row) = queue.top();
+    queue.pop();
+    if (distance > distances[row]) { continue; }
+    for (auto nbr_offset = *(offsets + row); nbr_offset != *(offsets + row + 1); ++nbr_offset) {
+      auto nbr          = *(indices + nbr_offset);
+      auto new_distance = distance + (weights != nullptr ? *(weights + nbr_offset) : weight_t{1.0});
+      if (new_distance < distances[nbr]) {
+        distances[nbr] = new_distance;
+        queue.push(std::make_tuple(new_distance, nbr));
+      }
+    }
+  }
+
+  return distances;
+}
+
+struct LandmarkDistanceOracle_Usecase {
+  size_t num_landmarks{0};
+  cugraph::landmark_selection_t selection{cugraph::landmark_selection_t::HIGHEST_DEGREE};
+  bool weighted{true};
+  bool bidirectional{true};
+  size_t num_queries{0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_LandmarkDistanceOracle
+  : public ::testing::TestWithParam<std::tuple<LandmarkDistanceOracle_Usecase, input_usecase_t>> {
+ public:
+  Tests_LandmarkDistanceOracle() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LandmarkDistanceOracle_Usecase const& oracle_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, oracle_usecase.weighted, false);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    auto num_landmarks =
+      std::min(oracle_usecase.num_landmarks, static_cast<size_t>(graph_view.number_of_vertices()));
+
+    // 1. build the index
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Build landmark distance index");
+    }
+
+    auto index = cugraph::build_landmark_distance_index(handle,
+                                                        graph_view,
+                                                        edge_weight_view,
+                                                        num_landmarks,
+                                                        oracle_usecase.selection,
+                                                        rng_state,
+                                                        oracle_usecase.bidirectional);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(index.landmarks.size(), num_landmarks);
+
+    // 2. query random pairs
+
+    std::vector<vertex_t> h_srcs(oracle_usecase.num_queries);
+    std::vector<vertex_t> h_dsts(oracle_usecase.num_queries);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, graph_view.number_of_vertices() - 1);
+    std::generate(h_srcs.begin(), h_srcs.end(), [&gen, &dist]() { return dist(gen); });
+    std::generate(h_dsts.begin(), h_dsts.end(), [&gen, &dist]() { return dist(gen); });
+    rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+    raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+    raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Landmark distance bounds");
+    }
+
+    auto [d_lower_bounds, d_upper_bounds] = cugraph::landmark_distance_bounds(
+      handle,
+      index,
+      raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()),
+      raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      auto elapsed = hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      std::cout << "Landmark distance query latency: "
+                << (elapsed * 1e9) / static_cast<double>(std::max(h_srcs.size(), size_t{1}))
+                << " ns/query (" << h_srcs.size() << " queries in a batch)." << std::endl;
+    }
+
+    if (oracle_usecase.check_correctness) {
+      auto h_lower_bounds = cugraph::test::to_host(handle, d_lower_bounds);
+      auto h_upper_bounds = cugraph::test::to_host(handle, d_upper_bounds);
+
+      // 3. compare the bounds with the exact distances
+
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      std::optional<std::vector<weight_t>> h_weights{std::nullopt};
+      if (edge_weight_view) {
+        h_weights = cugraph::test::to_host(
+          handle,
+          raft::device_span<weight_t const>((*edge_weight_view).value_firsts()[0],
+                                            (*edge_weight_view).edge_counts()[0]));
+      }
+
+      auto epsilon =
+        (h_weights ? *std::max_element((*h_weights).begin(), (*h_weights).end()) : weight_t{1.0}) *
+        weight_t{1e-4};
+
+      std::map<vertex_t, std::vector<weight_t>> reference_distances{};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto it = reference_distances.find(h_srcs[i]);
+        if (it == reference_distances.end()) {
+          it = reference_distances
+                 .insert({h_srcs[i],
+                          distance_reference(h_offsets.data(),
+                                             h_indices.data(),
+                                             h_weights ? (*h_weights).data() : nullptr,
+                                             graph_view.number_of_vertices(),
+                                             h_srcs[i])})
+                 .first;
+        }
+        auto distance = (it->second)[h_dsts[i]];
+        if (distance == std::numeric_limits<weight_t>::max()) {
+          ASSERT_TRUE(h_upper_bounds[i] == std::numeric_limits<weight_t>::max())
+            << "query " << i << " (" << h_srcs[i] << ", " << h_dsts[i]
+            << ") has a finite upper bound for an unreachable pair.";
+        } else {
+          ASSERT_TRUE(h_lower_bounds[i] <= distance + epsilon)
+            << "query " << i << " (" << h_srcs[i] << ", " << h_dsts[i]
+            << ") lower bound exceeds the exact distance.";
+          ASSERT_TRUE((h_upper_bounds[i] == std::numeric_limits<weight_t>::max()) ||
+                      (h_upper_bounds[i] + epsilon >= distance))
+            << "query " << i << " (" << h_srcs[i] << ", " << h_dsts[i]
+            << ") upper bound is smaller than the exact distance.";
+        }
+      }
+
+      // 4. save, load, and re-query
+
+      auto file_path =
+        cugraph::test::temporary_file_path("cugraph_landmark_distance_index_test", ".bin");
+      cugraph::test::temporary_file_guard_t file_guard(file_path);
+      cugraph::save_landmark_distance_index(handle, index, file_path);
+      auto loaded_index =
+        cugraph::load_landmark_distance_index<vertex_t, weight_t>(handle, file_path);
+
+      ASSERT_EQ(loaded_index.number_of_vertices, index.number_of_vertices);
+      ASSERT_EQ(loaded_index.is_symmetric, index.is_symmetric);
+      ASSERT_EQ(loaded_index.distances_to_landmarks.has_value(),
+                index.distances_to_landmarks.has_value());
+
+      auto [d_loaded_lower_bounds, d_loaded_upper_bounds] = cugraph::landmark_distance_bounds(
+        handle,
+        loaded_index,
+        raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()),
+        raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()));
+      auto h_loaded_lower_bounds = cugraph::test::to_host(handle, d_loaded_lower_bounds);
+      auto h_loaded_upper_bounds = cugraph::test::to_host(handle, d_loaded_upper_bounds);
+      ASSERT_TRUE(h_loaded_lower_bounds == h_lower_bounds &&
+                  h_loaded_upper_bounds == h_upper_bounds)
+        << "bounds from the loaded index do not match with the bounds from the built index.";
+    }
+  }
+};
+
+using Tests_LandmarkDistanceOracle_File =
+  Tests_LandmarkDistanceOracle<cugraph::test::File_Usecase>;
+using Tests_LandmarkDistanceOracle_Rmat =
+  Tests_LandmarkDistanceOracle<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_LandmarkDistanceOracle_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_LandmarkDistanceOracle_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LandmarkDistanceOracle_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_LandmarkDistanceOracle_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      LandmarkDistanceOracle_Usecase{
+        8, cugraph::landmark_selection_t::HIGHEST_DEGREE, true, true, 1000},
+      LandmarkDistanceOracle_Usecase{8, cugraph::landmark_selection_t::RANDOM, true, true, 1000},
+      LandmarkDistanceOracle_Usecase{
+        16, cugraph::landmark_selection_t::HIGHEST_DEGREE, false, true, 1000},
+      LandmarkDistanceOracle_Usecase{
+        100, cugraph::landmark_selection_t::RANDOM, false, false, 1000}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_LandmarkDistanceOracle_Rmat,
+  ::testing::Combine(
+    // enable correctness checks, directed graphs with and without the distances to the landmarks
+    ::testing::Values(
+      LandmarkDistanceOracle_Usecase{
+        16, cugraph::landmark_selection_t::HIGHEST_DEGREE, true, true, 1000},
+      LandmarkDistanceOracle_Usecase{
+        16, cugraph::landmark_selection_t::HIGHEST_DEGREE, true, false, 1000},
+      LandmarkDistanceOracle_Usecase{16, cugraph::landmark_selection_t::RANDOM, false, true, 1000}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_LandmarkDistanceOracle_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(
+      LandmarkDistanceOracle_Usecase{
+        64, cugraph::landmark_selection_t::HIGHEST_DEGREE, true, true, 1000000, false},
+      cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -40,6 +40,7 @@
 struct BFS_Usecase {
   size_t source{0};
   bool check_correctness{true};
+  bool direction_optimizing{false};  // valid only for symmetric input graphs
 };
 
 template <typename input_usecase_t>
@@ -113,7 +114,7 @@ class Tests_MGBFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, inpu
                  d_mg_predecessors.data(),
                  d_mg_source ? (*d_mg_source).data() : static_cast<vertex_t const*>(nullptr),
                  d_mg_source ? size_t{1} : size_t{0},
-                 false,
+                 bfs_usecase.direction_optimizing,
                  std::numeric_limits<vertex_t>::max());
 
     if (cugraph::test::g_perf) {
@@ -285,7 +286,10 @@ INSTANTIATE_TEST_SUITE_P(rmat_small_test,
                            // enable correctness checks
                            std::make_tuple(BFS_Usecase{0},
                                            cugraph::test::Rmat_Usecase(
-                                             10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+                                             10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true)),
+                           std::make_tuple(BFS_Usecase{0, true, true},
+                                           cugraph::test::Rmat_Usecase(
+                                             10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+struct MultiSourceBFS_Usecase {
+  size_t num_sources{0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGMultiSourceBFS
+  : public ::testing::TestWithParam<std::tuple<MultiSourceBFS_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGMultiSourceBFS() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running multi-source BFS on multiple GPUs to that of a single-GPU run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(MultiSourceBFS_Usecase const& bfs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    HighResTimer hr_timer{};
+
+    // 1. create MG graph
+
+    cugraph::graph_t<vertex_t, edge_t, false, true> mg_graph(*handle_);
+    std::optional<rmm::device_uvector<vertex_t>> d_mg_renumber_map_labels{std::nullopt};
+    std::tie(mg_graph, std::ignore, d_mg_renumber_map_labels) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 2. run MG multi-source BFS (every GPU passes the same sources)
+
+    std::vector<vertex_t> h_sources(bfs_usecase.num_sources);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, mg_graph_view.number_of_vertices() - 1);
+    std::generate(h_sources.begin(), h_sources.end(), [&gen, &dist]() { return dist(gen); });
+    rmm::device_uvector<vertex_t> d_mg_sources(h_sources.size(), handle_->get_stream());
+    raft::update_device(
+      d_mg_sources.data(), h_sources.data(), h_sources.size(), handle_->get_stream());
+
+    auto num_columns = static_cast<size_t>(mg_graph_view.local_vertex_partition_range_size());
+    rmm::device_uvector<vertex_t> d_mg_distances(h_sources.size() * num_columns,
+                                                 handle_->get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG Multi-source BFS");
+    }
+
+    cugraph::multi_source_bfs(
+      *handle_,
+      mg_graph_view,
+      raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+      d_mg_distances.data());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 3. compare SG & MG results
+
+    if (bfs_usecase.check_correctness) {
+      // 3-1. unrenumber & aggregate MG sources & results
+
+      cugraph::unrenumber_int_vertices<vertex_t, true>(
+        *handle_,
+        d_mg_sources.data(),
+        d_mg_sources.size(),
+        (*d_mg_renumber_map_labels).data(),
+        mg_graph_view.vertex_partition_range_lasts());
+
+      auto d_mg_aggregate_renumber_map_labels = cugraph::test::device_gatherv(
+        *handle_, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+      std::vector<rmm::device_uvector<vertex_t>> d_mg_aggregate_distances{};
+      for (size_t i = 0; i < h_sources.size(); ++i) {
+        d_mg_aggregate_distances.push_back(cugraph::test::device_gatherv(
+          *handle_, d_mg_distances.data() + i * num_columns, num_columns));
+      }
+
+      if (handle_->get_comms().get_rank() == int{0}) {
+        // 3-2. create SG graph
+
+        cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+        std::tie(sg_graph, std::ignore, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            *handle_, input_usecase, false, false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_TRUE(mg_graph_view.number_of_vertices() == sg_graph_view.number_of_vertices());
+
+        // 3-3. run SG multi-source BFS
+
+        rmm::device_uvector<vertex_t> d_sg_distances(
+          h_sources.size() * static_cast<size_t>(sg_graph_view.number_of_vertices()),
+          handle_->get_stream());
+
+        cugraph::multi_source_bfs(
+          *handle_,
+          sg_graph_view,
+          raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+          d_sg_distances.data());
+
+        // 3-4. compare
+
+        auto h_sg_distances = cugraph::test::to_host(*handle_, d_sg_distances);
+
+        for (size_t i = 0; i < h_sources.size(); ++i) {
+          std::tie(std::ignore, d_mg_aggregate_distances[i]) = cugraph::test::sort_by_key(
+            *handle_, d_mg_aggregate_renumber_map_labels, d_mg_aggregate_distances[i]);
+          auto h_mg_aggregate_distances =
+            cugraph::test::to_host(*handle_, d_mg_aggregate_distances[i]);
+          ASSERT_TRUE(std::equal(h_mg_aggregate_distances.begin(),
+                                 h_mg_aggregate_distances.end(),
+                                 h_sg_distances.begin() + i * h_mg_aggregate_distances.size()))
+            << "MG distances from source " << i << " do not match with the SG distances.";
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGMultiSourceBFS<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGMultiSourceBFS_File = Tests_MGMultiSourceBFS<cugraph::test::File_Usecase>;
+using Tests_MGMultiSourceBFS_Rmat = Tests_MGMultiSourceBFS<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGMultiSourceBFS_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGMultiSourceBFS_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGMultiSourceBFS_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGMultiSourceBFS_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MultiSourceBFS_Usecase{17}, MultiSourceBFS_Usecase{150}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGMultiSourceBFS_Rmat,
+                         ::testing::Values(
+                           // enable correctness checks
+                           std::make_tuple(MultiSourceBFS_Usecase{100},
+                                           cugraph::test::Rmat_Usecase(
+                                             10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGMultiSourceBFS_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(
+      MultiSourceBFS_Usecase{256, false},
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+void bfs_distance_reference(edge_t const* offsets,
+                            vertex_t const* indices,
+                            vertex_t* distances,
+                            vertex_t num_vertices,
+                            vertex_t source,
+                            vertex_t depth_limit)
+{
+  std::fill(distances, distances + num_vertices, std::numeric_limits<vertex_t>::max());
+
+  vertex_t depth{0};
+  *(distances + source) = depth;
+  std::vector<vertex_t> cur_frontier_rows{source};
+  std::vector<vertex_t> new_frontier_rows{};
+
+  while ((cur_frontier_rows.size() > 0) && (depth < depth_limit)) {
+    for (auto const row : cur_frontier_rows) {
+      for (auto nbr_offset = *(offsets + row); nbr_offset != *(offsets + row + 1); ++nbr_offset) {
+        auto nbr = *(indices + nbr_offset);
+        if (*(distances + nbr) == std::numeric_limits<vertex_t>::max()) {
+          *(distances + nbr) = depth + 1;
+          new_frontier_rows.push_back(nbr);
+        }
+      }
+    }
+    std::swap(cur_frontier_rows, new_frontier_rows);
+    new_frontier_rows.clear();
+    ++depth;
+  }
+}
+
+struct MultiSourceBFS_Usecase {
+  size_t num_sources{0};
+  size_t depth_limit{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MultiSourceBFS
+  : public ::testing::TestWithParam<std::tuple<MultiSourceBFS_Usecase, input_usecase_t>> {
+ public:
+  Tests_MultiSourceBFS() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(MultiSourceBFS_Usecase const& bfs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+
+    auto graph_view = graph.view();
+
+    // sources may repeat
+    std::vector<vertex_t> h_sources(bfs_usecase.num_sources);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, graph_view.number_of_vertices() - 1);
+    std::generate(h_sources.begin(), h_sources.end(), [&gen, &dist]() { return dist(gen); });
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    auto depth_limit = static_cast<vertex_t>(
+      std::min(bfs_usecase.depth_limit, static_cast<size_t>(std::numeric_limits<vertex_t>::max())));
+
+    rmm::device_uvector<vertex_t> d_distances(
+      h_sources.size() * static_cast<size_t>(graph_view.number_of_vertices()),
+      handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Multi-source BFS");
+    }
+
+    cugraph::multi_source_bfs(handle,
+                              graph_view,
+                              raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+                              d_distances.data(),
+                              depth_limit);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (bfs_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      auto h_distances = cugraph::test::to_host(handle, d_distances);
+
+      std::vector<vertex_t> h_reference_distances(graph_view.number_of_vertices());
+      for (size_t i = 0; i < h_sources.size(); ++i) {
+        bfs_distance_reference(h_offsets.data(),
+                               h_indices.data(),
+                               h_reference_distances.data(),
+                               graph_view.number_of_vertices(),
+                               h_sources[i],
+                               depth_limit);
+        ASSERT_TRUE(std::equal(h_reference_distances.begin(),
+                               h_reference_distances.end(),
+                               h_distances.begin() + i * h_reference_distances.size()))
+          << "distances from source " << i << " (" << h_sources[i]
+          << ") do not match with the reference distances.";
+      }
+    }
+  }
+};
+
+using Tests_MultiSourceBFS_File = Tests_MultiSourceBFS<cugraph::test::File_Usecase>;
+using Tests_MultiSourceBFS_Rmat = Tests_MultiSourceBFS<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MultiSourceBFS_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MultiSourceBFS_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultiSourceBFS_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MultiSourceBFS_File,
+  ::testing::Combine(
+    // enable correctness checks, a partial batch, a full batch, and multiple batches
+    ::testing::Values(MultiSourceBFS_Usecase{1},
+                      MultiSourceBFS_Usecase{17},
+                      MultiSourceBFS_Usecase{64},
+                      MultiSourceBFS_Usecase{150},
+                      MultiSourceBFS_Usecase{150, 2}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MultiSourceBFS_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(MultiSourceBFS_Usecase{100},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MultiSourceBFS_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(MultiSourceBFS_Usecase{256, std::numeric_limits<size_t>::max(), false},
+                    cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
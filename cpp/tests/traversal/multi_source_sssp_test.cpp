@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// Dijkstra's algorithm
+template <typename vertex_t, typename edge_t, typename weight_t>
+void sssp_distance_reference(edge_t const* offsets,
+                             vertex_t const* indices,
+                             weight_t const* weights,
+                             weight_t* distances,
+                             vertex_t num_vertices,
+                             vertex_t source,
+                             weight_t cutoff)
+{
+  using queue_item_t = std::tuple<weight_t, vertex_t>;
+
+  std::fill(distances, distances + num_vertices, std::numeric_limits<weight_t>::max());
+
+  *(distances + source) = weight_t{0.0};
+  std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>> queue{};
+  queue.push(std::make_tuple(weight_t{0.0}, source));
+
+  while (queue.size() > 0) {
+    weight_t distance{};
+    vertex_t row{};
+    std::tie(distance, row) = queue.top();
+    queue.pop();
+    if (distance > *(distances + row)) { continue; }
+    for (auto nbr_offset = *(offsets + row); nbr_offset != *(offsets + row + 1); ++nbr_offset) {
+      auto nbr          = *(indices + nbr_offset);
+      auto new_distance = distance + *(weights + nbr_offset);
+      auto threshold    = std::min(*(distances + nbr), cutoff);
+      if (new_distance < threshold) {
+        *(distances + nbr) = new_distance;
+        queue.push(std::make_tuple(new_distance, nbr));
+      }
+    }
+  }
+}
+
+// every reached vertex should lead back to the source by following the predecessors (and the walk
+// should not enter a cycle)
+template <typename vertex_t, typename weight_t>
+bool predecessor_chains_reach_sources(std::vector<vertex_t> const& sources,
+                                      std::vector<weight_t> const& distances,
+                                      std::vector<vertex_t> const& predecessors,
+                                      vertex_t num_vertices)
+{
+  auto num_sources = sources.size();
+  for (size_t j = 0; j < num_sources; ++j) {
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      if (distances[v * num_sources + j] == std::numeric_limits<weight_t>::max()) { continue; }
+      auto u = v;
+      vertex_t num_steps{0};
+      while ((u != sources[j]) && (num_steps < num_vertices)) {
+        u = predecessors[u * num_sources + j];
+        if (u == cugraph::invalid_vertex_id<vertex_t>::value) { return false; }
+        ++num_steps;
+      }
+      if (u != sources[j]) { return false; }
+    }
+  }
+  return true;
+}
+
+struct MultiSourceSSSP_Usecase {
+  size_t num_sources{0};
+  double cutoff{std::numeric_limits<double>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MultiSourceSSSP
+  : public ::testing::TestWithParam<std::tuple<MultiSourceSSSP_Usecase, input_usecase_t>> {
+ public:
+  Tests_MultiSourceSSSP() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MultiSourceSSSP_Usecase const& sssp_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+
+    auto graph_view       = graph.view();
+    auto edge_weight_view = (*edge_weights).view();
+
+    // sources may repeat
+    std::vector<vertex_t> h_sources(sssp_usecase.num_sources);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(0, graph_view.number_of_vertices() - 1);
+    std::generate(h_sources.begin(), h_sources.end(), [&gen, &dist]() { return dist(gen); });
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    auto cutoff = static_cast<weight_t>(
+      std::min(sssp_usecase.cutoff, static_cast<double>(std::numeric_limits<weight_t>::max())));
+
+    auto num_elements = static_cast<size_t>(graph_view.number_of_vertices()) * h_sources.size();
+    rmm::device_uvector<weight_t> d_distances(num_elements, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_predecessors(num_elements, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Multi-source SSSP");
+    }
+
+    cugraph::multi_source_sssp(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+      d_distances.data(),
+      d_predecessors.data(),
+      cutoff);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+
+      // baseline: one SSSP call per source
+      rmm::device_uvector<weight_t> d_tmp_distances(graph_view.number_of_vertices(),
+                                                    handle.get_stream());
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("SSSP per source");
+      for (auto source : h_sources) {
+        cugraph::sssp(handle,
+                      graph_view,
+                      edge_weight_view,
+                      d_tmp_distances.data(),
+                      static_cast<vertex_t*>(nullptr),
+                      source,
+                      cutoff);
+      }
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (sssp_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      auto h_weights = cugraph::test::to_host(
+        handle,
+        raft::device_span<weight_t const>(edge_weight_view.value_firsts()[0],
+                                          edge_weight_view.edge_counts()[0]));
+      auto h_distances    = cugraph::test::to_host(handle, d_distances);
+      auto h_predecessors = cugraph::test::to_host(handle, d_predecessors);
+
+      auto max_weight_element = std::max_element(h_weights.begin(), h_weights.end());
+      auto epsilon            = *max_weight_element * weight_t{1e-6};
+      auto nearly_equal = [epsilon](auto lhs, auto rhs) { return std::fabs(lhs - rhs) < epsilon; };
+
+      auto num_sources = h_sources.size();
+      std::vector<weight_t> h_reference_distances(graph_view.number_of_vertices());
+      for (size_t j = 0; j < num_sources; ++j) {
+        sssp_distance_reference(h_offsets.data(),
+                                h_indices.data(),
+                                h_weights.data(),
+                                h_reference_distances.data(),
+                                graph_view.number_of_vertices(),
+                                h_sources[j],
+                                cutoff);
+        for (vertex_t v = 0; v < graph_view.number_of_vertices(); ++v) {
+          auto distance    = h_distances[v * num_sources + j];
+          auto predecessor = h_predecessors[v * num_sources + j];
+          if (h_reference_distances[v] == std::numeric_limits<weight_t>::max()) {
+            ASSERT_TRUE(distance == std::numeric_limits<weight_t>::max())
+              << "vertex " << v << " should be unreachable from source " << j << ".";
+          } else {
+            ASSERT_TRUE(nearly_equal(distance, h_reference_distances[v]))
+              << "distance from source " << j << " to vertex " << v
+              << " does not match with the reference value.";
+          }
+          if ((v == h_sources[j]) || (distance == std::numeric_limits<weight_t>::max())) {
+            ASSERT_TRUE(predecessor == cugraph::invalid_vertex_id<vertex_t>::value)
+              << "vertex " << v << " should not have a predecessor for source " << j << ".";
+          } else {
+            bool found{false};
+            for (auto k = h_offsets[predecessor]; k < h_offsets[predecessor + 1]; ++k) {
+              if ((h_indices[k] == v) &&
+                  nearly_equal(h_reference_distances[predecessor] + h_weights[k],
+                               h_reference_distances[v])) {
+                found = true;
+                break;
+              }
+            }
+            ASSERT_TRUE(found)
+              << "no edge from the predecessor vertex to this vertex with the matching weight.";
+          }
+        }
+      }
+      ASSERT_TRUE(predecessor_chains_reach_sources(
+        h_sources, h_distances, h_predecessors, graph_view.number_of_vertices()))
+        << "a predecessor chain does not lead back to its source.";
+    }
+  }
+};
+
+// zero-weight cycles (1->2->3->1, 4<->5, and 1->0 back to a source) produce ties that do not
+// identify a unique predecessor
+TEST(multi_source_sssp_zero_weight_cycle, success)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  vertex_t num_vertices{6};
+  std::vector<vertex_t> h_srcs{0, 0, 1, 1, 2, 2, 3, 3, 4, 5, 5};
+  std::vector<vertex_t> h_dsts{1, 5, 0, 2, 3, 4, 1, 0, 5, 4, 2};
+  std::vector<weight_t> h_weights{1.0, 0.5, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  std::vector<vertex_t> h_vertices(num_vertices);
+  std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+
+  cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+    edge_weights{std::nullopt};
+  std::tie(graph, edge_weights, std::ignore, std::ignore, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, edge_t, int32_t, false, false>(
+      handle,
+      std::make_optional(cugraph::test::to_device(handle, h_vertices)),
+      cugraph::test::to_device(handle, h_srcs),
+      cugraph::test::to_device(handle, h_dsts),
+      std::make_optional(cugraph::test::to_device(handle, h_weights)),
+      std::nullopt,
+      std::nullopt,
+      cugraph::graph_properties_t{false, false},
+      false);
+
+  // sources may repeat
+  std::vector<vertex_t> h_sources{0, 2, 4, 2, 1};
+  auto d_sources = cugraph::test::to_device(handle, h_sources);
+
+  auto num_elements = static_cast<size_t>(num_vertices) * h_sources.size();
+  rmm::device_uvector<weight_t> d_distances(num_elements, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_predecessors(num_elements, handle.get_stream());
+
+  cugraph::multi_source_sssp(handle,
+                             graph.view(),
+                             (*edge_weights).view(),
+                             raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+                             d_distances.data(),
+                             d_predecessors.data());
+
+  auto h_distances    = cugraph::test::to_host(handle, d_distances);
+  auto h_predecessors = cugraph::test::to_host(handle, d_predecessors);
+
+  std::vector<weight_t> h_reference_distances{0.0, 0.5, 0.5, 0.5, 0.5, 0.5};  // from source 0
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    ASSERT_EQ(h_distances[v * h_sources.size()], h_reference_distances[v])
+      << "distance from source 0 to vertex " << v << " does not match with the reference value.";
+  }
+  ASSERT_TRUE(
+    predecessor_chains_reach_sources(h_sources, h_distances, h_predecessors, num_vertices))
+    << "a predecessor chain does not lead back to its source.";
+}
+
+using Tests_MultiSourceSSSP_File = Tests_MultiSourceSSSP<cugraph::test::File_Usecase>;
+using Tests_MultiSourceSSSP_Rmat = Tests_MultiSourceSSSP<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MultiSourceSSSP_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MultiSourceSSSP_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultiSourceSSSP_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MultiSourceSSSP_File,
+  ::testing::Combine(
+    // enable correctness checks, a partial tile, a full tile, multiple tiles, and a cutoff
+    ::testing::Values(MultiSourceSSSP_Usecase{1},
+                      MultiSourceSSSP_Usecase{17},
+                      MultiSourceSSSP_Usecase{64},
+                      MultiSourceSSSP_Usecase{150},
+                      MultiSourceSSSP_Usecase{150, 1.5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dblp.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MultiSourceSSSP_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(MultiSourceSSSP_Usecase{100},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MultiSourceSSSP_Rmat,
+  ::testing::Values(
+    // disable correctness checks for large graphs
+    std::make_tuple(MultiSourceSSSP_Usecase{256, std::numeric_limits<double>::max(), false},
+                    cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
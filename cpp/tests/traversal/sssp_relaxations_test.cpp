@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/host_traversal.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// run the Near-Far and delta-stepping methods (with a range of bucket widths) on the same inputs,
+// check every run against the host reference, and compare the number of relaxations (edge
+// relaxations that improved a tentative distance) per edge and the execution times (with --perf)
+struct SSSP_Relaxations_Usecase {
+  size_t source{0};
+  std::vector<double> deltas{};  // delta-stepping bucket widths, the automatic bucket width is
+                                 // always included
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SSSP_Relaxations
+  : public ::testing::TestWithParam<std::tuple<SSSP_Relaxations_Usecase, input_usecase_t>> {
+ public:
+  Tests_SSSP_Relaxations() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SSSP_Relaxations_Usecase const& sssp_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+
+    auto graph_view       = graph.view();
+    auto edge_weight_view = (*edge_weights).view();
+
+    ASSERT_TRUE(static_cast<vertex_t>(sssp_usecase.source) >= 0 &&
+                static_cast<vertex_t>(sssp_usecase.source) < graph_view.number_of_vertices());
+
+    std::vector<std::tuple<cugraph::sssp_method_t, std::optional<weight_t>>> runs{
+      std::make_tuple(cugraph::sssp_method_t::NEAR_FAR, std::nullopt),
+      std::make_tuple(cugraph::sssp_method_t::DELTA_STEPPING, std::nullopt)};
+    for (auto delta : sssp_usecase.deltas) {
+      runs.emplace_back(cugraph::sssp_method_t::DELTA_STEPPING, static_cast<weight_t>(delta));
+    }
+
+    std::vector<weight_t> h_reference_distances{};
+    if (sssp_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      auto h_weights = cugraph::test::to_host(
+        handle,
+        raft::device_span<weight_t const>(edge_weight_view.value_firsts()[0],
+                                          edge_weight_view.edge_counts()[0]));
+
+      h_reference_distances.resize(graph_view.number_of_vertices());
+      std::vector<vertex_t> h_reference_predecessors(graph_view.number_of_vertices());
+      cugraph::host::sssp(h_offsets.data(),
+                          h_indices.data(),
+                          h_weights.data(),
+                          graph_view.number_of_vertices(),
+                          h_reference_distances.data(),
+                          h_reference_predecessors.data(),
+                          static_cast<vertex_t>(sssp_usecase.source),
+                          std::numeric_limits<weight_t>::max());
+    }
+
+    for (auto [method, delta] : runs) {
+      rmm::device_uvector<weight_t> d_distances(graph_view.number_of_vertices(),
+                                                handle.get_stream());
+      rmm::device_uvector<vertex_t> d_predecessors(graph_view.number_of_vertices(),
+                                                   handle.get_stream());
+
+      size_t num_relaxations{0};
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.start(std::string(method == cugraph::sssp_method_t::NEAR_FAR
+                                     ? "SSSP (Near-Far, delta="
+                                     : "SSSP (delta-stepping, delta=") +
+                       (delta ? std::to_string(*delta) : std::string("auto")) + ")");
+      }
+
+      cugraph::sssp(handle,
+                    graph_view,
+                    edge_weight_view,
+                    d_distances.data(),
+                    d_predecessors.data(),
+                    static_cast<vertex_t>(sssp_usecase.source),
+                    std::numeric_limits<weight_t>::max(),
+                    false,
+                    method,
+                    delta,
+                    &num_relaxations);
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_timer.stop();
+        hr_timer.display_and_clear(std::cout);
+        std::cout << num_relaxations << " relaxations, "
+                  << static_cast<double>(num_relaxations) /
+                       static_cast<double>(graph_view.number_of_edges())
+                  << " relaxations per edge." << std::endl;
+      }
+
+      if (sssp_usecase.check_correctness) {
+        auto h_distances = cugraph::test::to_host(handle, d_distances);
+
+        // every reached vertex (other than the source) needs at least one improving relaxation
+        auto num_reached = static_cast<size_t>(
+          std::count_if(h_distances.begin(), h_distances.end(), [](auto distance) {
+            return distance != std::numeric_limits<weight_t>::max();
+          }));
+        ASSERT_TRUE(num_relaxations + 1 >= num_reached)
+          << "too few relaxations (" << num_relaxations << ") for " << num_reached
+          << " reached vertices.";
+
+        auto max_weight_value = std::numeric_limits<weight_t>::max();
+        auto epsilon          = weight_t{1e-6};
+        for (size_t i = 0; i < h_distances.size(); ++i) {
+          auto lhs = h_reference_distances[i];
+          auto rhs = h_distances[i];
+          if ((lhs == max_weight_value) || (rhs == max_weight_value)) {
+            ASSERT_EQ(lhs, rhs) << "vertex " << i << " reachability mismatch.";
+          } else {
+            ASSERT_TRUE(std::abs(lhs - rhs) <=
+                        std::max(std::max(std::abs(lhs), std::abs(rhs)) * epsilon, epsilon))
+              << "vertex " << i << " distance mismatch with the reference (" << lhs << " vs "
+              << rhs << ").";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_SSSP_Relaxations_File = Tests_SSSP_Relaxations<cugraph::test::File_Usecase>;
+using Tests_SSSP_Relaxations_Rmat = Tests_SSSP_Relaxations<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SSSP_Relaxations_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SSSP_Relaxations_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SSSP_Relaxations_File,
+  // enable correctness checks
+  ::testing::Values(
+    std::make_tuple(SSSP_Relaxations_Usecase{0, {0.1, 1.0}},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(SSSP_Relaxations_Usecase{0, {0.1, 1.0}},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
+    std::make_tuple(SSSP_Relaxations_Usecase{1000, {0.1, 1.0}},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SSSP_Relaxations_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Values(
+    std::make_tuple(SSSP_Relaxations_Usecase{0, {0.01, 0.1}, false},
+                    cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/host_traversal.hpp>
 #include <cugraph/utilities/high_res_timer.hpp>
 
 #include <raft/core/handle.hpp>
@@ -35,56 +36,15 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
-#include <queue>
+#include <optional>
 #include <tuple>
 #include <vector>
 
-// Dijkstra's algorithm
-template <typename vertex_t, typename edge_t, typename weight_t>
-void sssp_reference(edge_t const* offsets,
-                    vertex_t const* indices,
-                    weight_t const* weights,
-                    weight_t* distances,
-                    vertex_t* predecessors,
-                    vertex_t num_vertices,
-                    vertex_t source,
-                    weight_t cutoff = std::numeric_limits<weight_t>::max())
-{
-  using queue_item_t = std::tuple<weight_t, vertex_t>;
-
-  std::fill(distances, distances + num_vertices, std::numeric_limits<weight_t>::max());
-  std::fill(predecessors, predecessors + num_vertices, cugraph::invalid_vertex_id<vertex_t>::value);
-
-  *(distances + source) = weight_t{0.0};
-  std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>> queue{};
-  queue.push(std::make_tuple(weight_t{0.0}, source));
-
-  while (queue.size() > 0) {
-    weight_t distance{};
-    vertex_t row{};
-    std::tie(distance, row) = queue.top();
-    queue.pop();
-    if (distance > *(distances + row)) { continue; }
-    auto nbr_offsets     = *(offsets + row);
-    auto nbr_offset_last = *(offsets + row + 1);
-    for (auto nbr_offset = nbr_offsets; nbr_offset != nbr_offset_last; ++nbr_offset) {
-      auto nbr          = *(indices + nbr_offset);
-      auto new_distance = distance + *(weights + nbr_offset);
-      auto threshold    = std::min(*(distances + nbr), cutoff);
-      if (new_distance < threshold) {
-        *(distances + nbr)    = new_distance;
-        *(predecessors + nbr) = row;
-        queue.push(std::make_tuple(new_distance, nbr));
-      }
-    }
-  }
-
-  return;
-}
-
 struct SSSP_Usecase {
   size_t source{0};
   bool check_correctness{true};
+  cugraph::sssp_method_t method{cugraph::sssp_method_t::NEAR_FAR};
+  std::optional<double> delta{std::nullopt};  // std::nullopt: chosen by the method
 };
 
 template <typename input_usecase_t>
@@ -144,7 +104,11 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
                   d_predecessors.data(),
                   static_cast<vertex_t>(sssp_usecase.source),
                   std::numeric_limits<weight_t>::max(),
-                  false);
+                  false,
+                  sssp_usecase.method,
+                  sssp_usecase.delta
+                    ? std::make_optional(static_cast<weight_t>(*sssp_usecase.delta))
+                    : std::nullopt);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -187,14 +151,14 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
       std::vector<weight_t> h_reference_distances(unrenumbered_graph_view.number_of_vertices());
       std::vector<vertex_t> h_reference_predecessors(unrenumbered_graph_view.number_of_vertices());
 
-      sssp_reference(h_offsets.data(),
-                     h_indices.data(),
-                     h_weights.data(),
-                     h_reference_distances.data(),
-                     h_reference_predecessors.data(),
-                     unrenumbered_graph_view.number_of_vertices(),
-                     unrenumbered_source,
-                     std::numeric_limits<weight_t>::max());
+      cugraph::host::sssp(h_offsets.data(),
+                          h_indices.data(),
+                          h_weights.data(),
+                          unrenumbered_graph_view.number_of_vertices(),
+                          h_reference_distances.data(),
+                          h_reference_predecessors.data(),
+                          unrenumbered_source,
+                          std::numeric_limits<weight_t>::max());
 
       std::vector<weight_t> h_cugraph_distances(graph_view.number_of_vertices());
       std::vector<vertex_t> h_cugraph_predecessors(graph_view.number_of_vertices());
@@ -294,14 +258,25 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(SSSP_Usecase{0}, cugraph::test::File_Usecase("test/datasets/karate.mtx")),
     std::make_tuple(SSSP_Usecase{0}, cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
     std::make_tuple(SSSP_Usecase{1000},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+    std::make_tuple(SSSP_Usecase{0, true, cugraph::sssp_method_t::DELTA_STEPPING},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(SSSP_Usecase{0, true, cugraph::sssp_method_t::DELTA_STEPPING, 0.5},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(SSSP_Usecase{0, true, cugraph::sssp_method_t::DELTA_STEPPING},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
+    std::make_tuple(SSSP_Usecase{1000, true, cugraph::sssp_method_t::DELTA_STEPPING},
                     cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
   Tests_SSSP_Rmat,
   // enable correctness checks
-  ::testing::Values(std::make_tuple(
-    SSSP_Usecase{0}, cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+  ::testing::Values(
+    std::make_tuple(SSSP_Usecase{0},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(SSSP_Usecase{0, true, cugraph::sssp_method_t::DELTA_STEPPING},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
@@ -313,6 +288,8 @@ INSTANTIATE_TEST_SUITE_P(
   // disable correctness checks for large graphs
   ::testing::Values(
     std::make_tuple(SSSP_Usecase{0, false},
+                    cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(SSSP_Usecase{0, false, cugraph::sssp_method_t::DELTA_STEPPING},
                     cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -14,11 +14,13 @@
  * limitations under the License.
  */
 
+#include <utilities/file_parsing_utilities.hpp>
 #include <utilities/test_utilities.hpp>
 
 #include <detail/graph_partition_utils.cuh>
 
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_io.hpp>
 #include <cugraph/utilities/error.hpp>
 
 #include <raft/core/handle.hpp>
@@ -28,8 +30,10 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/remove.h>
 
+#include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <future>
+#include <limits>
 
 namespace cugraph {
 namespace test {
@@ -107,8 +111,188 @@ bool check_symmetric(raft::handle_t const& handle,
   }
 }
 
+template bool check_symmetric<int32_t, float>(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> edgelist_srcs,
+  raft::device_span<int32_t const> edgelist_dsts,
+  std::optional<raft::device_span<float const>> edgelist_weights);
+
+template bool check_symmetric<int32_t, double>(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> edgelist_srcs,
+  raft::device_span<int32_t const> edgelist_dsts,
+  std::optional<raft::device_span<double const>> edgelist_weights);
+
+template bool check_symmetric<int64_t, float>(
+  raft::handle_t const& handle,
+  raft::device_span<int64_t const> edgelist_srcs,
+  raft::device_span<int64_t const> edgelist_dsts,
+  std::optional<raft::device_span<float const>> edgelist_weights);
+
+template bool check_symmetric<int64_t, double>(
+  raft::handle_t const& handle,
+  raft::device_span<int64_t const> edgelist_srcs,
+  raft::device_span<int64_t const> edgelist_dsts,
+  std::optional<raft::device_span<double const>> edgelist_weights);
+
+// maximum number of edges in a batch when read_edgelist_from_csv_file streams the edges to the
+// device
+constexpr size_t csv_file_device_copy_batch_size{size_t{1} << 24};
+
+template <typename vertex_t, typename weight_t>
+struct csv_chunk_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> weights{};
+  size_t num_weighted_edges{0};
+};
+
+// parse a line-aligned chunk of a CSV file, every line should have a source, a destination, and an
+// optional weight
+template <typename vertex_t, typename weight_t>
+csv_chunk_edgelist_t<vertex_t, weight_t> parse_csv_chunk(char const* first,
+                                                          char const* last,
+                                                          bool store_weights)
+{
+  csv_chunk_edgelist_t<vertex_t, weight_t> ret{};
+
+  csv_tokenizer_t tokenizer(first, last);
+  char const* token_first{nullptr};
+  char const* token_last{nullptr};
+  bool end_of_line{false};
+  size_t num_tokens_this_line{0};
+  while (tokenizer.next(token_first, token_last, end_of_line)) {
+    auto ptr = token_first;
+    if (num_tokens_this_line < 2) {  // source or destination
+      int64_t v{};
+      CUGRAPH_EXPECTS(parse_integer(ptr, token_last, v),
+                      "Invalid input file contents (invalid vertex ID %s).",
+                      std::string(token_first, token_last).c_str());
+      CUGRAPH_EXPECTS((v >= std::numeric_limits<vertex_t>::lowest()) &&
+                        (v <= std::numeric_limits<vertex_t>::max()),
+                      "vertex_t overflow.");
+      (num_tokens_this_line == 0 ? ret.srcs : ret.dsts).push_back(static_cast<vertex_t>(v));
+    } else if (num_tokens_this_line == 2) {  // weight
+      double w{};
+      CUGRAPH_EXPECTS(parse_real(ptr, token_last, w),
+                      "Invalid input file contents (invalid weight %s).",
+                      std::string(token_first, token_last).c_str());
+      if (store_weights) { ret.weights.push_back(static_cast<weight_t>(w)); }
+      ++ret.num_weighted_edges;
+    } else {
+      CUGRAPH_FAIL("Too many tokens in a line.");
+    }
+    ++num_tokens_this_line;
+    if (end_of_line) {
+      CUGRAPH_EXPECTS(num_tokens_this_line >= 2,
+                      "Invalid input file contents (# source IDs != # destination IDs).");
+      num_tokens_this_line = 0;
+    }
+  }
+
+  return ret;
+}
+
 }  // namespace detail
 
+template <typename vertex_t, typename weight_t>
+void read_edgelist_from_csv_file_in_batches(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<vertex_t>&& srcs,
+                     std::vector<vertex_t>&& dsts,
+                     std::optional<std::vector<weight_t>>&& weights)> batch_op,
+  size_t num_threads)
+{
+  CUGRAPH_EXPECTS(batch_size > 0, "Invalid input argument: batch_size should be positive.");
+
+  detail::mmapped_file_t file(graph_file_full_path);
+  num_threads = detail::get_num_host_threads(num_threads);
+
+  // size the rounds based on the average line length in the first (up to) 1 MB of the file
+
+  auto sample_last      = file.begin() + std::min(file.size(), size_t{1} << 20);
+  auto num_sample_lines = static_cast<size_t>(std::count(file.begin(), sample_last, '\n'));
+  auto bytes_per_line   = std::max(
+    static_cast<size_t>(sample_last - file.begin()) / std::max(num_sample_lines, size_t{1}),
+    size_t{4} /* minimum line length ("0 1\n") */);
+  auto round_size = batch_size * bytes_per_line;
+
+  auto parse_round = [num_threads, test_weighted](char const* first, char const* last) {
+    auto boundaries = detail::split_into_line_aligned_chunks(first, last, num_threads);
+    std::vector<detail::csv_chunk_edgelist_t<vertex_t, weight_t>> chunks(num_threads);
+    detail::run_host_threads(num_threads, [&boundaries, &chunks, test_weighted](size_t i) {
+      chunks[i] = detail::parse_csv_chunk<vertex_t, weight_t>(
+        boundaries[i], boundaries[i + 1], test_weighted);
+    });
+    return chunks;
+  };
+
+  auto round_first      = file.begin();
+  auto start_next_round = [&round_first, &file, round_size, &parse_round]() {
+    auto round_last =
+      round_first + std::min(round_size, static_cast<size_t>(file.end() - round_first));
+    if ((round_last != file.end()) && (*(round_last - 1) != '\n')) {
+      round_last = detail::skip_line(round_last, file.end());
+    }
+    auto future = std::async(std::launch::async, parse_round, round_first, round_last);
+    round_first = round_last;
+    return future;
+  };
+
+  std::optional<bool> file_has_weights{std::nullopt};
+  std::vector<vertex_t> batch_srcs{};
+  std::vector<vertex_t> batch_dsts{};
+  std::vector<weight_t> batch_weights{};
+  auto flush_batch = [&batch_srcs, &batch_dsts, &batch_weights, &batch_op, test_weighted]() {
+    batch_op(std::move(batch_srcs),
+             std::move(batch_dsts),
+             test_weighted ? std::make_optional(std::move(batch_weights)) : std::nullopt);
+    batch_srcs.clear();
+    batch_dsts.clear();
+    batch_weights.clear();
+  };
+
+  // parse the next round while the current round's batches are consumed
+
+  auto future = start_next_round();
+  while (future.valid()) {
+    auto chunks = future.get();
+    if (round_first != file.end()) { future = start_next_round(); }
+
+    for (auto& chunk : chunks) {
+      if (chunk.srcs.size() == 0) { continue; }
+      CUGRAPH_EXPECTS(
+        (chunk.num_weighted_edges == 0) || (chunk.num_weighted_edges == chunk.srcs.size()),
+        "Invalid input file contents (# source IDs != # weights).");
+      if (!file_has_weights) { file_has_weights = chunk.num_weighted_edges > 0; }
+      CUGRAPH_EXPECTS(*file_has_weights == (chunk.num_weighted_edges > 0),
+                      "Invalid input file contents (# source IDs != # weights).");
+      CUGRAPH_EXPECTS(!test_weighted || *file_has_weights,
+                      "test_weighted set but weights are not provided.");
+
+      size_t offset{0};
+      while (offset < chunk.srcs.size()) {
+        auto n = std::min(chunk.srcs.size() - offset, batch_size - batch_srcs.size());
+        batch_srcs.insert(
+          batch_srcs.end(), chunk.srcs.begin() + offset, chunk.srcs.begin() + offset + n);
+        batch_dsts.insert(
+          batch_dsts.end(), chunk.dsts.begin() + offset, chunk.dsts.begin() + offset + n);
+        if (test_weighted) {
+          batch_weights.insert(batch_weights.end(),
+                               chunk.weights.begin() + offset,
+                               chunk.weights.begin() + offset + n);
+        }
+        offset += n;
+        if (batch_srcs.size() == batch_size) { flush_batch(); }
+      }
+      chunk = detail::csv_chunk_edgelist_t<vertex_t, weight_t>{};  // release memory
+    }
+  }
+  if (batch_srcs.size() > 0) { flush_batch(); }
+}
+
 template <typename vertex_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -118,89 +302,62 @@ read_edgelist_from_csv_file(raft::handle_t const& handle,
                             std::string const& graph_file_full_path,
                             bool test_weighted,
                             bool store_transposed,
-                            bool multi_gpu)
+                            bool multi_gpu,
+                            std::optional<cugraph::graph_file_properties_t> properties)
 {
-  std::ifstream file(graph_file_full_path);
-  CUGRAPH_EXPECTS(file.is_open(), "File open (%s) failure.", graph_file_full_path.c_str());
-
-  file.seekg(0, file.end);
-  auto length = file.tellg();
-  file.seekg(0, file.beg);
-
-  std::vector<char> buffer(length + 1);
-
-  file.read(buffer.data(), length);
-  CUGRAPH_EXPECTS(file, "File read failure.");
-
-  buffer.back() = '\0';  // null termination
-
-  file.close();
-
-  char const* delimiters = ", \t\n";
-
-  std::vector<vertex_t> h_edgelist_srcs{};
-  std::vector<vertex_t> h_edgelist_dsts{};
-  std::vector<weight_t> h_edgelist_weights{};
-
-  char const* cur = buffer.data();
-  size_t num_tokens_this_line{0};
-  while (cur) {
-    char const* prev = cur;
-    cur              = strpbrk(prev, delimiters);
-    if (cur) {
-      auto token = std::string(prev, cur);
-      if (num_tokens_this_line == 0) {  // source
-        auto src = stoll(token);
-        CUGRAPH_EXPECTS((src >= std::numeric_limits<vertex_t>::lowest()) &&
-                          (src <= std::numeric_limits<vertex_t>::max()),
-                        "vertex_t overflow.");
-        h_edgelist_srcs.push_back(static_cast<vertex_t>(src));
-      } else if (num_tokens_this_line == 1) {  // destination
-        auto dst = stoll(token);
-        CUGRAPH_EXPECTS((dst >= std::numeric_limits<vertex_t>::lowest()) &&
-                          (dst <= std::numeric_limits<vertex_t>::max()),
-                        "vertex_t overflow.");
-        h_edgelist_dsts.push_back(static_cast<vertex_t>(dst));
-      } else if (num_tokens_this_line == 2) {  // weight
-        auto w = stod(token);
-        h_edgelist_weights.push_back(static_cast<weight_t>(w));
-      } else {
-        CUGRAPH_FAIL("Too many tokens in a line.");
+  rmm::device_uvector<vertex_t> d_edgelist_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_edgelist_dsts(0, handle.get_stream());
+  auto d_edgelist_weights =
+    test_weighted ? std::make_optional<rmm::device_uvector<weight_t>>(0, handle.get_stream())
+                  : std::nullopt;
+
+  // pre-size the device buffers with the probed number of edges (with a small margin for the
+  // estimation error) to avoid re-allocating the buffers as the batches are appended
+
+  if (!properties) { properties = cugraph::probe_graph_file(graph_file_full_path); }
+  auto capacity = (*properties).is_exact
+                    ? (*properties).number_of_entries
+                    : (*properties).number_of_entries + (*properties).number_of_entries / 16;
+  d_edgelist_srcs.reserve(capacity, handle.get_stream());
+  d_edgelist_dsts.reserve(capacity, handle.get_stream());
+  if (d_edgelist_weights) { (*d_edgelist_weights).reserve(capacity, handle.get_stream()); }
+
+  // copy the edges to the device batch by batch (overlapped with parsing the next batch) to bound
+  // the host memory footprint
+
+  read_edgelist_from_csv_file_in_batches<vertex_t, weight_t>(
+    graph_file_full_path,
+    test_weighted,
+    detail::csv_file_device_copy_batch_size,
+    [&handle, &d_edgelist_srcs, &d_edgelist_dsts, &d_edgelist_weights](
+      std::vector<vertex_t>&& h_srcs,
+      std::vector<vertex_t>&& h_dsts,
+      std::optional<std::vector<weight_t>>&& h_weights) {
+      auto offset   = d_edgelist_srcs.size();
+      auto new_size = offset + h_srcs.size();
+      if (new_size > d_edgelist_srcs.capacity()) {
+        auto new_capacity = std::max(new_size, d_edgelist_srcs.capacity() * 2);
+        d_edgelist_srcs.reserve(new_capacity, handle.get_stream());
+        d_edgelist_dsts.reserve(new_capacity, handle.get_stream());
+        if (d_edgelist_weights) {
+          (*d_edgelist_weights).reserve(new_capacity, handle.get_stream());
+        }
       }
-      ++num_tokens_this_line;
-      auto num_delimiters = std::strspn(cur, delimiters);
-      for (size_t i = 0; i < num_delimiters; ++i) {
-        if (*cur == '\n') { num_tokens_this_line = 0; }
+      d_edgelist_srcs.resize(new_size, handle.get_stream());
+      d_edgelist_dsts.resize(new_size, handle.get_stream());
+      raft::update_device(
+        d_edgelist_srcs.data() + offset, h_srcs.data(), h_srcs.size(), handle.get_stream());
+      raft::update_device(
+        d_edgelist_dsts.data() + offset, h_dsts.data(), h_dsts.size(), handle.get_stream());
+      if (d_edgelist_weights) {
+        (*d_edgelist_weights).resize(new_size, handle.get_stream());
+        raft::update_device((*d_edgelist_weights).data() + offset,
+                            (*h_weights).data(),
+                            (*h_weights).size(),
+                            handle.get_stream());
       }
-      cur += num_delimiters;
-    }
-  }
-
-  CUGRAPH_EXPECTS(h_edgelist_srcs.size() == h_edgelist_dsts.size(),
-                  "Invalid input file contents (# source IDs != # destination IDs).");
-
-  CUGRAPH_EXPECTS(
-    (h_edgelist_weights.size() == 0) || (h_edgelist_srcs.size() == h_edgelist_weights.size()),
-    "Invalid input file contents (# source IDs != # weights).");
-  CUGRAPH_EXPECTS(!test_weighted || (h_edgelist_weights.size() > 0),
-                  "test_weighted set but weights are not provided.");
-
-  rmm::device_uvector<vertex_t> d_edgelist_srcs(h_edgelist_srcs.size(), handle.get_stream());
-  rmm::device_uvector<vertex_t> d_edgelist_dsts(h_edgelist_dsts.size(), handle.get_stream());
-  auto d_edgelist_weights = test_weighted ? std::make_optional<rmm::device_uvector<weight_t>>(
-                                              h_edgelist_weights.size(), handle.get_stream())
-                                          : std::nullopt;
-
-  raft::update_device(
-    d_edgelist_srcs.data(), h_edgelist_srcs.data(), h_edgelist_srcs.size(), handle.get_stream());
-  raft::update_device(
-    d_edgelist_dsts.data(), h_edgelist_dsts.data(), h_edgelist_dsts.size(), handle.get_stream());
-  if (d_edgelist_weights) {
-    raft::update_device((*d_edgelist_weights).data(),
-                        h_edgelist_weights.data(),
-                        h_edgelist_weights.size(),
-                        handle.get_stream());
-  }
+      handle.sync_stream();  // the host vectors go out of scope
+    });
 
   bool is_symmetric = detail::check_symmetric(
     handle,
@@ -316,15 +473,53 @@ read_graph_from_csv_file(raft::handle_t const& handle,
 
 // explicit instantiations
 
+template void read_edgelist_from_csv_file_in_batches<int32_t, float>(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<int32_t>&& srcs,
+                     std::vector<int32_t>&& dsts,
+                     std::optional<std::vector<float>>&& weights)> batch_op,
+  size_t num_threads);
+
+template void read_edgelist_from_csv_file_in_batches<int32_t, double>(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<int32_t>&& srcs,
+                     std::vector<int32_t>&& dsts,
+                     std::optional<std::vector<double>>&& weights)> batch_op,
+  size_t num_threads);
+
+template void read_edgelist_from_csv_file_in_batches<int64_t, float>(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<int64_t>&& srcs,
+                     std::vector<int64_t>&& dsts,
+                     std::optional<std::vector<float>>&& weights)> batch_op,
+  size_t num_threads);
+
+template void read_edgelist_from_csv_file_in_batches<int64_t, double>(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<int64_t>&& srcs,
+                     std::vector<int64_t>&& dsts,
+                     std::optional<std::vector<double>>&& weights)> batch_op,
+  size_t num_threads);
+
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
                     bool>
-read_edgelist_from_csv_file<int32_t, float>(raft::handle_t const& handle,
-                                            std::string const& graph_file_full_path,
-                                            bool test_weighted,
-                                            bool store_transposed,
-                                            bool multi_gpu);
+read_edgelist_from_csv_file<int32_t, float>(
+  raft::handle_t const& handle,
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  bool store_transposed,
+  bool multi_gpu,
+  std::optional<cugraph::graph_file_properties_t> properties);
 
 template std::tuple<
   cugraph::graph_t<int32_t, int32_t, false, false>,
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/error.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cugraph {
+namespace test {
+namespace detail {
+
+// read-only memory mapping of an entire file, the host text parsers below operate on
+// [data(), data() + size()) without copying the file contents into user space buffers
+class mmapped_file_t {
+ public:
+  explicit mmapped_file_t(std::string const& file_path)
+  {
+    auto fd = ::open(file_path.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd != -1, "open (%s) failure.", file_path.c_str());
+    try {
+      map(fd);
+    } catch (...) {
+      ::close(fd);
+      throw;
+    }
+    ::close(fd);  // the mapping holds its own reference to the file
+  }
+
+  // does not take the ownership of fd
+  explicit mmapped_file_t(int fd) { map(fd); }
+
+  mmapped_file_t(mmapped_file_t const&) = delete;
+  mmapped_file_t& operator=(mmapped_file_t const&) = delete;
+
+  mmapped_file_t(mmapped_file_t&& other) noexcept : data_(other.data_), size_(other.size_)
+  {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+
+  mmapped_file_t& operator=(mmapped_file_t&& other) noexcept
+  {
+    if (this != &other) {
+      unmap();
+      data_       = other.data_;
+      size_       = other.size_;
+      other.data_ = nullptr;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  ~mmapped_file_t() { unmap(); }
+
+  char const* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  char const* begin() const { return data_; }
+  char const* end() const { return data_ + size_; }
+
+ private:
+  void map(int fd)
+  {
+    struct stat st {};
+    CUGRAPH_EXPECTS(::fstat(fd, &st) == 0, "fstat failure.");
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+      auto ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      CUGRAPH_EXPECTS(ptr != MAP_FAILED, "mmap failure.");
+      ::madvise(ptr, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<char const*>(ptr);
+    }
+  }
+
+  void unmap()
+  {
+    if (data_ != nullptr) { ::munmap(const_cast<char*>(data_), size_); }
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  char const* data_{nullptr};
+  size_t size_{0};
+};
+
+inline size_t get_num_host_threads(size_t num_threads /* 0: use all the available cores */)
+{
+  if (num_threads == 0) { num_threads = std::max(std::thread::hardware_concurrency(), 1u); }
+  return num_threads;
+}
+
+// split [first, last) to num_chunks chunks starting at a line boundary, returns num_chunks + 1
+// chunk boundaries (some chunks can be empty if there are fewer lines than num_chunks)
+inline std::vector<char const*> split_into_line_aligned_chunks(char const* first,
+                                                               char const* last,
+                                                               size_t num_chunks)
+{
+  std::vector<char const*> boundaries(num_chunks + 1);
+  boundaries[0]          = first;
+  boundaries[num_chunks] = last;
+  auto size              = static_cast<size_t>(last - first);
+  for (size_t i = 1; i < num_chunks; ++i) {
+    auto ptr = std::max(first + (size / num_chunks) * i, boundaries[i - 1]);
+    if ((ptr != first) && (ptr != last) && (*(ptr - 1) != '\n')) {
+      ptr = static_cast<char const*>(std::memchr(ptr, '\n', last - ptr));
+      ptr = (ptr != nullptr) ? ptr + 1 : last;
+    }
+    boundaries[i] = ptr;
+  }
+  return boundaries;
+}
+
+// invoke f(i) for i in [0, num_tasks) on num_tasks host threads and re-throw the first exception
+// (if any) after joining all the threads
+template <typename F>
+void run_host_threads(size_t num_tasks, F f)
+{
+  std::vector<std::exception_ptr> exceptions(num_tasks, nullptr);
+  std::vector<std::thread> threads{};
+  threads.reserve(num_tasks);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    threads.emplace_back([i, &f, &exceptions]() {
+      try {
+        f(i);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& e : exceptions) {
+    if (e) { std::rethrow_exception(e); }
+  }
+}
+
+inline bool is_blank(char c) { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+inline bool is_token_end(char c) { return is_blank(c) || (c == '\n'); }
+
+inline char const* skip_blanks(char const* cur, char const* last)
+{
+  while ((cur != last) && is_blank(*cur)) {
+    ++cur;
+  }
+  return cur;
+}
+
+// returns a pointer to the first character of the next line (or last)
+inline char const* skip_line(char const* cur, char const* last)
+{
+  auto ptr = static_cast<char const*>(std::memchr(cur, '\n', last - cur));
+  return (ptr != nullptr) ? ptr + 1 : last;
+}
+
+// parse a decimal integer starting at cur, advance cur past the integer and return true on success
+// (cur is not advanced on failure)
+inline bool parse_integer(char const*& cur, char const* last, int64_t& val)
+{
+  auto ptr      = cur;
+  bool negative = false;
+  if ((ptr != last) && ((*ptr == '-') || (*ptr == '+'))) {
+    negative = (*ptr == '-');
+    ++ptr;
+  }
+  auto digit_first = ptr;
+  uint64_t mag{0};
+  while ((ptr != last) && (static_cast<unsigned char>(*ptr - '0') < 10)) {
+    // any 19 digit number fits in uint64_t (< 1.8e19), the range of int64_t is checked below
+    if (ptr - digit_first < 19) { mag = mag * 10 + static_cast<uint64_t>(*ptr - '0'); }
+    ++ptr;
+  }
+  auto num_digits = ptr - digit_first;
+  if ((num_digits == 0) || (num_digits > 19) || ((ptr != last) && !is_token_end(*ptr))) {
+    return false;
+  }
+  auto max_mag = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1 : 0);
+  if (mag > max_mag) { return false; }
+  // -(mag - 1) - 1 to avoid overflowing int64_t for mag = 2^63
+  val = (negative && (mag > 0)) ? -static_cast<int64_t>(mag - 1) - 1 : static_cast<int64_t>(mag);
+  cur = ptr;
+  return true;
+}
+
+// parse a floating point number starting at cur, advance cur past the number and return true on
+// success (cur is not advanced on failure); numbers with at most 15 significant digits and a
+// decimal exponent within [-22, 22] are converted exactly without calling strtod (Clinger's fast
+// path), everything else (including inf/nan) falls back to strtod
+inline bool parse_real(char const*& cur, char const* last, double& val)
+{
+  static constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                     1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                     1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  auto ptr      = cur;
+  bool negative = false;
+  if ((ptr != last) && ((*ptr == '-') || (*ptr == '+'))) {
+    negative = (*ptr == '-');
+    ++ptr;
+  }
+
+  uint64_t mantissa{0};
+  int num_significant_digits{0};
+  int exponent{0};
+  bool has_digits{false};
+  while ((ptr != last) && (static_cast<unsigned char>(*ptr - '0') < 10)) {
+    if ((mantissa > 0) || (*ptr != '0')) { ++num_significant_digits; }
+    if (num_significant_digits <= 19) { mantissa = mantissa * 10 + (*ptr - '0'); }
+    if (num_significant_digits > 19) { ++exponent; }
+    has_digits = true;
+    ++ptr;
+  }
+  if ((ptr != last) && (*ptr == '.')) {
+    ++ptr;
+    while ((ptr != last) && (static_cast<unsigned char>(*ptr - '0') < 10)) {
+      if ((mantissa > 0) || (*ptr != '0')) { ++num_significant_digits; }
+      if (num_significant_digits <= 19) {
+        mantissa = mantissa * 10 + (*ptr - '0');
+        --exponent;
+      }
+      has_digits = true;
+      ++ptr;
+    }
+  }
+  if (has_digits && (ptr != last) && ((*ptr == 'e') || (*ptr == 'E'))) {
+    auto exp_ptr = ptr + 1;
+    bool exp_negative{false};
+    if ((exp_ptr != last) && ((*exp_ptr == '-') || (*exp_ptr == '+'))) {
+      exp_negative = (*exp_ptr == '-');
+      ++exp_ptr;
+    }
+    int exp_val{0};
+    auto exp_digit_first = exp_ptr;
+    while ((exp_ptr != last) && (static_cast<unsigned char>(*exp_ptr - '0') < 10)) {
+      if (exp_val < 100000) { exp_val = exp_val * 10 + (*exp_ptr - '0'); }
+      ++exp_ptr;
+    }
+    if (exp_ptr != exp_digit_first) {
+      exponent += exp_negative ? -exp_val : exp_val;
+      ptr = exp_ptr;
+    }
+  }
+
+  if (has_digits && ((ptr == last) || is_token_end(*ptr))) {
+    if ((num_significant_digits <= 15) && (exponent >= -22) && (exponent <= 22)) {
+      auto ret = static_cast<double>(mantissa);
+      ret      = exponent < 0 ? ret / pow10[-exponent] : ret * pow10[exponent];
+      val      = negative ? -ret : ret;
+      cur      = ptr;
+      return true;
+    }
+  }
+
+  // slow path
+
+  auto token_last = cur;
+  while ((token_last != last) && !is_token_end(*token_last)) {
+    ++token_last;
+  }
+  char buffer[128];
+  auto length = static_cast<size_t>(token_last - cur);
+  if ((length == 0) || (length >= sizeof(buffer))) { return false; }
+  std::memcpy(buffer, cur, length);
+  buffer[length] = '\0';
+  char* end_ptr{nullptr};
+  auto ret = std::strtod(buffer, &end_ptr);
+  if (end_ptr != buffer + length) { return false; }
+  val = ret;
+  cur = token_last;
+  return true;
+}
+
+inline bool is_csv_delimiter(char c)
+{
+  return (c == ',') || (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+// bit i of the returned mask is set if ptr[i] is a CSV delimiter (',', ' ', '\t', '\r', or '\n'),
+// n should not exceed 64, 16 characters are compared at a time if SSE2 is available
+inline uint64_t compute_csv_delimiter_mask(char const* ptr, size_t n)
+{
+  uint64_t mask{0};
+  size_t i{0};
+#if defined(__SSE2__)
+  auto const comma           = _mm_set1_epi8(',');
+  auto const space           = _mm_set1_epi8(' ');
+  auto const tab             = _mm_set1_epi8('\t');
+  auto const carriage_return = _mm_set1_epi8('\r');
+  auto const newline         = _mm_set1_epi8('\n');
+  for (; i + 16 <= n; i += 16) {
+    auto block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i));
+    auto eq    = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(block, comma), _mm_cmpeq_epi8(block, space)),
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, tab), _mm_cmpeq_epi8(block, carriage_return)),
+                   _mm_cmpeq_epi8(block, newline)));
+    mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(eq)) & uint32_t{0xffff})
+            << i;
+  }
+#endif
+  for (; i < n; ++i) {
+    if (is_csv_delimiter(ptr[i])) { mask |= uint64_t{1} << i; }
+  }
+  return mask;
+}
+
+// splits [first, last) to CSV tokens, the delimiter positions are computed 64 characters at a time
+// (see compute_csv_delimiter_mask) and tokens are located by scanning the bit masks, consecutive
+// delimiters are treated as one
+class csv_tokenizer_t {
+ public:
+  csv_tokenizer_t(char const* first, char const* last)
+    : cur_(first), last_(last), block_first_(first)
+  {
+  }
+
+  // returns false if there is no more token, otherwise, stores the next token in [token_first,
+  // token_last) and sets end_of_line to true if this is the last token in the line
+  bool next(char const*& token_first, char const*& token_last, bool& end_of_line)
+  {
+    while (true) {
+      auto ptr = find(cur_, false);
+      if (ptr == last_) {
+        cur_ = last_;
+        return false;
+      }
+      if (ptr != cur_) {  // skip delimiters, an empty line ends here
+        cur_ = ptr;
+        continue;
+      }
+      token_first = cur_;
+      token_last  = find(cur_, true);
+      cur_        = token_last;
+
+      // a token is the last token in the line if there is no other token before the next newline
+      end_of_line = true;
+      while (cur_ != last_) {
+        if (*cur_ == '\n') {
+          ++cur_;
+          break;
+        }
+        if (!is_csv_delimiter(*cur_)) {
+          end_of_line = false;
+          break;
+        }
+        ++cur_;
+      }
+      return true;
+    }
+  }
+
+ private:
+  // returns a pointer to the first delimiter (if delimiter is true) or the first non-delimiter (if
+  // delimiter is false) in [ptr, last_) (or last_)
+  char const* find(char const* ptr, bool delimiter)
+  {
+    while (ptr != last_) {
+      if ((ptr < block_first_) || (ptr >= block_first_ + block_size_)) {
+        block_first_ = ptr;
+        block_size_  = std::min(static_cast<size_t>(last_ - ptr), size_t{64});
+        block_mask_  = compute_csv_delimiter_mask(ptr, block_size_);
+      }
+      auto shift = static_cast<size_t>(ptr - block_first_);
+      auto mask  = (delimiter ? block_mask_ : ~block_mask_) >> shift;
+      if (block_size_ - shift < 64) { mask &= (uint64_t{1} << (block_size_ - shift)) - 1; }
+      if (mask != 0) { return ptr + __builtin_ctzll(mask); }
+      ptr = block_first_ + block_size_;
+    }
+    return last_;
+  }
+
+  char const* cur_{nullptr};
+  char const* last_{nullptr};
+  char const* block_first_{nullptr};
+  size_t block_size_{0};
+  uint64_t block_mask_{0};
+};
+
+}  // namespace detail
+}  // namespace test
+}  // namespace cugraph
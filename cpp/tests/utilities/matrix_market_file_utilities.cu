@@ -15,6 +15,7 @@
  */
 
 #include <detail/graph_partition_utils.cuh>
+#include <utilities/file_parsing_utilities.hpp>
 #include <utilities/test_utilities.hpp>
 
 #include <cugraph/graph_functions.hpp>
@@ -30,11 +31,257 @@
 #include <thrust/sequence.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <cctype>
 #include <cstdint>
+#include <limits>
+#include <numeric>
+#include <sstream>
 
 namespace cugraph {
 namespace test {
 
+namespace detail {
+
+matrix_market_header_t parse_matrix_market_header(char const* first, char const* last)
+{
+  matrix_market_header_t header{};
+
+  // 1. read the banner
+
+  auto line_last = skip_line(first, last);
+  std::string banner(first, line_last);
+  std::transform(banner.begin(), banner.end(), banner.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  std::istringstream iss(banner);
+  std::string token{}, object{}, format{}, field{}, symmetry{};
+  iss >> token >> object >> format >> field >> symmetry;
+  std::string banner_token(MatrixMarketBanner);
+  std::transform(
+    banner_token.begin(), banner_token.end(), banner_token.begin(), [](unsigned char c) {
+      return static_cast<char>(std::tolower(c));
+    });
+  CUGRAPH_EXPECTS(token == banner_token, "could not read Matrix Market file banner.");
+
+  mm_clear_typecode(&(header.typecode));
+  if (object == MM_MTX_STR) { mm_set_matrix(&(header.typecode)); }
+  if (format == MM_SPARSE_STR) {
+    mm_set_coordinate(&(header.typecode));
+  } else if (format == MM_DENSE_STR) {
+    mm_set_array(&(header.typecode));
+  }
+  if (field == MM_REAL_STR) {
+    mm_set_real(&(header.typecode));
+  } else if (field == MM_COMPLEX_STR) {
+    mm_set_complex(&(header.typecode));
+  } else if (field == MM_PATTERN_STR) {
+    mm_set_pattern(&(header.typecode));
+  } else if (field == MM_INT_STR) {
+    mm_set_integer(&(header.typecode));
+  }
+  if (symmetry == MM_GENERAL_STR) {
+    mm_set_general(&(header.typecode));
+  } else if (symmetry == MM_SYMM_STR) {
+    mm_set_symmetric(&(header.typecode));
+  } else if (symmetry == MM_HERM_STR) {
+    mm_set_hermitian(&(header.typecode));
+  } else if (symmetry == MM_SKEW_STR) {
+    mm_set_skew(&(header.typecode));
+  }
+  CUGRAPH_EXPECTS(mm_is_matrix(header.typecode) && mm_is_coordinate(header.typecode),
+                  "file does not contain matrix in coordinate format.");
+  CUGRAPH_EXPECTS(mm_is_pattern(header.typecode) || mm_is_real(header.typecode) ||
+                    mm_is_integer(header.typecode) || mm_is_complex(header.typecode),
+                  "matrix entries are not valid type.");
+  CUGRAPH_EXPECTS(mm_is_general(header.typecode) || mm_is_symmetric(header.typecode) ||
+                    mm_is_hermitian(header.typecode) || mm_is_skew(header.typecode),
+                  "matrix symmetry is not valid type.");
+
+  // 2. skip comments and read the size line (64 bit values, mm_read_mtx_crd_size is limited to int)
+
+  auto cur = line_last;
+  while (cur != last) {
+    auto ptr = skip_blanks(cur, last);
+    if ((ptr != last) && (*ptr != '%') && (*ptr != '\n')) { break; }
+    cur = skip_line(cur, last);
+  }
+  cur = skip_blanks(cur, last);
+  int64_t sizes[3]{};
+  for (size_t i = 0; i < 3; ++i) {
+    CUGRAPH_EXPECTS(parse_integer(cur, last, sizes[i]) && (sizes[i] >= 0),
+                    "could not read matrix dimensions.");
+    cur = skip_blanks(cur, last);
+  }
+  header.number_of_rows    = static_cast<size_t>(sizes[0]);
+  header.number_of_columns = static_cast<size_t>(sizes[1]);
+  header.number_of_entries = static_cast<size_t>(sizes[2]);
+  header.body_offset       = static_cast<size_t>(skip_line(cur, last) - first);
+
+  return header;
+}
+
+namespace {
+
+// invoke entry_op(row, col, rval, ival) (0-based row & column indices) for every entry line in
+// [first, last)
+template <typename entry_op_t>
+void for_each_matrix_market_entry(char const* first,
+                                  char const* last,
+                                  matrix_market_header_t const& header,
+                                  entry_op_t entry_op)
+{
+  auto is_pattern = mm_is_pattern(header.typecode);
+  auto is_complex = mm_is_complex(header.typecode);
+  auto num_rows   = static_cast<int64_t>(header.number_of_rows);
+  auto num_cols   = static_cast<int64_t>(header.number_of_columns);
+
+  auto cur = first;
+  while (cur != last) {
+    cur = skip_blanks(cur, last);
+    if (cur == last) { break; }
+    if ((*cur == '\n') || (*cur == '%')) {
+      cur = skip_line(cur, last);
+      continue;
+    }
+
+    int64_t row{};
+    int64_t col{};
+    double rval{1.0};
+    double ival{0.0};
+    bool valid = parse_integer(cur, last, row);
+    if (valid) {
+      cur   = skip_blanks(cur, last);
+      valid = parse_integer(cur, last, col);
+    }
+    if (valid && !is_pattern) {
+      cur   = skip_blanks(cur, last);
+      valid = parse_real(cur, last, rval);
+      if (valid && is_complex) {
+        cur   = skip_blanks(cur, last);
+        valid = parse_real(cur, last, ival);
+      }
+    }
+    CUGRAPH_EXPECTS(valid, "invalid Matrix Market file entry.");
+    CUGRAPH_EXPECTS((row >= 1) && (row <= num_rows) && (col >= 1) && (col <= num_cols),
+                    "Matrix Market file entry index out of range.");
+
+    entry_op(row - 1, col - 1, rval, ival);  // switch to 0-based indexing
+
+    cur = skip_line(cur, last);
+  }
+}
+
+// parse all the entries in a line-aligned chunk per host thread into thread-local buffers and
+// concatenate the buffers in the file order, the output order is identical to the sequential
+// reader's order (each mirrored entry immediately follows its original entry)
+template <typename index_t, typename value_t>
+std::tuple<std::vector<index_t>,
+           std::vector<index_t>,
+           std::optional<std::vector<value_t>>,
+           std::optional<std::vector<value_t>>>
+matrix_market_entries_to_coo(char const* first,
+                             char const* last,
+                             matrix_market_header_t const& header,
+                             bool expand_to_general,
+                             bool store_rvals,
+                             bool store_ivals,
+                             size_t num_threads)
+{
+  CUGRAPH_EXPECTS(
+    std::max(header.number_of_rows, header.number_of_columns) <=
+      static_cast<size_t>(std::numeric_limits<index_t>::max()),
+    "Invalid template parameter: index_t overflow.");
+
+  num_threads = get_num_host_threads(num_threads);
+  auto chunk_boundaries = split_into_line_aligned_chunks(first, last, num_threads);
+
+  auto expand      = expand_to_general && !mm_is_general(header.typecode);
+  auto is_skew     = mm_is_skew(header.typecode);
+  auto is_hermitan = mm_is_hermitian(header.typecode);
+
+  std::vector<std::vector<index_t>> chunk_rows(num_threads);
+  std::vector<std::vector<index_t>> chunk_cols(num_threads);
+  std::vector<std::vector<value_t>> chunk_rvals(num_threads);
+  std::vector<std::vector<value_t>> chunk_ivals(num_threads);
+  std::vector<size_t> chunk_entry_counts(num_threads, 0);
+
+  run_host_threads(num_threads, [&](size_t i) {
+    auto approx_num_entries =
+      (header.number_of_entries / num_threads + 1) * (expand ? size_t{2} : size_t{1});
+    chunk_rows[i].reserve(approx_num_entries);
+    chunk_cols[i].reserve(approx_num_entries);
+    if (store_rvals) { chunk_rvals[i].reserve(approx_num_entries); }
+    if (store_ivals) { chunk_ivals[i].reserve(approx_num_entries); }
+    size_t count{0};
+    for_each_matrix_market_entry(
+      chunk_boundaries[i],
+      chunk_boundaries[i + 1],
+      header,
+      [&](int64_t row, int64_t col, double rval, double ival) {
+        chunk_rows[i].push_back(static_cast<index_t>(row));
+        chunk_cols[i].push_back(static_cast<index_t>(col));
+        if (store_rvals) { chunk_rvals[i].push_back(static_cast<value_t>(rval)); }
+        if (store_ivals) { chunk_ivals[i].push_back(static_cast<value_t>(ival)); }
+        if (expand && (row != col)) {
+          // modify entry value if matrix is skew symmetric or Hermitian
+          if (is_skew) {
+            rval = -rval;
+            ival = -ival;
+          } else if (is_hermitan) {
+            ival = -ival;
+          }
+          chunk_rows[i].push_back(static_cast<index_t>(col));
+          chunk_cols[i].push_back(static_cast<index_t>(row));
+          if (store_rvals) { chunk_rvals[i].push_back(static_cast<value_t>(rval)); }
+          if (store_ivals) { chunk_ivals[i].push_back(static_cast<value_t>(ival)); }
+        }
+        ++count;
+      });
+    chunk_entry_counts[i] = count;
+  });
+
+  CUGRAPH_EXPECTS(std::reduce(chunk_entry_counts.begin(), chunk_entry_counts.end()) ==
+                    header.number_of_entries,
+                  "# entries in the Matrix Market file does not match with the size line.");
+
+  std::vector<size_t> chunk_offsets(num_threads + 1, 0);
+  for (size_t i = 0; i < num_threads; ++i) {
+    chunk_offsets[i + 1] = chunk_offsets[i] + chunk_rows[i].size();
+  }
+
+  std::vector<index_t> rows(chunk_offsets.back());
+  std::vector<index_t> cols(chunk_offsets.back());
+  auto rvals = store_rvals ? std::make_optional<std::vector<value_t>>(chunk_offsets.back())
+                           : std::nullopt;
+  auto ivals = store_ivals ? std::make_optional<std::vector<value_t>>(chunk_offsets.back())
+                           : std::nullopt;
+
+  run_host_threads(num_threads, [&](size_t i) {
+    std::copy(chunk_rows[i].begin(), chunk_rows[i].end(), rows.begin() + chunk_offsets[i]);
+    std::copy(chunk_cols[i].begin(), chunk_cols[i].end(), cols.begin() + chunk_offsets[i]);
+    if (rvals) {
+      std::copy(
+        chunk_rvals[i].begin(), chunk_rvals[i].end(), (*rvals).begin() + chunk_offsets[i]);
+    }
+    if (ivals) {
+      std::copy(
+        chunk_ivals[i].begin(), chunk_ivals[i].end(), (*ivals).begin() + chunk_offsets[i]);
+    }
+    // release the thread-local buffers as soon as they are copied to limit peak host memory usage
+    std::vector<index_t>().swap(chunk_rows[i]);
+    std::vector<index_t>().swap(chunk_cols[i]);
+    std::vector<value_t>().swap(chunk_rvals[i]);
+    std::vector<value_t>().swap(chunk_ivals[i]);
+  });
+
+  return std::make_tuple(std::move(rows), std::move(cols), std::move(rvals), std::move(ivals));
+}
+
+}  // namespace
+
+}  // namespace detail
+
 /// Read matrix properties from Matrix Market file
 /** Matrix Market file is assumed to be a sparse matrix in coordinate
  *  format.
@@ -52,58 +299,39 @@ namespace test {
 template <typename IndexType_>
 int mm_properties(FILE* f, int tg, MM_typecode* t, IndexType_* m, IndexType_* n, IndexType_* nnz)
 {
-  // Read matrix properties from file
-  int mint, nint, nnzint;
-  if (fseek(f, 0, SEEK_SET)) {
-    fprintf(stderr, "Error: could not set position in file\n");
-    return -1;
-  }
-  if (mm_read_banner(f, t)) {
-    fprintf(stderr, "Error: could not read Matrix Market file banner\n");
-    return -1;
-  }
-  if (!mm_is_matrix(*t) || !mm_is_coordinate(*t)) {
-    fprintf(stderr, "Error: file does not contain matrix in coordinate format\n");
-    return -1;
-  }
-  if (mm_read_mtx_crd_size(f, &mint, &nint, &nnzint)) {
-    fprintf(stderr, "Error: could not read matrix dimensions\n");
-    return -1;
-  }
-  if (!mm_is_pattern(*t) && !mm_is_real(*t) && !mm_is_integer(*t) && !mm_is_complex(*t)) {
-    fprintf(stderr, "Error: matrix entries are not valid type\n");
-    return -1;
-  }
-  *m   = mint;
-  *n   = nint;
-  *nnz = nnzint;
-
-  // Find total number of non-zero entries
-  if (tg && !mm_is_general(*t)) {
-    // Non-diagonal entries should be counted twice
-    *nnz *= 2;
-
-    // Diagonal entries should not be double-counted
-    int st;
-    for (int i = 0; i < nnzint; ++i) {
-      // Read matrix entry
-      // MTX only supports int for row and col idx
-      int row, col;
-      double rval, ival;
-      if (mm_is_pattern(*t))
-        st = fscanf(f, "%d %d\n", &row, &col);
-      else if (mm_is_real(*t) || mm_is_integer(*t))
-        st = fscanf(f, "%d %d %lg\n", &row, &col, &rval);
-      else  // Complex matrix
-        st = fscanf(f, "%d %d %lg %lg\n", &row, &col, &rval, &ival);
-      if (ferror(f) || (st == EOF)) {
-        fprintf(stderr, "Error: error %d reading Matrix Market file (entry %d)\n", st, i + 1);
-        return -1;
-      }
-
-      // Check if entry is diagonal
-      if (row == col) --(*nnz);
+  try {
+    detail::mmapped_file_t file(fileno(f));
+    auto header = detail::parse_matrix_market_header(file.begin(), file.end());
+
+    std::copy(header.typecode, header.typecode + sizeof(MM_typecode), *t);
+    *m   = static_cast<IndexType_>(header.number_of_rows);
+    *n   = static_cast<IndexType_>(header.number_of_columns);
+    *nnz = static_cast<IndexType_>(header.number_of_entries);
+
+    // Find total number of non-zero entries
+    if (tg && !mm_is_general(*t)) {
+      // Non-diagonal entries should be counted twice, diagonal entries should not be double-counted
+      auto num_threads = detail::get_num_host_threads(0);
+      auto chunk_boundaries = detail::split_into_line_aligned_chunks(
+        file.begin() + header.body_offset, file.end(), num_threads);
+      std::vector<size_t> chunk_diagonal_counts(num_threads, 0);
+      detail::run_host_threads(num_threads, [&](size_t i) {
+        size_t count{0};
+        detail::for_each_matrix_market_entry(
+          chunk_boundaries[i],
+          chunk_boundaries[i + 1],
+          header,
+          [&count](int64_t row, int64_t col, double, double) {
+            if (row == col) { ++count; }
+          });
+        chunk_diagonal_counts[i] = count;
+      });
+      auto num_diagonals = std::reduce(chunk_diagonal_counts.begin(), chunk_diagonal_counts.end());
+      *nnz = static_cast<IndexType_>(header.number_of_entries * 2 - num_diagonals);
     }
+  } catch (std::exception const& e) {
+    fprintf(stderr, "Error: could not read Matrix Market file properties (%s)\n", e.what());
+    return -1;
   }
 
   return 0;
@@ -138,82 +366,63 @@ int mm_to_coo(FILE* f,
               ValueType_* cooRVal,
               ValueType_* cooIVal)
 {
-  // Read matrix properties from file
-  MM_typecode t;
-  int m, n, nnzOld;
-  if (fseek(f, 0, SEEK_SET)) {
-    fprintf(stderr, "Error: could not set position in file\n");
-    return -1;
-  }
-  if (mm_read_banner(f, &t)) {
-    fprintf(stderr, "Error: could not read Matrix Market file banner\n");
-    return -1;
-  }
-  if (!mm_is_matrix(t) || !mm_is_coordinate(t)) {
-    fprintf(stderr, "Error: file does not contain matrix in coordinate format\n");
-    return -1;
-  }
-  if (mm_read_mtx_crd_size(f, &m, &n, &nnzOld)) {
-    fprintf(stderr, "Error: could not read matrix dimensions\n");
-    return -1;
-  }
-  if (!mm_is_pattern(t) && !mm_is_real(t) && !mm_is_integer(t) && !mm_is_complex(t)) {
-    fprintf(stderr, "Error: matrix entries are not valid type\n");
+  try {
+    detail::mmapped_file_t file(fileno(f));
+    auto header = detail::parse_matrix_market_header(file.begin(), file.end());
+
+    auto [rows, cols, rvals, ivals] = detail::matrix_market_entries_to_coo<IndexType_, ValueType_>(
+      file.begin() + header.body_offset,
+      file.end(),
+      header,
+      tg != 0,
+      cooRVal != NULL,
+      cooIVal != NULL,
+      size_t{0});
+    CUGRAPH_EXPECTS(rows.size() <= static_cast<size_t>(nnz),
+                    "# matrix entries exceeds the output buffer size.");
+
+    std::copy(rows.begin(), rows.end(), cooRowInd);
+    std::copy(cols.begin(), cols.end(), cooColInd);
+    if (cooRVal != NULL) { std::copy((*rvals).begin(), (*rvals).end(), cooRVal); }
+    if (cooIVal != NULL) { std::copy((*ivals).begin(), (*ivals).end(), cooIVal); }
+  } catch (std::exception const& e) {
+    fprintf(stderr, "Error: could not read Matrix Market file (%s)\n", e.what());
     return -1;
   }
 
-  // Add each matrix entry in file to COO format matrix
-  int i;      // Entry index in Matrix Market file; can only be int in the MTX format
-  int j = 0;  // Entry index in COO format matrix; can only be int in the MTX format
-  for (i = 0; i < nnzOld; ++i) {
-    // Read entry from file
-    int row, col;
-    double rval, ival;
-    int st;
-    if (mm_is_pattern(t)) {
-      st   = fscanf(f, "%d %d\n", &row, &col);
-      rval = 1.0;
-      ival = 0.0;
-    } else if (mm_is_real(t) || mm_is_integer(t)) {
-      st   = fscanf(f, "%d %d %lg\n", &row, &col, &rval);
-      ival = 0.0;
-    } else  // Complex matrix
-      st = fscanf(f, "%d %d %lg %lg\n", &row, &col, &rval, &ival);
-    if (ferror(f) || (st == EOF)) {
-      fprintf(stderr, "Error: error %d reading Matrix Market file (entry %d)\n", st, i + 1);
-      return -1;
-    }
+  return 0;
+}
 
-    // Switch to 0-based indexing
-    --row;
-    --col;
-
-    // Record entry
-    cooRowInd[j] = row;
-    cooColInd[j] = col;
-    if (cooRVal != NULL) cooRVal[j] = rval;
-    if (cooIVal != NULL) cooIVal[j] = ival;
-    ++j;
-
-    // Add symmetric complement of non-diagonal entries
-    if (tg && !mm_is_general(t) && (row != col)) {
-      // Modify entry value if matrix is skew symmetric or Hermitian
-      if (mm_is_skew(t)) {
-        rval = -rval;
-        ival = -ival;
-      } else if (mm_is_hermitian(t)) {
-        ival = -ival;
-      }
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>,
+           std::vector<vertex_t>,
+           std::optional<std::vector<weight_t>>,
+           vertex_t,
+           bool>
+read_edgelist_from_matrix_market_file_to_host(std::string const& graph_file_full_path,
+                                              bool test_weighted,
+                                              size_t num_threads)
+{
+  detail::mmapped_file_t file(graph_file_full_path);
+  auto header = detail::parse_matrix_market_header(file.begin(), file.end());
+  auto mc     = header.typecode;
+  CUGRAPH_EXPECTS(mm_is_matrix(mc) && mm_is_coordinate(mc) && !mm_is_complex(mc) && !mm_is_skew(mc),
+                  "invalid Matrix Market file properties.");
 
-      // Record entry
-      cooRowInd[j] = col;
-      cooColInd[j] = row;
-      if (cooRVal != NULL) cooRVal[j] = rval;
-      if (cooIVal != NULL) cooIVal[j] = ival;
-      ++j;
-    }
-  }
-  return 0;
+  auto [rows, cols, weights, ivals] =
+    detail::matrix_market_entries_to_coo<vertex_t, weight_t>(file.begin() + header.body_offset,
+                                                             file.end(),
+                                                             header,
+                                                             true,
+                                                             test_weighted,
+                                                             false,
+                                                             num_threads);
+
+  return std::make_tuple(std::move(rows),
+                         std::move(cols),
+                         std::move(weights),
+                         static_cast<vertex_t>(header.number_of_rows),
+                         static_cast<bool>(mm_is_symmetric(mc)));
 }
 
 // FIXME: A similar function could be useful for CSC format
@@ -225,39 +434,14 @@ template <typename vertex_t, typename edge_t, typename weight_t>
 std::unique_ptr<cugraph::legacy::GraphCSR<vertex_t, edge_t, weight_t>> generate_graph_csr_from_mm(
   bool& directed, std::string mm_file)
 {
-  vertex_t number_of_vertices;
-  edge_t number_of_edges;
-
-  FILE* fpin = fopen(mm_file.c_str(), "r");
-  CUGRAPH_EXPECTS(fpin != nullptr, "fopen (%s) failure.", mm_file.c_str());
+  auto [coo_row_ind, coo_col_ind, coo_val, number_of_vertices, is_symmetric] =
+    read_edgelist_from_matrix_market_file_to_host<vertex_t, weight_t>(mm_file, true, size_t{0});
+  auto number_of_edges = static_cast<edge_t>(coo_row_ind.size());
 
-  vertex_t number_of_columns = 0;
-  MM_typecode mm_typecode{0};
-  CUGRAPH_EXPECTS(
-    mm_properties<vertex_t>(
-      fpin, 1, &mm_typecode, &number_of_vertices, &number_of_columns, &number_of_edges) == 0,
-    "mm_properties query failure.");
-  CUGRAPH_EXPECTS(mm_is_matrix(mm_typecode), "Invalid input file.");
-  CUGRAPH_EXPECTS(mm_is_coordinate(mm_typecode), "Invalid input file.");
-  CUGRAPH_EXPECTS(!mm_is_complex(mm_typecode), "Invalid input file.");
-  CUGRAPH_EXPECTS(!mm_is_skew(mm_typecode), "Invalid input file.");
-
-  directed = !mm_is_symmetric(mm_typecode);
-
-  // Allocate memory on host
-  std::vector<vertex_t> coo_row_ind(number_of_edges);
-  std::vector<vertex_t> coo_col_ind(number_of_edges);
-  std::vector<weight_t> coo_val(number_of_edges);
-
-  // Read
-  CUGRAPH_EXPECTS(
-    (mm_to_coo<vertex_t, weight_t>(
-      fpin, 1, number_of_edges, &coo_row_ind[0], &coo_col_ind[0], &coo_val[0], NULL)) == 0,
-    "file read failure.");
-  CUGRAPH_EXPECTS(fclose(fpin) == 0, "fclose failure.");
+  directed = !is_symmetric;
 
   cugraph::legacy::GraphCOOView<vertex_t, edge_t, weight_t> cooview(
-    &coo_row_ind[0], &coo_col_ind[0], &coo_val[0], number_of_vertices, number_of_edges);
+    &coo_row_ind[0], &coo_col_ind[0], &(*coo_val)[0], number_of_vertices, number_of_edges);
 
   return cugraph::coo_to_csr(cooview);
 }
@@ -274,39 +458,14 @@ read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
                                       bool store_transposed,
                                       bool multi_gpu)
 {
-  MM_typecode mc{};
-  vertex_t m{};
-  size_t nnz{};
-
-  FILE* file = fopen(graph_file_full_path.c_str(), "r");
-  CUGRAPH_EXPECTS(file != nullptr, "fopen (%s) failure.", graph_file_full_path.c_str());
-
-  size_t tmp_m{};
-  size_t tmp_k{};
-  auto mm_ret = cugraph::test::mm_properties<size_t>(file, 1, &mc, &tmp_m, &tmp_k, &nnz);
-  CUGRAPH_EXPECTS(mm_ret == 0, "could not read Matrix Market file properties.");
-  m = static_cast<vertex_t>(tmp_m);
-  CUGRAPH_EXPECTS(mm_is_matrix(mc) && mm_is_coordinate(mc) && !mm_is_complex(mc) && !mm_is_skew(mc),
-                  "invalid Matrix Market file properties.");
-
-  vertex_t number_of_vertices = m;
-  bool is_symmetric           = mm_is_symmetric(mc);
-
-  std::vector<vertex_t> h_rows(nnz);
-  std::vector<vertex_t> h_cols(nnz);
-  std::vector<weight_t> h_weights(nnz);
-
-  mm_ret = cugraph::test::mm_to_coo<vertex_t, weight_t>(
-    file, 1, nnz, h_rows.data(), h_cols.data(), h_weights.data(), static_cast<weight_t*>(nullptr));
-  CUGRAPH_EXPECTS(mm_ret == 0, "could not read matrix data");
-
-  auto file_ret = fclose(file);
-  CUGRAPH_EXPECTS(file_ret == 0, "fclose failure.");
+  auto [h_rows, h_cols, h_weights, number_of_vertices, is_symmetric] =
+    read_edgelist_from_matrix_market_file_to_host<vertex_t, weight_t>(
+      graph_file_full_path, test_weighted, size_t{0});
 
   rmm::device_uvector<vertex_t> d_edgelist_srcs(h_rows.size(), handle.get_stream());
   rmm::device_uvector<vertex_t> d_edgelist_dsts(h_cols.size(), handle.get_stream());
   auto d_edgelist_weights = test_weighted ? std::make_optional<rmm::device_uvector<weight_t>>(
-                                              h_weights.size(), handle.get_stream())
+                                              (*h_weights).size(), handle.get_stream())
                                           : std::nullopt;
 
   rmm::device_uvector<vertex_t> d_vertices(number_of_vertices, handle.get_stream());
@@ -315,7 +474,7 @@ read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
   raft::update_device(d_edgelist_dsts.data(), h_cols.data(), h_cols.size(), handle.get_stream());
   if (d_edgelist_weights) {
     raft::update_device(
-      (*d_edgelist_weights).data(), h_weights.data(), h_weights.size(), handle.get_stream());
+      (*d_edgelist_weights).data(), (*h_weights).data(), (*h_weights).size(), handle.get_stream());
   }
 
   thrust::sequence(handle.get_thrust_policy(), d_vertices.begin(), d_vertices.end(), vertex_t{0});
@@ -439,6 +598,12 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
 
 // explicit instantiations
 
+template int32_t mm_properties(
+  FILE* f, int32_t tg, MM_typecode* t, int32_t* m, int32_t* n, int32_t* nnz);
+
+template int32_t mm_properties(
+  FILE* f, int32_t tg, MM_typecode* t, int64_t* m, int64_t* n, int64_t* nnz);
+
 template int32_t mm_to_coo(FILE* f,
                            int32_t tg,
                            int32_t nnz,
@@ -475,6 +640,38 @@ generate_graph_csr_from_mm(bool& directed, std::string mm_file);
 template std::unique_ptr<cugraph::legacy::GraphCSR<int64_t, int64_t, float>>
 generate_graph_csr_from_mm(bool& directed, std::string mm_file);
 
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::optional<std::vector<float>>,
+                    int32_t,
+                    bool>
+read_edgelist_from_matrix_market_file_to_host<int32_t, float>(
+  std::string const& graph_file_full_path, bool test_weighted, size_t num_threads);
+
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::optional<std::vector<double>>,
+                    int32_t,
+                    bool>
+read_edgelist_from_matrix_market_file_to_host<int32_t, double>(
+  std::string const& graph_file_full_path, bool test_weighted, size_t num_threads);
+
+template std::tuple<std::vector<int64_t>,
+                    std::vector<int64_t>,
+                    std::optional<std::vector<float>>,
+                    int64_t,
+                    bool>
+read_edgelist_from_matrix_market_file_to_host<int64_t, float>(
+  std::string const& graph_file_full_path, bool test_weighted, size_t num_threads);
+
+template std::tuple<std::vector<int64_t>,
+                    std::vector<int64_t>,
+                    std::optional<std::vector<double>>,
+                    int64_t,
+                    bool>
+read_edgelist_from_matrix_market_file_to_host<int64_t, double>(
+  std::string const& graph_file_full_path, bool test_weighted, size_t num_threads);
+
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>,
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/file_parsing_utilities.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <detail/graph_partition_utils.cuh>
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/distance.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+
+namespace cugraph {
+namespace test {
+namespace detail {
+
+// (source, destination, weight), the weight is 0 if weights are not stored; sorting the tuples and
+// keeping the first edge of every (source, destination) pair keeps the minimum weight multi-edge
+// (identical to sort_and_remove_multi_edges)
+template <typename vertex_t, typename weight_t>
+using snap_edge_t = std::tuple<vertex_t, vertex_t, weight_t>;
+
+template <typename vertex_t, typename weight_t>
+struct snap_chunk_edgelist_t {
+  std::vector<snap_edge_t<vertex_t, weight_t>> edges{};
+  size_t num_edge_lines{0};  // including the dropped self-loops
+  size_t num_weighted_edge_lines{0};
+};
+
+// remove the multi-edges from sorted edges
+template <typename vertex_t, typename weight_t>
+void remove_sorted_multi_edges(std::vector<snap_edge_t<vertex_t, weight_t>>& edges)
+{
+  edges.erase(std::unique(edges.begin(),
+                          edges.end(),
+                          [](auto const& lhs, auto const& rhs) {
+                            return (std::get<0>(lhs) == std::get<0>(rhs)) &&
+                                   (std::get<1>(lhs) == std::get<1>(rhs));
+                          }),
+              edges.end());
+}
+
+// parse a line-aligned chunk of a SNAP edge list file, lines starting with '#' (or '%') are
+// comments, and every other non-blank line has a source, a destination, and an optional weight
+// separated by blanks
+template <typename vertex_t, typename weight_t>
+snap_chunk_edgelist_t<vertex_t, weight_t> parse_snap_chunk(char const* first,
+                                                            char const* last,
+                                                            bool store_weights,
+                                                            bool drop_self_loops)
+{
+  snap_chunk_edgelist_t<vertex_t, weight_t> ret{};
+
+  auto cur = first;
+  while (cur != last) {
+    cur = skip_blanks(cur, last);
+    if (cur == last) { break; }
+    if ((*cur == '\n') || (*cur == '#') || (*cur == '%')) {
+      cur = skip_line(cur, last);
+      continue;
+    }
+
+    int64_t src{};
+    int64_t dst{};
+    double w{1.0};
+    bool valid = parse_integer(cur, last, src);
+    if (valid) {
+      cur   = skip_blanks(cur, last);
+      valid = parse_integer(cur, last, dst);
+    }
+    CUGRAPH_EXPECTS(valid, "Invalid input file contents (invalid vertex ID).");
+    CUGRAPH_EXPECTS((std::min(src, dst) >= std::numeric_limits<vertex_t>::lowest()) &&
+                      (std::max(src, dst) <= std::numeric_limits<vertex_t>::max()),
+                    "vertex_t overflow.");
+    cur = skip_blanks(cur, last);
+    if ((cur != last) && (*cur != '\n')) {
+      CUGRAPH_EXPECTS(parse_real(cur, last, w), "Invalid input file contents (invalid weight).");
+      cur = skip_blanks(cur, last);
+      CUGRAPH_EXPECTS((cur == last) || (*cur == '\n'), "Too many tokens in a line.");
+      ++ret.num_weighted_edge_lines;
+    }
+    ++ret.num_edge_lines;
+
+    if (!drop_self_loops || (src != dst)) {
+      ret.edges.emplace_back(static_cast<vertex_t>(src),
+                             static_cast<vertex_t>(dst),
+                             store_weights ? static_cast<weight_t>(w) : weight_t{0});
+    }
+
+    cur = skip_line(cur, last);
+  }
+
+  return ret;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::optional<std::vector<weight_t>>>
+read_edgelist_from_snap_file_to_host(std::string const& graph_file_full_path,
+                                     bool test_weighted,
+                                     bool drop_self_loops,
+                                     bool drop_multi_edges,
+                                     size_t num_threads)
+{
+  detail::mmapped_file_t file(graph_file_full_path);
+  num_threads = detail::get_num_host_threads(num_threads);
+
+  // 1. parse (and drop self-loops) in parallel, every thread sorts & de-duplicates its own chunk if
+  // drop_multi_edges is set
+
+  auto boundaries = detail::split_into_line_aligned_chunks(file.begin(), file.end(), num_threads);
+  std::vector<detail::snap_chunk_edgelist_t<vertex_t, weight_t>> chunks(num_threads);
+  detail::run_host_threads(num_threads, [&](size_t i) {
+    chunks[i] = detail::parse_snap_chunk<vertex_t, weight_t>(
+      boundaries[i], boundaries[i + 1], test_weighted, drop_self_loops);
+    if (drop_multi_edges) {
+      std::sort(chunks[i].edges.begin(), chunks[i].edges.end());
+      detail::remove_sorted_multi_edges<vertex_t, weight_t>(chunks[i].edges);
+    }
+  });
+
+  size_t num_edge_lines{0};
+  size_t num_weighted_edge_lines{0};
+  for (auto const& chunk : chunks) {
+    num_edge_lines += chunk.num_edge_lines;
+    num_weighted_edge_lines += chunk.num_weighted_edge_lines;
+  }
+  CUGRAPH_EXPECTS((num_weighted_edge_lines == 0) || (num_weighted_edge_lines == num_edge_lines),
+                  "Invalid input file contents (# source IDs != # weights).");
+  CUGRAPH_EXPECTS(!test_weighted || (num_weighted_edge_lines > 0) || (num_edge_lines == 0),
+                  "test_weighted set but weights are not provided.");
+
+  // 2. merge the sorted chunks pairwise (in parallel) removing the multi-edges across the chunks,
+  // duplicates in two sorted & de-duplicated runs become adjacent after merging
+
+  std::vector<std::vector<detail::snap_edge_t<vertex_t, weight_t>>> runs(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    runs[i] = std::move(chunks[i].edges);
+  }
+  chunks.clear();
+  if (drop_multi_edges) {
+    while (runs.size() > 1) {
+      std::vector<std::vector<detail::snap_edge_t<vertex_t, weight_t>>> merged_runs(
+        (runs.size() + 1) / 2);
+      detail::run_host_threads(merged_runs.size(), [&runs, &merged_runs](size_t i) {
+        if (2 * i + 1 < runs.size()) {
+          merged_runs[i].resize(runs[2 * i].size() + runs[2 * i + 1].size());
+          std::merge(runs[2 * i].begin(),
+                     runs[2 * i].end(),
+                     runs[2 * i + 1].begin(),
+                     runs[2 * i + 1].end(),
+                     merged_runs[i].begin());
+          std::vector<detail::snap_edge_t<vertex_t, weight_t>>().swap(runs[2 * i]);
+          std::vector<detail::snap_edge_t<vertex_t, weight_t>>().swap(runs[2 * i + 1]);
+          detail::remove_sorted_multi_edges<vertex_t, weight_t>(merged_runs[i]);
+        } else {
+          merged_runs[i] = std::move(runs[2 * i]);
+        }
+      });
+      runs = std::move(merged_runs);
+    }
+  }
+
+  // 3. concatenate the runs (in the file order if the multi-edges are not removed)
+
+  std::vector<size_t> run_offsets(runs.size() + 1, 0);
+  for (size_t i = 0; i < runs.size(); ++i) {
+    run_offsets[i + 1] = run_offsets[i] + runs[i].size();
+  }
+
+  std::vector<vertex_t> srcs(run_offsets.back());
+  std::vector<vertex_t> dsts(run_offsets.back());
+  auto weights =
+    test_weighted ? std::make_optional<std::vector<weight_t>>(run_offsets.back()) : std::nullopt;
+  detail::run_host_threads(runs.size(), [&](size_t i) {
+    for (size_t j = 0; j < runs[i].size(); ++j) {
+      srcs[run_offsets[i] + j] = std::get<0>(runs[i][j]);
+      dsts[run_offsets[i] + j] = std::get<1>(runs[i][j]);
+      if (weights) { (*weights)[run_offsets[i] + j] = std::get<2>(runs[i][j]); }
+    }
+    std::vector<detail::snap_edge_t<vertex_t, weight_t>>().swap(runs[i]);
+  });
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights));
+}
+
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           bool>
+read_edgelist_from_snap_file(raft::handle_t const& handle,
+                             std::string const& graph_file_full_path,
+                             bool test_weighted,
+                             bool store_transposed,
+                             bool multi_gpu,
+                             bool drop_self_loops,
+                             bool drop_multi_edges)
+{
+  auto [h_srcs, h_dsts, h_weights] = read_edgelist_from_snap_file_to_host<vertex_t, weight_t>(
+    graph_file_full_path, test_weighted, drop_self_loops, drop_multi_edges, size_t{0});
+
+  rmm::device_uvector<vertex_t> d_edgelist_srcs(h_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_edgelist_dsts(h_dsts.size(), handle.get_stream());
+  auto d_edgelist_weights = test_weighted ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                              (*h_weights).size(), handle.get_stream())
+                                          : std::nullopt;
+
+  raft::update_device(d_edgelist_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+  raft::update_device(d_edgelist_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+  if (d_edgelist_weights) {
+    raft::update_device(
+      (*d_edgelist_weights).data(), (*h_weights).data(), (*h_weights).size(), handle.get_stream());
+  }
+
+  bool is_symmetric = detail::check_symmetric(
+    handle,
+    raft::device_span<vertex_t const>(d_edgelist_srcs.data(), d_edgelist_srcs.size()),
+    raft::device_span<vertex_t const>(d_edgelist_dsts.data(), d_edgelist_dsts.size()),
+    d_edgelist_weights ? std::make_optional<raft::device_span<weight_t const>>(
+                           (*d_edgelist_weights).data(), (*d_edgelist_weights).size())
+                       : std::nullopt);
+
+  if (multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    auto edge_key_func = cugraph::detail::compute_gpu_id_from_ext_edge_endpoints_t<vertex_t>{
+      comm_size, major_comm_size, minor_comm_size};
+    size_t number_of_local_edges{};
+    if (d_edgelist_weights) {
+      auto edge_first       = thrust::make_zip_iterator(thrust::make_tuple(
+        d_edgelist_srcs.begin(), d_edgelist_dsts.begin(), (*d_edgelist_weights).begin()));
+      number_of_local_edges = thrust::distance(
+        edge_first,
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          edge_first,
+          edge_first + d_edgelist_srcs.size(),
+          [store_transposed, comm_rank, key_func = edge_key_func] __device__(auto e) {
+            auto major = thrust::get<0>(e);
+            auto minor = thrust::get<1>(e);
+            return store_transposed ? key_func(minor, major) != comm_rank
+                                    : key_func(major, minor) != comm_rank;
+          }));
+    } else {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(d_edgelist_srcs.begin(), d_edgelist_dsts.begin()));
+      number_of_local_edges = thrust::distance(
+        edge_first,
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          edge_first,
+          edge_first + d_edgelist_srcs.size(),
+          [store_transposed, comm_rank, key_func = edge_key_func] __device__(auto e) {
+            auto major = thrust::get<0>(e);
+            auto minor = thrust::get<1>(e);
+            return store_transposed ? key_func(minor, major) != comm_rank
+                                    : key_func(major, minor) != comm_rank;
+          }));
+    }
+
+    d_edgelist_srcs.resize(number_of_local_edges, handle.get_stream());
+    d_edgelist_srcs.shrink_to_fit(handle.get_stream());
+    d_edgelist_dsts.resize(number_of_local_edges, handle.get_stream());
+    d_edgelist_dsts.shrink_to_fit(handle.get_stream());
+    if (d_edgelist_weights) {
+      (*d_edgelist_weights).resize(number_of_local_edges, handle.get_stream());
+      (*d_edgelist_weights).shrink_to_fit(handle.get_stream());
+    }
+  }
+
+  return std::make_tuple(std::move(d_edgelist_srcs),
+                         std::move(d_edgelist_dsts),
+                         std::move(d_edgelist_weights),
+                         is_symmetric);
+}
+
+// explicit instantiations
+
+template std::tuple<std::vector<int32_t>, std::vector<int32_t>, std::optional<std::vector<float>>>
+read_edgelist_from_snap_file_to_host<int32_t, float>(std::string const& graph_file_full_path,
+                                                     bool test_weighted,
+                                                     bool drop_self_loops,
+                                                     bool drop_multi_edges,
+                                                     size_t num_threads);
+
+template std::tuple<std::vector<int32_t>, std::vector<int32_t>, std::optional<std::vector<double>>>
+read_edgelist_from_snap_file_to_host<int32_t, double>(std::string const& graph_file_full_path,
+                                                      bool test_weighted,
+                                                      bool drop_self_loops,
+                                                      bool drop_multi_edges,
+                                                      size_t num_threads);
+
+template std::tuple<std::vector<int64_t>, std::vector<int64_t>, std::optional<std::vector<float>>>
+read_edgelist_from_snap_file_to_host<int64_t, float>(std::string const& graph_file_full_path,
+                                                     bool test_weighted,
+                                                     bool drop_self_loops,
+                                                     bool drop_multi_edges,
+                                                     size_t num_threads);
+
+template std::tuple<std::vector<int64_t>, std::vector<int64_t>, std::optional<std::vector<double>>>
+read_edgelist_from_snap_file_to_host<int64_t, double>(std::string const& graph_file_full_path,
+                                                      bool test_weighted,
+                                                      bool drop_self_loops,
+                                                      bool drop_multi_edges,
+                                                      size_t num_threads);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    bool>
+read_edgelist_from_snap_file<int32_t, float>(raft::handle_t const& handle,
+                                             std::string const& graph_file_full_path,
+                                             bool test_weighted,
+                                             bool store_transposed,
+                                             bool multi_gpu,
+                                             bool drop_self_loops,
+                                             bool drop_multi_edges);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    bool>
+read_edgelist_from_snap_file<int32_t, double>(raft::handle_t const& handle,
+                                              std::string const& graph_file_full_path,
+                                              bool test_weighted,
+                                              bool store_transposed,
+                                              bool multi_gpu,
+                                              bool drop_self_loops,
+                                              bool drop_multi_edges);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    bool>
+read_edgelist_from_snap_file<int64_t, float>(raft::handle_t const& handle,
+                                             std::string const& graph_file_full_path,
+                                             bool test_weighted,
+                                             bool store_transposed,
+                                             bool multi_gpu,
+                                             bool drop_self_loops,
+                                             bool drop_multi_edges);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    bool>
+read_edgelist_from_snap_file<int64_t, double>(raft::handle_t const& handle,
+                                              std::string const& graph_file_full_path,
+                                              bool test_weighted,
+                                              bool store_transposed,
+                                              bool multi_gpu,
+                                              bool drop_self_loops,
+                                              bool drop_multi_edges);
+
+}  // namespace test
+}  // namespace cugraph
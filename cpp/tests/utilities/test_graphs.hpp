@@ -19,6 +19,7 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_generators.hpp>
+#include <cugraph/graph_io.hpp>
 #include <cugraph/legacy/functions.hpp>  // legacy coo_to_csr
 
 #include <raft/random/rng_state.hpp>
@@ -113,8 +114,15 @@ class File_Usecase : public detail::TranslateGraph_Usecase {
  public:
   File_Usecase() = delete;
 
-  File_Usecase(std::string const& graph_file_path, size_t base_vertex_id = 0)
-    : detail::TranslateGraph_Usecase(base_vertex_id)
+  // drop_self_loops & drop_multi_edges are applied while parsing SNAP edge list files (.txt or
+  // .snap) and on the device after loading Matrix Market or CSV files
+  File_Usecase(std::string const& graph_file_path,
+               size_t base_vertex_id = 0,
+               bool drop_self_loops  = false,
+               bool drop_multi_edges = false)
+    : detail::TranslateGraph_Usecase(base_vertex_id),
+      drop_self_loops_(drop_self_loops),
+      drop_multi_edges_(drop_multi_edges)
   {
     set_filename(graph_file_path);
   }
@@ -128,6 +136,15 @@ class File_Usecase : public detail::TranslateGraph_Usecase {
     }
   }
 
+  std::string const& get_file_full_path() const { return graph_file_full_path_; }
+
+  // size, weight, and symmetry of the file without parsing the entire file (e.g. to pick vertex_t
+  // and edge_t), see cugraph::probe_graph_file()
+  cugraph::graph_file_properties_t probe(size_t num_sample_lines = 0) const
+  {
+    return cugraph::probe_graph_file(graph_file_full_path_, num_sample_lines);
+  }
+
   template <typename vertex_t, typename weight_t>
   std::tuple<rmm::device_uvector<vertex_t>,
              rmm::device_uvector<vertex_t>,
@@ -145,13 +162,36 @@ class File_Usecase : public detail::TranslateGraph_Usecase {
     std::optional<rmm::device_uvector<vertex_t>> vertices{};
     bool is_symmetric{};
     auto extension = graph_file_full_path_.substr(graph_file_full_path_.find_last_of(".") + 1);
+    bool is_snap = (extension == "txt") || (extension == "snap");
+    std::optional<cugraph::graph_file_properties_t> properties{std::nullopt};
+    if ((extension == "mtx") || (extension == "csv") || is_snap) {
+      // sampled vertex IDs are actual vertex IDs, so this fails only if vertex_t is too narrow
+      properties = probe();
+      CUGRAPH_EXPECTS((*properties).vertex_t_fits<vertex_t>(),
+                      "Invalid template parameter: vertex_t overflow.");
+    }
     if (extension == "mtx") {
       std::tie(srcs, dsts, weights, vertices, is_symmetric) =
         read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
           handle, graph_file_full_path_, test_weighted, store_transposed, multi_gpu);
     } else if (extension == "csv") {
       std::tie(srcs, dsts, weights, is_symmetric) = read_edgelist_from_csv_file<vertex_t, weight_t>(
-        handle, graph_file_full_path_, test_weighted, store_transposed, multi_gpu);
+        handle, graph_file_full_path_, test_weighted, store_transposed, multi_gpu, properties);
+    } else if (is_snap) {
+      std::tie(srcs, dsts, weights, is_symmetric) =
+        read_edgelist_from_snap_file<vertex_t, weight_t>(handle,
+                                                         graph_file_full_path_,
+                                                         test_weighted,
+                                                         store_transposed,
+                                                         multi_gpu,
+                                                         drop_self_loops_,
+                                                         drop_multi_edges_);
+    } else {
+      CUGRAPH_FAIL("Unsupported graph file extension.");
+    }
+    if (!is_snap) {
+      if (drop_self_loops_) { remove_self_loops(handle, srcs, dsts, weights); }
+      if (drop_multi_edges_) { sort_and_remove_multi_edges(handle, srcs, dsts, weights); }
     }
 
     translate(handle, srcs, dsts);
@@ -163,6 +203,8 @@ class File_Usecase : public detail::TranslateGraph_Usecase {
 
  private:
   std::string graph_file_full_path_{};
+  bool drop_self_loops_{false};
+  bool drop_multi_edges_{false};
 };
 
 class Rmat_Usecase : public detail::TranslateGraph_Usecase {
@@ -17,6 +17,7 @@
 
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_io.hpp>
 #include <cugraph/legacy/graph.hpp>
 
 #include <raft/core/handle.hpp>
@@ -25,6 +26,8 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 
+#include <filesystem>
+#include <functional>
 #include <numeric>
 #include <optional>
 #include <random>
@@ -32,6 +35,8 @@
 #include <type_traits>
 #include <vector>
 
+#include <unistd.h>
+
 extern "C" {
 #include "mmio.h"
 }
@@ -87,6 +92,28 @@ int mm_to_coo(FILE* f,
               ValueType_* cooRVal,
               ValueType_* cooIVal);
 
+namespace detail {
+
+struct matrix_market_header_t {
+  MM_typecode typecode{};
+  size_t number_of_rows{};
+  size_t number_of_columns{};
+  size_t number_of_entries{};  // # entries in the file (before converting to the general format)
+  size_t body_offset{};        // offset (in bytes) of the first line after the size line
+};
+
+// parse the banner, comments, and the size line of a Matrix Market file stored in [first, last)
+matrix_market_header_t parse_matrix_market_header(char const* first, char const* last);
+
+// true if the edge list is identical to its symmetrized edge list (see symmetrize_edgelist)
+template <typename vertex_t, typename weight_t>
+bool check_symmetric(raft::handle_t const& handle,
+                     raft::device_span<vertex_t const> edgelist_srcs,
+                     raft::device_span<vertex_t const> edgelist_dsts,
+                     std::optional<raft::device_span<weight_t const>> edgelist_weights);
+
+}  // namespace detail
+
 // FIXME: A similar function could be useful for CSC format
 //        There are functions above that operate coo -> csr and coo->csc
 /**
@@ -127,6 +154,19 @@ read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
                                       bool store_transposed,
                                       bool multi_gpu);
 
+// Memory-maps the file and parses it in a single pass with num_threads host threads (0: use all
+// the available cores). Symmetric & Hermitian inputs are converted to the general format. Returns a
+// tuple of (rows, columns, weights (if test_weighted), number of vertices, is_symmetric).
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>,
+           std::vector<vertex_t>,
+           std::optional<std::vector<weight_t>>,
+           vertex_t,
+           bool>
+read_edgelist_from_matrix_market_file_to_host(std::string const& graph_file_full_path,
+                                              bool test_weighted,
+                                              size_t num_threads = 0);
+
 // renumber must be true if multi_gpu is true
 template <typename vertex_t,
           typename edge_t,
@@ -143,16 +183,88 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
                                    bool test_weighted,
                                    bool renumber);
 
+// properties: cugraph::probe_graph_file() output for the file (probed here if std::nullopt)
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           bool>
+read_edgelist_from_csv_file(
+  raft::handle_t const& handle,
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  bool store_transposed,
+  bool multi_gpu,
+  std::optional<cugraph::graph_file_properties_t> properties = std::nullopt);
+
+// returns a per-process file path in the system temporary directory (e.g.
+// /tmp/cugraph_graph_io_test_1234.bin for ("cugraph_graph_io_test", ".bin")), so concurrently
+// running test programs do not overwrite each other's files
+inline std::string temporary_file_path(std::string const& name, std::string const& extension)
+{
+  return (std::filesystem::temp_directory_path() /
+          (name + "_" + std::to_string(::getpid()) + extension))
+    .string();
+}
+
+// removes the (temporary) file on destruction, so the file does not outlive a failed test
+struct temporary_file_guard_t {
+  std::string file_path{};
+
+  temporary_file_guard_t(std::string path) : file_path(std::move(path)) {}
+  temporary_file_guard_t(temporary_file_guard_t const&) = delete;
+  temporary_file_guard_t& operator=(temporary_file_guard_t const&) = delete;
+  ~temporary_file_guard_t()
+  {
+    std::error_code ec{};
+    std::filesystem::remove(file_path, ec);
+  }
+};
+
+// Memory-maps the file and parses it in rounds of (about) batch_size edges, every round is split to
+// num_threads (0: use all the available cores) line-aligned chunks parsed in parallel. batch_op is
+// invoked on the calling thread in the file order with batches of at most batch_size edges
+// (sources, destinations, and weights (if test_weighted)) while the next round is parsed in the
+// background, so the host memory footprint is bounded by a few batches regardless of the file size.
+template <typename vertex_t, typename weight_t>
+void read_edgelist_from_csv_file_in_batches(
+  std::string const& graph_file_full_path,
+  bool test_weighted,
+  size_t batch_size,
+  std::function<void(std::vector<vertex_t>&& srcs,
+                     std::vector<vertex_t>&& dsts,
+                     std::optional<std::vector<weight_t>>&& weights)> batch_op,
+  size_t num_threads = 0);
+
+// Memory-maps a SNAP style edge list file (lines starting with '#' or '%' are comments, every
+// other non-blank line has a source, a destination, and an optional weight separated by blanks) and
+// parses it with num_threads host threads (0: use all the available cores). Self-loops are dropped
+// while parsing if drop_self_loops is set. If drop_multi_edges is set, every thread sorts and
+// de-duplicates its own chunk and the chunks are merged pairwise in parallel (the minimum weight
+// edge is kept, as sort_and_remove_multi_edges does) and the returned edges are sorted; otherwise,
+// the edges are returned in the file order. Returns a tuple of (sources, destinations, weights (if
+// test_weighted)).
+template <typename vertex_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::optional<std::vector<weight_t>>>
+read_edgelist_from_snap_file_to_host(std::string const& graph_file_full_path,
+                                     bool test_weighted,
+                                     bool drop_self_loops  = false,
+                                     bool drop_multi_edges = false,
+                                     size_t num_threads    = 0);
+
+// returns a tuple of (sources, destinations, weights, is_symmetric)
 template <typename vertex_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
            std::optional<rmm::device_uvector<weight_t>>,
            bool>
-read_edgelist_from_csv_file(raft::handle_t const& handle,
-                            std::string const& graph_file_full_path,
-                            bool test_weighted,
-                            bool store_transposed,
-                            bool multi_gpu);
+read_edgelist_from_snap_file(raft::handle_t const& handle,
+                             std::string const& graph_file_full_path,
+                             bool test_weighted,
+                             bool store_transposed,
+                             bool multi_gpu,
+                             bool drop_self_loops  = false,
+                             bool drop_multi_edges = false);
 
 // alias for easy customization for debug purposes:
 //